@@ -0,0 +1,222 @@
+/**
+ * @file bench_main.cpp
+ * @brief Параметрический бенчмарк интерполяции (make bench)
+ *
+ * Прогон по числу узлов, размеру пакета, числу потоков, режиму вычисления,
+ * ядру (только поддерживаемые процессором, для режима newton) и политике
+ * распределения (включая пул с перехватом работы) с прогревом и повторами. Данные генерируются с фиксированным зерном, поэтому
+ * прогоны на разных машинах и в разные дни сравнимы. Результаты выводятся в
+ * консоль и сохраняются в CSV и JSON.
+ *
+ * Параметры: --quick, --seed N, --warmup N, --runs N, --csv PATH, --json PATH
+ */
+
+#include <iostream>
+#include <iomanip>
+#include <cmath>
+#include <span>
+#include <random>
+#include <string>
+#include <vector>
+#include <cstdlib>
+#include <omp.h>
+#include "core/newton_interpolator.h"
+#include "core/evaluation_kernels.h"
+#include "core/parallel_scheduler.h"
+#include "core/benchmark.h"
+#include "core/benchmark_report.h"
+
+/**
+ * @brief Параметры прогона
+ */
+struct BenchOptions {
+    bool quick = false;
+    unsigned seed = 20240601;
+    size_t warmup = 3;
+    size_t runs = 20;
+    std::string csv_path = "bench_results.csv";
+    std::string json_path = "bench_results.json";
+};
+
+/**
+ * @brief Разбирает аргументы командной строки
+ */
+BenchOptions parse_options(int argc, char** argv) {
+    BenchOptions options;
+    for (int i = 1; i < argc; i++) {
+        std::string arg = argv[i];
+        bool has_value = i + 1 < argc;
+        if (arg == "--quick") {
+            options.quick = true;
+        } else if (arg == "--seed" && has_value) {
+            options.seed = static_cast<unsigned>(std::strtoul(argv[++i], nullptr, 10));
+        } else if (arg == "--warmup" && has_value) {
+            options.warmup = std::strtoul(argv[++i], nullptr, 10);
+        } else if (arg == "--runs" && has_value) {
+            options.runs = std::strtoul(argv[++i], nullptr, 10);
+        } else if (arg == "--csv" && has_value) {
+            options.csv_path = argv[++i];
+        } else if (arg == "--json" && has_value) {
+            options.json_path = argv[++i];
+        } else {
+            std::cerr << "Неизвестный параметр: " << arg << std::endl;
+            std::exit(1);
+        }
+    }
+    return options;
+}
+
+/**
+ * @brief Генерирует таблицу y = sin(x) + шум по случайным узлам на [0, 10]
+ */
+void generate_table(std::mt19937& gen, size_t n, std::vector<double>& x, std::vector<double>& y) {
+    std::uniform_real_distribution<double> node(0.0, 10.0);
+    std::uniform_real_distribution<double> noise(-0.1, 0.1);
+    x.resize(n);
+    y.resize(n);
+    for (size_t i = 0; i < n; i++) {
+        x[i] = node(gen);
+        y[i] = std::sin(x[i]) + noise(gen);
+    }
+}
+
+/**
+ * @brief Возвращает числа потоков 1, 2, 4, ... и максимальное
+ */
+std::vector<int> thread_sweep(int max_threads) {
+    std::vector<int> threads;
+    for (int t = 1; t < max_threads; t *= 2) {
+        threads.push_back(t);
+    }
+    threads.push_back(max_threads);
+    return threads;
+}
+
+/**
+ * @brief Возвращает ядра, поддерживаемые процессором
+ */
+std::vector<EvaluationKernel> kernel_sweep() {
+    std::vector<EvaluationKernel> kernels;
+    for (EvaluationKernel kernel : {EvaluationKernel::Scalar, EvaluationKernel::SSE2,
+                                    EvaluationKernel::AVX2, EvaluationKernel::AVX512}) {
+        if (EvaluationKernels::is_supported(kernel)) {
+            kernels.push_back(kernel);
+        }
+    }
+    return kernels;
+}
+
+/**
+ * @brief Выводит запись в консоль
+ */
+void print_record(const BenchmarkRecord& r) {
+    std::cout << std::left << std::setw(12) << r.mode << std::setw(10) << r.phase
+              << std::setw(8) << r.kernel << std::setw(15) << r.schedule
+              << std::right << std::setw(7) << r.nodes << std::setw(9) << r.batch << std::setw(5) << r.threads
+              << std::fixed << std::setprecision(4)
+              << std::setw(11) << r.stats.median_ms << std::setw(11) << r.stats.p95_ms
+              << std::setw(11) << r.stats.stddev_ms
+              << std::scientific << std::setprecision(3) << std::setw(12) << r.points_per_second()
+              << std::defaultfloat << std::endl;
+}
+
+int main(int argc, char** argv) {
+#ifdef _WIN32
+    system("chcp 65001 > nul");
+#endif
+
+    BenchOptions options = parse_options(argc, argv);
+    const std::vector<size_t> node_counts = options.quick ? std::vector<size_t>{25, 200}
+                                                          : std::vector<size_t>{25, 100, 1000};
+    const std::vector<size_t> batch_sizes = options.quick ? std::vector<size_t>{1000, 10000}
+                                                          : std::vector<size_t>{1000, 10000, 100000};
+    const std::vector<int> threads = thread_sweep(omp_get_num_procs());
+    const std::vector<std::pair<std::string, InterpolationMethod>> modes = {
+        {"newton", InterpolationMethod::Newton},
+        {"barycentric", InterpolationMethod::Barycentric},
+        {"piecewise", InterpolationMethod::Piecewise}
+    };
+    // Ядро влияет только на полином Ньютона, остальные режимы прогоняются один раз
+    const std::vector<EvaluationKernel> kernels = kernel_sweep();
+    const std::vector<SchedulePolicy> policies = {
+        SchedulePolicy::Static, SchedulePolicy::Dynamic, SchedulePolicy::Guided, SchedulePolicy::WorkStealing
+    };
+
+    Benchmark benchmark(options.warmup, options.runs);
+    BenchmarkReport report(options.seed);
+    std::cout << "Зерно: " << options.seed << ", прогрев: " << options.warmup
+              << ", повторов: " << options.runs << std::endl;
+    std::cout << std::left << std::setw(12) << "mode" << std::setw(10) << "phase"
+              << std::setw(8) << "kernel" << std::setw(15) << "schedule"
+              << std::right << std::setw(7) << "nodes" << std::setw(9) << "batch" << std::setw(5) << "thr"
+              << std::setw(11) << "median_ms" << std::setw(11) << "p95_ms" << std::setw(11) << "stddev_ms"
+              << std::setw(12) << "points/s" << std::endl;
+
+    try {
+        for (const auto& mode : modes) {
+            for (size_t n : node_counts) {
+                // Одно зерно на размер таблицы: все режимы и потоки видят одинаковые данные
+                std::mt19937 gen(options.seed + static_cast<unsigned>(n));
+                std::vector<double> x, y;
+                generate_table(gen, n, x, y);
+                std::uniform_real_distribution<double> query(0.0, 10.0);
+                std::vector<double> points(batch_sizes.back());
+                for (double& p : points) {
+                    p = query(gen);
+                }
+                std::vector<double> results(points.size());
+
+                for (int t : threads) {
+                    omp_set_num_threads(t);
+                    WorkStealingPool pool(static_cast<size_t>(t));
+                    NewtonInterpolator interpolator(mode.second);
+
+                    BenchmarkRecord setup;
+                    setup.mode = mode.first;
+                    setup.phase = "set_data";
+                    setup.kernel = "-";
+                    setup.schedule = "-";
+                    setup.nodes = n;
+                    setup.threads = static_cast<size_t>(t);
+                    setup.stats = benchmark.measure([&]() { interpolator.set_data(x, y); });
+                    report.add(setup);
+                    print_record(setup);
+
+                    const bool uses_kernel = mode.second == InterpolationMethod::Newton;
+                    const size_t kernel_count = uses_kernel ? kernels.size() : 1;
+                    for (size_t k = 0; k < kernel_count; k++) {
+                        interpolator.set_evaluation_kernel(kernels[k]);
+                        for (SchedulePolicy policy : policies) {
+                            ParallelSchedule schedule;
+                            schedule.policy = policy;
+                            schedule.thread_count = static_cast<size_t>(t);
+                            schedule.pool = &pool;
+
+                            for (size_t m : batch_sizes) {
+                                std::span<const double> in(points.data(), m);
+                                std::span<double> out(results.data(), m);
+                                BenchmarkRecord evaluation = setup;
+                                evaluation.phase = "evaluate";
+                                evaluation.kernel = uses_kernel ? EvaluationKernels::name(kernels[k]) : "-";
+                                evaluation.schedule = ParallelScheduler::name(policy);
+                                evaluation.batch = m;
+                                evaluation.stats = benchmark.measure([&]() {
+                                    interpolator.interpolate_into(in, out, schedule);
+                                });
+                                report.add(evaluation);
+                                print_record(evaluation);
+                            }
+                        }
+                    }
+                }
+            }
+        }
+        report.write_csv(options.csv_path);
+        report.write_json(options.json_path);
+        std::cout << "Результаты сохранены: " << options.csv_path << ", " << options.json_path << std::endl;
+    } catch (const std::exception& e) {
+        std::cerr << "Ошибка: " << e.what() << std::endl;
+        return 1;
+    }
+    return 0;
+}
@@ -0,0 +1,245 @@
+#include "accuracy_verifier.h"
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <numbers>
+#include <random>
+#include <stdexcept>
+
+namespace {
+
+/**
+ * @brief Название задачи в отчете: функция, число и вид узлов
+ */
+std::string problem_name(const ReferenceProblem& problem) {
+    std::string name = AccuracyVerifier::name(problem.function);
+    name += problem.chebyshev_nodes ? ", узлы Чебышева" : ", равномерные узлы";
+    name += ", n = " + std::to_string(problem.nodes);
+    return name;
+}
+
+/**
+ * @brief Вычисляет интерполянт в проверочных точках выбранным путем
+ */
+void evaluate_mode(const VerificationMode& mode, const std::vector<double>& x_nodes,
+                   const std::vector<double>& y_nodes, const std::vector<double>& points,
+                   std::vector<double>& results) {
+    NewtonInterpolator interpolator(x_nodes, y_nodes, mode.method);
+    interpolator.set_evaluation_kernel(mode.kernel);
+    switch (mode.path) {
+        case VerificationPath::Points:
+            if (interpolator.interpolate_into(points, results) != InterpolationStatus::Ok) {
+                throw std::runtime_error("Режим " + mode.name + " не вычислил точки");
+            }
+            return;
+        case VerificationPath::Grid:
+            // Та же сдвинутая сетка: шаг (back - front) / (size - 1) равен шагу points
+            results = interpolator.interpolate_grid(points.front(), points.back(), points.size());
+            return;
+        case VerificationPath::Chebyshev:
+            interpolator.to_chebyshev().evaluate(points.data(), results.data(), points.size());
+            return;
+        case VerificationPath::Monomial:
+            interpolator.to_monomial().evaluate(points.data(), results.data(), points.size());
+            return;
+    }
+    throw std::invalid_argument("Неизвестный путь вычисления");
+}
+
+/**
+ * @brief Заменяет NaN бесконечностью, чтобы сбойный режим не выглядел точным
+ */
+double finite_or_infinity(double error) {
+    return std::isnan(error) ? std::numeric_limits<double>::infinity() : error;
+}
+
+} // namespace
+
+double AccuracyVerifier::reference_value(ReferenceFunction function, double x) {
+    switch (function) {
+        case ReferenceFunction::Sine:
+        case ReferenceFunction::NoisySine:
+            return std::sin(x);
+        case ReferenceFunction::Exponential:
+            return std::exp(x);
+        case ReferenceFunction::Runge:
+            return 1.0 / (1.0 + 25.0 * x * x);
+        case ReferenceFunction::Polynomial:
+            return ((((x * x - 2.0) * x) * x + 0.5) * x) - 1.0;
+    }
+    throw std::invalid_argument("Неизвестная эталонная функция");
+}
+
+const char* AccuracyVerifier::name(ReferenceFunction function) {
+    switch (function) {
+        case ReferenceFunction::Sine:
+            return "sin(x)";
+        case ReferenceFunction::Exponential:
+            return "exp(x)";
+        case ReferenceFunction::Runge:
+            return "Рунге 1/(1+25x^2)";
+        case ReferenceFunction::Polynomial:
+            return "x^5-2x^3+0.5x-1";
+        case ReferenceFunction::NoisySine:
+            return "sin(x) с шумом";
+    }
+    return "unknown";
+}
+
+std::vector<ReferenceProblem> AccuracyVerifier::standard_problems() {
+    std::vector<ReferenceProblem> problems(5);
+    problems[0].function = ReferenceFunction::Sine;
+    problems[0].start = 0.0;
+    problems[0].end = 2.0 * std::numbers::pi;
+    problems[0].nodes = 16;
+
+    problems[1].function = ReferenceFunction::Exponential;
+    problems[1].start = -1.0;
+    problems[1].end = 1.0;
+    problems[1].nodes = 16;
+
+    problems[2].function = ReferenceFunction::Runge;
+    problems[2].start = -1.0;
+    problems[2].end = 1.0;
+    problems[2].nodes = 33;
+    problems[2].chebyshev_nodes = true;
+
+    problems[3].function = ReferenceFunction::Polynomial;
+    problems[3].start = -2.0;
+    problems[3].end = 2.0;
+    problems[3].nodes = 8;
+
+    problems[4].function = ReferenceFunction::NoisySine;
+    problems[4].start = 0.0;
+    problems[4].end = 2.0 * std::numbers::pi;
+    problems[4].nodes = 16;
+    problems[4].noise = 1e-3;
+    return problems;
+}
+
+std::vector<VerificationMode> AccuracyVerifier::default_modes() {
+    std::vector<VerificationMode> modes;
+    for (EvaluationKernel kernel : {EvaluationKernel::Scalar, EvaluationKernel::SSE2,
+                                    EvaluationKernel::AVX2, EvaluationKernel::AVX512}) {
+        if (EvaluationKernels::is_supported(kernel)) {
+            modes.push_back({std::string("Ньютон ") + EvaluationKernels::name(kernel),
+                             InterpolationMethod::Newton, kernel, VerificationPath::Points});
+        }
+    }
+    const EvaluationKernel best = EvaluationKernels::detect_best();
+    modes.push_back({"Сетка (разности)", InterpolationMethod::Newton, best, VerificationPath::Grid});
+    modes.push_back({"Ряд Чебышева", InterpolationMethod::Newton, best, VerificationPath::Chebyshev});
+    modes.push_back({"Мономы", InterpolationMethod::Newton, best, VerificationPath::Monomial});
+    modes.push_back({"Барицентрическая", InterpolationMethod::Barycentric, best, VerificationPath::Points});
+    modes.push_back({"Кусочная", InterpolationMethod::Piecewise, best, VerificationPath::Points});
+    return modes;
+}
+
+void AccuracyVerifier::make_nodes(const ReferenceProblem& problem, std::vector<double>& x, std::vector<double>& y) {
+    if (problem.nodes < 2) {
+        throw std::invalid_argument("Эталонной задаче нужно не менее 2 узлов");
+    }
+    if (!(problem.end > problem.start)) {
+        throw std::invalid_argument("Конец отрезка должен быть больше начала");
+    }
+    const size_t n = problem.nodes;
+    const double center = 0.5 * (problem.start + problem.end);
+    const double half_width = 0.5 * (problem.end - problem.start);
+    x.resize(n);
+    y.resize(n);
+    for (size_t k = 0; k < n; k++) {
+        if (problem.chebyshev_nodes) {
+            // Экстремумы многочлена Чебышева: концы отрезка входят в узлы
+            x[k] = center - half_width * std::cos(std::numbers::pi * k / (n - 1));
+        } else {
+            x[k] = problem.start + (problem.end - problem.start) * k / (n - 1);
+        }
+    }
+    x.front() = problem.start;
+    x.back() = problem.end;
+    for (size_t k = 0; k < n; k++) {
+        y[k] = reference_value(problem.function, x[k]);
+    }
+    if (problem.noise > 0.0) {
+        std::mt19937 generator(problem.seed);
+        std::normal_distribution<double> noise(0.0, problem.noise);
+        for (double& value : y) {
+            value += noise(generator);
+        }
+    }
+}
+
+std::vector<AccuracyReport> AccuracyVerifier::verify(const ReferenceProblem& problem,
+                                                     const std::vector<VerificationMode>& modes,
+                                                     size_t count) {
+    if (modes.empty()) {
+        throw std::invalid_argument("Нет режимов для проверки");
+    }
+    if (count < 2) {
+        throw std::invalid_argument("Нужно не менее 2 проверочных точек");
+    }
+    std::vector<double> x_nodes;
+    std::vector<double> y_nodes;
+    make_nodes(problem, x_nodes, y_nodes);
+
+    const long total = static_cast<long>(count);
+    // Сетка сдвинута на полшага: концы отрезка (всегда узлы) не попадают в
+    // точки и не занижают СКО нулевыми ошибками
+    const double step = (problem.end - problem.start) / static_cast<double>(count);
+    std::vector<double> points(count);
+    std::vector<double> reference(count);
+    double reference_scale = 0.0;
+    #pragma omp parallel for schedule(static) reduction(max:reference_scale)
+    for (long i = 0; i < total; i++) {
+        points[i] = problem.start + step * (static_cast<double>(i) + 0.5);
+        reference[i] = reference_value(problem.function, points[i]);
+        reference_scale = std::max(reference_scale, std::abs(reference[i]));
+    }
+    if (reference_scale == 0.0) {
+        reference_scale = 1.0;
+    }
+
+    const std::string name = problem_name(problem);
+    std::vector<double> baseline;
+    std::vector<double> results(count);
+    std::vector<AccuracyReport> reports;
+    reports.reserve(modes.size());
+    for (const VerificationMode& mode : modes) {
+        evaluate_mode(mode, x_nodes, y_nodes, points, results);
+
+        const double* base = baseline.empty() ? results.data() : baseline.data();
+        double max_error = 0.0;
+        double squares = 0.0;
+        double deviation = 0.0;
+        #pragma omp parallel for schedule(static) reduction(max:max_error, deviation) reduction(+:squares)
+        for (long i = 0; i < total; i++) {
+            // NaN не проходит сравнение в max и потерялся бы в редукции
+            const double error = finite_or_infinity(std::abs(results[i] - reference[i]));
+            max_error = std::max(max_error, error);
+            squares += error * error;
+            deviation = std::max(deviation, finite_or_infinity(std::abs(results[i] - base[i])));
+        }
+
+        AccuracyReport report;
+        report.problem = name;
+        report.mode = mode.name;
+        report.points = count;
+        report.max_error = max_error;
+        report.rms_error = std::sqrt(squares / static_cast<double>(count));
+        report.relative_error = max_error / reference_scale;
+        report.baseline_deviation = deviation / reference_scale;
+        reports.push_back(report);
+
+        if (baseline.empty()) {
+            baseline.swap(results);
+            results.resize(count);
+        }
+    }
+    return reports;
+}
+
+bool AccuracyVerifier::matches_baseline(const AccuracyReport& report, const AccuracyReport& baseline,
+                                        double tolerance) {
+    const double allowed = std::max(tolerance, 1e-3 * baseline.relative_error);
+    return report.baseline_deviation <= allowed;
+}
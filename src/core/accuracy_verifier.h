@@ -0,0 +1,164 @@
+/**
+ * @file accuracy_verifier.h
+ * @brief Проверка точности интерполянта по эталонным функциям во всех режимах вычисления
+ */
+
+#ifndef ACCURACY_VERIFIER_H
+#define ACCURACY_VERIFIER_H
+
+#include "newton_interpolator.h"
+#include <cstddef>
+#include <string>
+#include <vector>
+
+/**
+ * @brief Допустимое отличие режима от базового по умолчанию, в долях max |f|
+ */
+constexpr double DEFAULT_BASELINE_TOLERANCE = 1e-9;
+
+/**
+ * @brief Эталонная функция, значения которой задают узлы
+ */
+enum class ReferenceFunction {
+    Sine,        ///< sin(x)
+    Exponential, ///< exp(x)
+    Runge,       ///< 1 / (1 + 25 x^2)
+    Polynomial,  ///< x^5 - 2 x^3 + 0.5 x - 1 (интерполируется точно при 6 и более узлах)
+    NoisySine    ///< sin(x), значения в узлах с нормальным шумом
+};
+
+/**
+ * @struct ReferenceProblem
+ * @brief Эталонная задача: функция, отрезок и расстановка узлов
+ */
+struct ReferenceProblem {
+    ReferenceFunction function = ReferenceFunction::Sine; ///< Эталонная функция
+    double start = 0.0;                                    ///< Начало отрезка
+    double end = 1.0;                                      ///< Конец отрезка
+    size_t nodes = 16;                                     ///< Количество узлов
+    bool chebyshev_nodes = false;                          ///< Узлы Чебышева вместо равномерных
+    double noise = 0.0;                                    ///< СКО шума в значениях узлов
+    unsigned seed = 42;                                    ///< Зерно генератора шума
+};
+
+/**
+ * @brief Путь вычисления интерполянта, который проверяется
+ */
+enum class VerificationPath {
+    Points,     ///< interpolate_into по вектору точек (способ и ядро из режима)
+    Grid,       ///< interpolate_grid (шагание по конечным разностям)
+    Chebyshev,  ///< Ряд Чебышева (to_chebyshev)
+    Monomial    ///< Мономиальный базис (to_monomial)
+};
+
+/**
+ * @struct VerificationMode
+ * @brief Режим вычисления: способ представления, ядро и путь
+ */
+struct VerificationMode {
+    std::string name;                                          ///< Название в отчете
+    InterpolationMethod method = InterpolationMethod::Newton;  ///< Способ представления полинома
+    EvaluationKernel kernel = EvaluationKernel::Scalar;        ///< Векторное ядро
+    VerificationPath path = VerificationPath::Points;          ///< Путь вычисления
+};
+
+/**
+ * @struct AccuracyReport
+ * @brief Ошибки одного режима на одной эталонной задаче
+ *
+ * Ошибка считается относительно эталонной функции без шума, отклонение -
+ * относительно базового режима (скалярная схема Горнера) в тех же точках.
+ */
+struct AccuracyReport {
+    std::string problem;              ///< Название эталонной задачи
+    std::string mode;                 ///< Название режима
+    size_t points = 0;                ///< Количество проверочных точек
+    double max_error = 0.0;           ///< Максимальная абсолютная ошибка
+    double rms_error = 0.0;           ///< Среднеквадратичная ошибка
+    double relative_error = 0.0;      ///< max_error, деленная на max |f| на отрезке
+    double baseline_deviation = 0.0;  ///< Максимальное отличие от базового режима, деленное на max |f|
+};
+
+/**
+ * @class AccuracyVerifier
+ * @brief Сравнивает режимы вычисления с эталонными функциями на миллионах точек
+ *
+ * Проверочные точки - середины count равных частей отрезка,
+ * start + (i + 1/2) * (end - start) / count, общие для всех путей (включая
+ * interpolate_grid). Концы отрезка, которые всегда являются узлами, в сетку не
+ * входят, а внутренние узлы совпадают с точками лишь при особом соотношении
+ * count и nodes, так что нулевые ошибки в узлах не занижают СКО. Эталонные
+ * значения и ошибки вычисляются параллельно, максимумы и суммы квадратов
+ * собираются редукциями OpenMP.
+ */
+class AccuracyVerifier {
+public:
+    /**
+     * @brief Значение эталонной функции (без шума)
+     */
+    static double reference_value(ReferenceFunction function, double x);
+
+    /**
+     * @brief Название эталонной функции
+     */
+    static const char* name(ReferenceFunction function);
+
+    /**
+     * @brief Набор стандартных задач: sin, exp, Рунге (узлы Чебышева), полином, sin с шумом
+     */
+    static std::vector<ReferenceProblem> standard_problems();
+
+    /**
+     * @brief Режимы для проверки: все поддерживаемые процессором ядра Горнера,
+     *        сетка, Чебышев, мономы, барицентрическая и кусочная формы
+     *
+     * Первый режим - базовый (скалярное ядро). Пороговой проверке
+     * matches_baseline подлежат только ядра Горнера (форма Ньютона, путь
+     * Points); сетка, Чебышев, мономы, барицентрическая и кусочная формы
+     * вычисляют полином другими формулами и только выводятся в отчет.
+     */
+    static std::vector<VerificationMode> default_modes();
+
+    /**
+     * @brief Строит узлы задачи
+     * @param problem Эталонная задача
+     * @param x Абсциссы узлов
+     * @param y Значения в узлах (с шумом, если он задан)
+     * @throws std::invalid_argument если узлов меньше 2 или отрезок пуст
+     */
+    static void make_nodes(const ReferenceProblem& problem, std::vector<double>& x, std::vector<double>& y);
+
+    /**
+     * @brief Проверяет режимы на задаче
+     * @param problem Эталонная задача
+     * @param modes Режимы; первый служит базой для baseline_deviation
+     * @param count Количество проверочных точек (не менее 2)
+     * @return Отчет на каждый режим в порядке modes
+     * @throws std::invalid_argument если режимов нет, count < 2 или задача некорректна
+     */
+    static std::vector<AccuracyReport> verify(const ReferenceProblem& problem,
+                                              const std::vector<VerificationMode>& modes,
+                                              size_t count);
+
+    /**
+     * @brief Проверяет, что режим не ухудшает точность базового
+     *
+     * Отличие от базы допускается до tolerance или до 0.1% относительной
+     * ошибки базового режима: на плохо обусловленных задачах (много узлов в
+     * форме Ньютона) ядра с FMA законно расходятся со скалярным на величину,
+     * усиленную обусловленностью, но несравнимо меньшую ошибки интерполяции.
+     *
+     * Предназначено для ядер Горнера (форма Ньютона, путь Points), которые
+     * выполняют ту же схему, что и база. Для остальных режимов отличие от базы
+     * определяется обусловленностью другого представления, и их отчеты
+     * служат только для сведения.
+     *
+     * @param report Отчет проверяемого режима
+     * @param baseline Отчет базового режима на той же задаче
+     * @param tolerance Абсолютный порог в долях max |f|
+     */
+    static bool matches_baseline(const AccuracyReport& report, const AccuracyReport& baseline,
+                                 double tolerance = DEFAULT_BASELINE_TOLERANCE);
+};
+
+#endif // ACCURACY_VERIFIER_H
@@ -0,0 +1,60 @@
+/**
+ * @file aligned_buffer.h
+ * @brief Аллокатор с выравниванием и непрерывный буфер на его основе
+ */
+
+#ifndef ALIGNED_BUFFER_H
+#define ALIGNED_BUFFER_H
+
+#include <cstddef>
+#include <new>
+#include <vector>
+
+/**
+ * @brief Выравнивание буферов по умолчанию (размер кэш-линии, достаточно для AVX-512)
+ */
+constexpr std::size_t DEFAULT_BUFFER_ALIGNMENT = 64;
+
+/**
+ * @class AlignedAllocator
+ * @brief Аллокатор, выделяющий память с заданным выравниванием
+ * @tparam T Тип элементов
+ * @tparam Alignment Выравнивание в байтах (степень двойки)
+ */
+template <typename T, std::size_t Alignment = DEFAULT_BUFFER_ALIGNMENT>
+class AlignedAllocator {
+public:
+    using value_type = T;
+
+    template <typename U>
+    struct rebind {
+        using other = AlignedAllocator<U, Alignment>;
+    };
+
+    AlignedAllocator() noexcept {}
+
+    template <typename U>
+    AlignedAllocator(const AlignedAllocator<U, Alignment>&) noexcept {}
+
+    T* allocate(std::size_t n) {
+        return static_cast<T*>(::operator new(n * sizeof(T), std::align_val_t(Alignment)));
+    }
+
+    void deallocate(T* p, std::size_t) noexcept {
+        ::operator delete(p, std::align_val_t(Alignment));
+    }
+
+    template <typename U>
+    bool operator==(const AlignedAllocator<U, Alignment>&) const noexcept { return true; }
+
+    template <typename U>
+    bool operator!=(const AlignedAllocator<U, Alignment>&) const noexcept { return false; }
+};
+
+/**
+ * @brief Непрерывный выровненный вектор
+ */
+template <typename T>
+using AlignedVector = std::vector<T, AlignedAllocator<T>>;
+
+#endif // ALIGNED_BUFFER_H
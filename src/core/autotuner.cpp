@@ -0,0 +1,231 @@
+#include "autotuner.h"
+#include "batch_evaluator.h"
+#include "aligned_buffer.h"
+#include <omp.h>
+#include <algorithm>
+#include <chrono>
+#include <fstream>
+#include <sstream>
+#include <stdexcept>
+
+/**
+ * @brief Заголовок файла профиля
+ */
+static const char* PROFILE_HEADER = "# newton-autotune 1";
+
+/**
+ * @brief Порции (в блоках точек), проверяемые для параллельных конфигураций
+ */
+static const size_t CANDIDATE_CHUNKS[] = {1, 4, 16};
+
+Autotuner::Autotuner(size_t repetitions) : repetitions(std::max<size_t>(repetitions, 1)) {}
+
+double Autotuner::measure_ms(const TuningConfig& config, size_t node_count, size_t batch_size) const {
+    // Значения не влияют на время, но |t - x_i| <= 1 и убывающие коэффициенты
+    // исключают переполнение и денормализованные числа
+    AlignedVector<double> x(node_count);
+    AlignedVector<double> c(node_count);
+    for (size_t i = 0; i < node_count; i++) {
+        x[i] = static_cast<double>(i) / (node_count - 1);
+        c[i] = 1.0 / (i + 1);
+    }
+    AlignedVector<double> points(batch_size);
+    AlignedVector<double> results(batch_size);
+    for (size_t i = 0; i < batch_size; i++) {
+        points[i] = static_cast<double>(i) / batch_size;
+    }
+
+    BatchEvaluator evaluator;
+    std::vector<double> samples;
+    for (size_t r = 0; r <= repetitions; r++) {
+        std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+        evaluator.evaluate(config.kernel, x.data(), c.data(), node_count,
+                           points.data(), results.data(), batch_size, config.schedule);
+        std::chrono::duration<double, std::milli> elapsed = std::chrono::steady_clock::now() - start;
+        if (r > 0) {
+            samples.push_back(elapsed.count());  // первый прогон - прогрев
+        }
+    }
+    std::nth_element(samples.begin(), samples.begin() + samples.size() / 2, samples.end());
+    return samples[samples.size() / 2];
+}
+
+void Autotuner::tune(size_t node_count, const std::vector<size_t>& batch_sizes) {
+    if (node_count < 2) {
+        throw std::invalid_argument("Необходимо как минимум 2 узла для автонастройки");
+    }
+    std::vector<size_t> sizes(batch_sizes);
+    std::sort(sizes.begin(), sizes.end());
+    sizes.erase(std::unique(sizes.begin(), sizes.end()), sizes.end());
+    sizes.erase(std::remove(sizes.begin(), sizes.end(), size_t(0)), sizes.end());
+    if (sizes.size() < 2) {
+        throw std::invalid_argument("Необходимо как минимум 2 различных размера пакета");
+    }
+
+    // Ядро не зависит от распределения: выбираем его последовательным прогоном
+    TuningConfig serial;
+    serial.schedule.thread_count = 1;
+    double best_kernel_ms = 0.0;
+    const EvaluationKernel kernels[] = {EvaluationKernel::Scalar, EvaluationKernel::SSE2,
+                                        EvaluationKernel::AVX2, EvaluationKernel::AVX512};
+    for (EvaluationKernel kernel : kernels) {
+        if (!EvaluationKernels::is_supported(kernel)) {
+            continue;
+        }
+        TuningConfig candidate = serial;
+        candidate.kernel = kernel;
+        double ms = measure_ms(candidate, node_count, sizes.back());
+        if (serial.kernel == EvaluationKernel::Auto || ms < best_kernel_ms) {
+            serial.kernel = kernel;
+            best_kernel_ms = ms;
+        }
+    }
+
+    std::vector<size_t> thread_counts;
+    const size_t max_threads = static_cast<size_t>(omp_get_max_threads());
+    for (size_t threads = 2; threads < max_threads; threads *= 2) {
+        thread_counts.push_back(threads);
+    }
+    if (max_threads > 1) {
+        thread_counts.push_back(max_threads);
+    }
+
+    std::vector<TuningConfig> candidates = {serial};
+    for (size_t threads : thread_counts) {
+        for (size_t chunk : CANDIDATE_CHUNKS) {
+            TuningConfig candidate = serial;
+            candidate.schedule.policy = SchedulePolicy::Dynamic;
+            candidate.schedule.chunk_size = chunk;
+            candidate.schedule.thread_count = threads;
+            candidates.push_back(candidate);
+        }
+    }
+
+    std::vector<TuningModel> fitted;
+    for (const TuningConfig& candidate : candidates) {
+        // Наименьшие квадраты для t = a + b * w, w = n * m
+        double sum_w = 0.0, sum_t = 0.0, sum_ww = 0.0, sum_wt = 0.0;
+        for (size_t batch : sizes) {
+            const double w = static_cast<double>(node_count) * static_cast<double>(batch);
+            const double t = measure_ms(candidate, node_count, batch);
+            sum_w += w;
+            sum_t += t;
+            sum_ww += w * w;
+            sum_wt += w * t;
+        }
+        const double k = static_cast<double>(sizes.size());
+        const double slope = (k * sum_wt - sum_w * sum_t) / (k * sum_ww - sum_w * sum_w);
+        TuningModel model;
+        model.config = candidate;
+        model.per_work_ns = std::max(0.0, slope) * 1e6;
+        model.fixed_ms = std::max(0.0, (sum_t - slope * sum_w) / k);
+        fitted.push_back(model);
+    }
+    models.swap(fitted);
+}
+
+TuningConfig Autotuner::choose(size_t node_count, size_t batch_size) const noexcept {
+    const TuningModel* best = nullptr;
+    double best_ms = 0.0;
+    for (const TuningModel& model : models) {
+        const double ms = model.predict_ms(node_count, batch_size);
+        if (best == nullptr || ms < best_ms) {
+            best = &model;
+            best_ms = ms;
+        }
+    }
+    return best ? best->config : TuningConfig();
+}
+
+size_t Autotuner::get_parallel_cutoff(size_t node_count) const {
+    for (size_t batch = 1; batch <= (size_t(1) << 24); batch *= 2) {
+        if (choose(node_count, batch).schedule.thread_count != 1) {
+            return batch;
+        }
+    }
+    return 0;
+}
+
+void Autotuner::save(const std::string& path) const {
+    std::ofstream file(path);
+    if (!file) {
+        throw std::runtime_error("Не удалось открыть файл профиля для записи: " + path);
+    }
+    file << PROFILE_HEADER << "\n";
+    file << "# kernel policy chunk threads fixed_ms per_work_ns\n";
+    file.precision(9);
+    for (const TuningModel& model : models) {
+        file << EvaluationKernels::name(model.config.kernel) << " "
+             << ParallelScheduler::name(model.config.schedule.policy) << " "
+             << model.config.schedule.chunk_size << " "
+             << model.config.schedule.thread_count << " "
+             << model.fixed_ms << " " << model.per_work_ns << "\n";
+    }
+    if (!file) {
+        throw std::runtime_error("Ошибка записи файла профиля: " + path);
+    }
+}
+
+void Autotuner::load(const std::string& path) {
+    std::ifstream file(path);
+    if (!file) {
+        throw std::runtime_error("Не удалось открыть файл профиля: " + path);
+    }
+    std::string line;
+    if (!std::getline(file, line) || line.rfind(PROFILE_HEADER, 0) != 0) {
+        throw std::runtime_error("Неизвестный формат файла профиля: " + path);
+    }
+
+    const EvaluationKernel kernels[] = {EvaluationKernel::Auto, EvaluationKernel::Scalar, EvaluationKernel::SSE2,
+                                        EvaluationKernel::AVX2, EvaluationKernel::AVX512};
+    const SchedulePolicy policies[] = {SchedulePolicy::Static, SchedulePolicy::Dynamic,
+                                       SchedulePolicy::Guided, SchedulePolicy::WorkStealing};
+    std::vector<TuningModel> loaded;
+    while (std::getline(file, line)) {
+        if (line.empty() || line[0] == '#') {
+            continue;
+        }
+        std::istringstream fields(line);
+        std::string kernel_name, policy_name;
+        TuningModel model;
+        if (!(fields >> kernel_name >> policy_name >> model.config.schedule.chunk_size
+                     >> model.config.schedule.thread_count >> model.fixed_ms >> model.per_work_ns)) {
+            throw std::runtime_error("Поврежденная строка файла профиля: " + line);
+        }
+
+        bool kernel_known = false;
+        for (EvaluationKernel kernel : kernels) {
+            if (kernel_name == EvaluationKernels::name(kernel)) {
+                model.config.kernel = kernel;
+                kernel_known = true;
+            }
+        }
+        bool policy_known = false;
+        for (SchedulePolicy policy : policies) {
+            if (policy_name == ParallelScheduler::name(policy)) {
+                model.config.schedule.policy = policy;
+                policy_known = true;
+            }
+        }
+        if (!kernel_known || !policy_known) {
+            throw std::runtime_error("Неизвестное ядро или политика в файле профиля: " + line);
+        }
+        // Ядро разрешается здесь, чтобы choose() отдавал только конкретные поддерживаемые ядра
+        if (!EvaluationKernels::try_resolve(model.config.kernel, model.config.kernel)) {
+            continue;
+        }
+        if (model.config.schedule.policy == SchedulePolicy::WorkStealing && model.config.schedule.pool == nullptr) {
+            WorkStealingPool::shared();  // создается здесь, а не в безысключительном пути вычисления
+        }
+        loaded.push_back(model);
+    }
+    models.swap(loaded);
+}
+
+bool Autotuner::is_tuned() const {
+    return !models.empty();
+}
+
+const std::vector<TuningModel>& Autotuner::get_models() const {
+    return models;
+}
@@ -0,0 +1,125 @@
+/**
+ * @file autotuner.h
+ * @brief Подбор конфигурации пакетного вычисления по измерениям и модели стоимости
+ */
+
+#ifndef AUTOTUNER_H
+#define AUTOTUNER_H
+
+#include "evaluation_kernels.h"
+#include "parallel_scheduler.h"
+#include <string>
+#include <vector>
+#include <cstddef>
+
+/**
+ * @struct TuningConfig
+ * @brief Конфигурация пакетного вычисления: ядро и распределение блоков
+ */
+struct TuningConfig {
+    EvaluationKernel kernel = EvaluationKernel::Auto; ///< Ядро вычисления
+    ParallelSchedule schedule;                        ///< Политика, порция и число потоков
+};
+
+/**
+ * @struct TuningModel
+ * @brief Линейная модель стоимости одной конфигурации
+ *
+ * Время вызова t = fixed_ms + per_work_ns * 1e-6 * n * m, где n - число
+ * узлов, m - число точек. fixed_ms отражает запуск команды потоков и
+ * распределение блоков, per_work_ns - стоимость одного шага схемы Горнера.
+ */
+struct TuningModel {
+    TuningConfig config;       ///< Конфигурация
+    double fixed_ms = 0.0;     ///< Постоянные накладные расходы вызова, мс
+    double per_work_ns = 0.0;  ///< Время на пару (узел, точка), нс
+
+    /**
+     * @brief Предсказанное время вызова, мс
+     */
+    double predict_ms(size_t node_count, size_t batch_size) const {
+        return fixed_ms + per_work_ns * 1e-6 * static_cast<double>(node_count) * static_cast<double>(batch_size);
+    }
+};
+
+/**
+ * @class Autotuner
+ * @brief Измеряет конфигурации, строит модели стоимости и выбирает самую быструю
+ *
+ * tune() сначала выбирает ядро по последовательному прогону, затем
+ * измеряет с ним последовательный вариант и варианты с 2, 4, ... потоками
+ * и разными порциями на нескольких размерах пакета. Для каждой конфигурации
+ * методом наименьших квадратов подбирается TuningModel. Профиль сохраняется
+ * в текстовый файл и загружается при следующих запусках без повторных
+ * измерений; choose() выбирает конфигурацию с наименьшим предсказанным
+ * временем, так что последовательный режим выигрывает на малых пакетах.
+ */
+class Autotuner {
+private:
+    std::vector<TuningModel> models;  ///< Модели измеренных конфигураций
+    size_t repetitions;               ///< Повторов на одно измерение (берется медиана)
+
+    /**
+     * @brief Медианное время вычисления пакета в конфигурации, мс
+     */
+    double measure_ms(const TuningConfig& config, size_t node_count, size_t batch_size) const;
+
+public:
+    /**
+     * @brief Конструктор
+     * @param repetitions Повторов на одно измерение (не менее 1)
+     */
+    explicit Autotuner(size_t repetitions = 5);
+
+    /**
+     * @brief Измеряет конфигурации для таблицы заданного размера
+     * @param node_count Количество узлов
+     * @param batch_sizes Размеры пакетов (не менее двух различных для подбора модели)
+     * @throws std::invalid_argument если node_count < 2 или размеров меньше двух
+     */
+    void tune(size_t node_count, const std::vector<size_t>& batch_sizes = {256, 4096, 65536});
+
+    /**
+     * @brief Выбирает конфигурацию с наименьшим предсказанным временем
+     * @param node_count Количество узлов
+     * @param batch_size Количество точек
+     * @return Лучшая конфигурация (по умолчанию, если профиль пуст)
+     */
+    TuningConfig choose(size_t node_count, size_t batch_size) const noexcept;
+
+    /**
+     * @brief Наименьший размер пакета, для которого выбирается параллельная конфигурация
+     * @param node_count Количество узлов
+     * @return Размер пакета (0, если параллельный режим не выигрывает до 2^24 точек)
+     */
+    size_t get_parallel_cutoff(size_t node_count) const;
+
+    /**
+     * @brief Сохраняет профиль в файл
+     * @param path Путь к файлу
+     * @throws std::runtime_error если файл не удалось записать
+     */
+    void save(const std::string& path) const;
+
+    /**
+     * @brief Загружает профиль из файла
+     * @param path Путь к файлу
+     * @throws std::runtime_error если файл не найден или поврежден
+     *
+     * Конфигурации с ядрами, которые текущий процессор не поддерживает,
+     * пропускаются, ядро Auto заменяется лучшим ядром процессора.
+     */
+    void load(const std::string& path);
+
+    /**
+     * @brief Проверяет, есть ли в профиле хотя бы одна модель
+     */
+    bool is_tuned() const;
+
+    /**
+     * @brief Возвращает модели профиля
+     */
+    const std::vector<TuningModel>& get_models() const;
+};
+
+#endif // AUTOTUNER_H
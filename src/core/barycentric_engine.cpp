@@ -0,0 +1,187 @@
+#include "barycentric_engine.h"
+#include <omp.h>
+#include <stdexcept>
+#include <cmath>
+#include <algorithm>
+#include <limits>
+
+/**
+ * @brief Количество узлов, начиная с которого веса вычисляются параллельно
+ */
+static const size_t PARALLEL_WEIGHTS_THRESHOLD = 256;
+
+BarycentricEngine::BarycentricEngine() : scale(1.0) {}
+
+double BarycentricEngine::compute_weight(size_t j) const {
+    const size_t n = x_nodes.size();
+    const double xj = x_nodes[j];
+    double product = 1.0;
+    #pragma omp simd reduction(*:product)
+    for (size_t k = 0; k < n; k++) {
+        // Вместо ветвления k != j сомножитель j заменяется единицей
+        double factor = scale * (xj - x_nodes[k]);
+        product *= (k == j) ? 1.0 : factor;
+    }
+    return 1.0 / product;
+}
+
+void BarycentricEngine::compute(const double* x, const double* y, size_t n) {
+    double x_min = 0.0;
+    double x_max = 0.0;
+    if (n > 0) {
+        x_min = *std::min_element(x, x + n);
+        x_max = *std::max_element(x, x + n);
+    }
+    for (size_t i = 1; i < n; i++) {
+        if (std::abs(x[i] - x[i-1]) < 1e-10) {
+            throw std::runtime_error("Деление на ноль при вычислении барицентрических весов");
+        }
+    }
+
+    x_nodes.assign(x, x + n);
+    y_nodes.assign(y, y + n);
+    scale = (x_max > x_min) ? 4.0 / (x_max - x_min) : 1.0;
+    compute_weights();
+}
+
+void BarycentricEngine::compute_weights() {
+    const size_t n = x_nodes.size();
+    weights.resize(n);
+    weighted_y.resize(n);
+
+    const long count = static_cast<long>(n);
+    #pragma omp parallel for schedule(static) if (n >= PARALLEL_WEIGHTS_THRESHOLD)
+    for (long j = 0; j < count; j++) {
+        weights[j] = compute_weight(j);
+        weighted_y[j] = weights[j] * y_nodes[j];
+    }
+}
+
+void BarycentricEngine::rescale_if_needed() {
+    if (x_nodes.size() < 2) {
+        return;
+    }
+    // Отклонение C от 4 / размах в r раз меняет веса в r^(n-1) раз: допуск
+    // выбирается так, чтобы множитель не превышал 2^256, и не шире 2
+    const size_t n = x_nodes.size();
+    auto range = std::minmax_element(x_nodes.begin(), x_nodes.end());
+    const double span = *range.second - *range.first;
+    const double deviation = scale * span / 4.0;
+    const double allowed = std::min(2.0, std::exp2(256.0 / static_cast<double>(n - 1)));
+    if (deviation > allowed || deviation * allowed < 1.0) {
+        // Все веса умножаются на один множитель deviation^(n-1), который
+        // сокращается в дроби; ldexp применяет его без переполнения
+        const double exponent = static_cast<double>(n - 1) * std::log2(deviation);
+        const double whole = std::floor(exponent);
+        const double fraction = std::exp2(exponent - whole);
+        for (size_t j = 0; j < n; j++) {
+            weights[j] = std::ldexp(weights[j] * fraction, static_cast<int>(whole));
+            weighted_y[j] = weights[j] * y_nodes[j];
+        }
+        scale = 4.0 / span;
+    }
+}
+
+void BarycentricEngine::append(double x_new, double y_new) {
+    const size_t n = x_nodes.size();
+    for (size_t j = 0; j < n; j++) {
+        if (std::abs(x_new - x_nodes[j]) < 1e-10) {
+            throw std::runtime_error("Деление на ноль при вычислении барицентрических весов");
+        }
+    }
+
+    // Масштаб сохраняется, пока размах не изменится заметно (см. rescale_if_needed)
+    double product = 1.0;
+    for (size_t j = 0; j < n; j++) {
+        double factor = scale * (x_nodes[j] - x_new);
+        weights[j] /= factor;
+        weighted_y[j] = weights[j] * y_nodes[j];
+        product *= -factor;
+    }
+    x_nodes.push_back(x_new);
+    y_nodes.push_back(y_new);
+    weights.push_back(1.0 / product);
+    weighted_y.push_back(weights.back() * y_new);
+    rescale_if_needed();
+}
+
+void BarycentricEngine::drop_front() {
+    if (x_nodes.empty()) {
+        throw std::logic_error("Нет узлов для удаления");
+    }
+    const double x_old = x_nodes[0];
+    const size_t n = x_nodes.size();
+    for (size_t j = 1; j < n; j++) {
+        weights[j] *= scale * (x_nodes[j] - x_old);
+        weighted_y[j] = weights[j] * y_nodes[j];
+    }
+    x_nodes.erase(x_nodes.begin());
+    y_nodes.erase(y_nodes.begin());
+    weights.erase(weights.begin());
+    weighted_y.erase(weighted_y.begin());
+    rescale_if_needed();
+}
+
+void BarycentricEngine::clear() {
+    x_nodes.clear();
+    y_nodes.clear();
+    weights.clear();
+    weighted_y.clear();
+    scale = 1.0;
+}
+
+double BarycentricEngine::evaluate(double point) const {
+    const size_t n = x_nodes.size();
+    if (n == 0) {
+        return std::numeric_limits<double>::quiet_NaN();
+    }
+    const double* x = x_nodes.data();
+    const double* w = weights.data();
+    const double* wy = weighted_y.data();
+    double numerator = 0.0;
+    double denominator = 0.0;
+
+    #pragma omp simd reduction(+:numerator, denominator)
+    for (size_t j = 0; j < n; j++) {
+        double r = 1.0 / (point - x[j]);
+        numerator += wy[j] * r;
+        denominator += w[j] * r;
+    }
+
+    // Во внутреннем цикле нет ветвлений: при попадании в узел слагаемые
+    // бесконечны, и такой случай разбирается уже после цикла. NaN и
+    // бесконечность по другим причинам (например, NaN в точке) не маскируются
+    double result = numerator / denominator;
+    if (!std::isfinite(result)) {
+        for (size_t j = 0; j < n; j++) {
+            const double difference = point - x[j];
+            if (difference == 0.0 || std::isinf(1.0 / difference)) {
+                return y_nodes[j];
+            }
+        }
+    }
+    return result;
+}
+
+void BarycentricEngine::evaluate(const double* points, double* results, size_t count) const {
+    const long num_points = static_cast<long>(count);
+
+    #pragma omp parallel for schedule(static)
+    for (long i = 0; i < num_points; i++) {
+        results[i] = evaluate(points[i]);
+    }
+}
+
+void BarycentricEngine::evaluate_block(const double* points, double* results, size_t count) const {
+    for (size_t i = 0; i < count; i++) {
+        results[i] = evaluate(points[i]);
+    }
+}
+
+const AlignedVector<double>& BarycentricEngine::get_weights() const {
+    return weights;
+}
+
+size_t BarycentricEngine::size() const {
+    return x_nodes.size();
+}
@@ -0,0 +1,122 @@
+/**
+ * @file barycentric_engine.h
+ * @brief Барицентрическая (вторая) форма интерполяционного полинома
+ */
+
+#ifndef BARYCENTRIC_ENGINE_H
+#define BARYCENTRIC_ENGINE_H
+
+#include "aligned_buffer.h"
+#include <cstddef>
+
+/**
+ * @class BarycentricEngine
+ * @brief Вычисляет интерполяционный полином в барицентрической форме
+ *
+ * p(t) = sum(w_j y_j / (t - x_j)) / sum(w_j / (t - x_j)),
+ * w_j = 1 / prod_{k != j} C (x_j - x_k).
+ *
+ * Веса вычисляются один раз за O(n^2) (параллельно по j), каждая точка
+ * вычисляется за O(n) без ветвлений во внутреннем цикле. Общий множитель
+ * C = 4 / (x_max - x_min) сокращается в дроби и удерживает веса в пределах
+ * диапазона double. Форма устойчива при высоких степенях, в отличие от
+ * схемы Горнера для полинома Ньютона.
+ */
+class BarycentricEngine {
+private:
+    AlignedVector<double> x_nodes;    ///< Узлы
+    AlignedVector<double> weights;    ///< Барицентрические веса w_j
+    AlignedVector<double> weighted_y; ///< Произведения w_j * y_j
+    AlignedVector<double> y_nodes;    ///< Значения в узлах (для точного попадания в узел)
+    double scale;                     ///< Множитель C
+
+    /**
+     * @brief Вычисляет вес узла j по текущим узлам
+     */
+    double compute_weight(size_t j) const;
+
+    /**
+     * @brief Пересчитывает все веса по текущим узлам и множителю C
+     */
+    void compute_weights();
+
+    /**
+     * @brief Обновляет множитель C, если размах узлов заметно отошел от 4 / C
+     *
+     * Веса однородны по C степени -(n - 1), поэтому при устаревшем множителе
+     * они переполняются или исчезают уже через несколько сотен узлов.
+     * Допуск отклонения r выбирается из r^(n-1) <= 2^256 (и не шире 2). Смена
+     * C умножает все веса на общий множитель, поэтому занимает O(n) и не
+     * меняет значения полинома.
+     */
+    void rescale_if_needed();
+
+public:
+    /**
+     * @brief Конструктор по умолчанию
+     */
+    BarycentricEngine();
+
+    /**
+     * @brief Вычисляет веса по узлам
+     * @param x Указатель на значения x (попарно различные)
+     * @param y Указатель на значения y
+     * @param n Количество узлов
+     */
+    void compute(const double* x, const double* y, size_t n);
+
+    /**
+     * @brief Добавляет узел в конец за O(n)
+     * @param x_new Значение x нового узла
+     * @param y_new Значение y нового узла
+     *
+     * При значительном изменении размаха узлов веса пересчитываются с новым
+     * множителем C (см. rescale_if_needed).
+     */
+    void append(double x_new, double y_new);
+
+    /**
+     * @brief Удаляет первый узел за O(n)
+     */
+    void drop_front();
+
+    /**
+     * @brief Очищает все буферы
+     */
+    void clear();
+
+    /**
+     * @brief Вычисляет полином в точке
+     * @param point Точка
+     * @return Значение полинома; в узле - исходное значение y, для NaN в точке - NaN
+     */
+    double evaluate(double point) const;
+
+    /**
+     * @brief Вычисляет полином в наборе точек с использованием OpenMP
+     * @param points Точки
+     * @param results Массив результатов (count элементов)
+     * @param count Количество точек
+     */
+    void evaluate(const double* points, double* results, size_t count) const;
+
+    /**
+     * @brief Последовательно вычисляет полином в наборе точек (без параллельной области)
+     * @param points Точки
+     * @param results Массив результатов (count элементов)
+     * @param count Количество точек
+     */
+    void evaluate_block(const double* points, double* results, size_t count) const;
+
+    /**
+     * @brief Возвращает барицентрические веса
+     */
+    const AlignedVector<double>& get_weights() const;
+
+    /**
+     * @brief Возвращает количество узлов
+     */
+    size_t size() const;
+};
+
+#endif // BARYCENTRIC_ENGINE_H
@@ -0,0 +1,128 @@
+#include "basic_newton_interpolator.h"
+#include "divided_difference_engine.h"
+#include "evaluation_kernels.h"
+#include <omp.h>
+#include <stdexcept>
+#include <algorithm>
+#include <limits>
+
+/**
+ * @brief Количество точек, вычисляемых одновременно по схеме Горнера
+ */
+static const size_t POINT_BLOCK_SIZE = 64;
+
+/**
+ * @brief Продолжает схему Горнера по узлам [0, end) подходящим ядром
+ *
+ * Для double используются ядра с выбором набора инструкций, для остальных
+ * типов - переносимое ядро, векторизуемое компилятором.
+ */
+template <typename Storage, typename Accumulator>
+static void continue_horner(const Storage* x, const Storage* c, size_t end,
+                            const Accumulator* points, Accumulator* state, size_t count) {
+    if constexpr (std::is_same<Storage, double>::value && std::is_same<Accumulator, double>::value) {
+        EvaluationKernels::horner_range(EvaluationKernel::Auto, x, c, 0, end, points, state, count);
+    } else {
+        EvaluationKernels::horner_lanes(x, c, 0, end, points, state, count);
+    }
+}
+
+template <typename Storage, typename Accumulator>
+BasicNewtonInterpolator<Storage, Accumulator>::BasicNewtonInterpolator() {}
+
+template <typename Storage, typename Accumulator>
+BasicNewtonInterpolator<Storage, Accumulator>::BasicNewtonInterpolator(const std::vector<Accumulator>& x,
+                                                                       const std::vector<Accumulator>& y) {
+    set_data(x, y);
+}
+
+template <typename Storage, typename Accumulator>
+void BasicNewtonInterpolator<Storage, Accumulator>::set_data(const std::vector<Accumulator>& x,
+                                                             const std::vector<Accumulator>& y) {
+    if (x.size() != y.size()) {
+        throw std::invalid_argument("Размеры векторов x и y должны совпадать");
+    }
+    if (x.size() < 2) {
+        throw std::invalid_argument("Необходимо как минимум 2 точки для интерполяции");
+    }
+
+    const size_t n = x.size();
+    std::vector<size_t> indices(n);
+    for (size_t i = 0; i < n; i++) {
+        indices[i] = i;
+    }
+    std::sort(indices.begin(), indices.end(), [&](size_t i, size_t j) {
+        return x[i] < x[j];
+    });
+
+    // Разности строятся по уже округленным узлам, чтобы полином проходил
+    // именно через хранимые точки
+    AlignedVector<Storage> nodes(n);
+    std::vector<Accumulator> work(n);
+    for (size_t i = 0; i < n; i++) {
+        nodes[i] = static_cast<Storage>(x[indices[i]]);
+        work[i] = y[indices[i]];
+    }
+    std::vector<Accumulator> differences(n);
+    DividedDifferenceEngine::compute_coefficients(nodes.data(), work.data(), differences.data(), n);
+
+    x_values.swap(nodes);
+    coefficients.assign(differences.begin(), differences.end());
+}
+
+template <typename Storage, typename Accumulator>
+Accumulator BasicNewtonInterpolator<Storage, Accumulator>::interpolate(Accumulator point) const {
+    if (x_values.empty()) {
+        throw std::runtime_error("Данные не инициализированы");
+    }
+    return evaluate_newton(point);
+}
+
+template <typename Storage, typename Accumulator>
+Accumulator BasicNewtonInterpolator<Storage, Accumulator>::evaluate_newton(Accumulator point) const {
+    const size_t n = x_values.size();
+    Accumulator result = coefficients[n - 1];
+    continue_horner(x_values.data(), coefficients.data(), n - 1, &point, &result, 1);
+    return result;
+}
+
+template <typename Storage, typename Accumulator>
+std::vector<Accumulator> BasicNewtonInterpolator<Storage, Accumulator>::interpolate_multiple(
+        const std::vector<Accumulator>& points) const {
+    std::vector<Accumulator> results(points.size());
+    if (x_values.empty()) {
+        std::fill(results.begin(), results.end(), std::numeric_limits<Accumulator>::quiet_NaN());
+        return results;
+    }
+
+    const size_t n = x_values.size();
+    const long num_blocks = static_cast<long>((points.size() + POINT_BLOCK_SIZE - 1) / POINT_BLOCK_SIZE);
+
+    #pragma omp parallel for schedule(static)
+    for (long b = 0; b < num_blocks; b++) {
+        const size_t first = static_cast<size_t>(b) * POINT_BLOCK_SIZE;
+        const size_t width = std::min(POINT_BLOCK_SIZE, points.size() - first);
+        const Accumulator* block_points = points.data() + first;
+        Accumulator* state = results.data() + first;
+
+        std::fill(state, state + width, static_cast<Accumulator>(coefficients[n - 1]));
+        continue_horner(x_values.data(), coefficients.data(), n - 1, block_points, state, width);
+    }
+
+    return results;
+}
+
+template <typename Storage, typename Accumulator>
+const AlignedVector<Storage>& BasicNewtonInterpolator<Storage, Accumulator>::get_coefficients() const {
+    return coefficients;
+}
+
+template <typename Storage, typename Accumulator>
+size_t BasicNewtonInterpolator<Storage, Accumulator>::get_node_count() const {
+    return x_values.size();
+}
+
+template class BasicNewtonInterpolator<float>;
+template class BasicNewtonInterpolator<double>;
+template class BasicNewtonInterpolator<long double>;
+template class BasicNewtonInterpolator<float, double>;
@@ -0,0 +1,109 @@
+/**
+ * @file basic_newton_interpolator.h
+ * @brief Полином Ньютона с выбираемыми типами хранения и накопления
+ */
+
+#ifndef BASIC_NEWTON_INTERPOLATOR_H
+#define BASIC_NEWTON_INTERPOLATOR_H
+
+#include "aligned_buffer.h"
+#include <vector>
+#include <cstddef>
+#include <type_traits>
+
+/**
+ * @class BasicNewtonInterpolator
+ * @brief Интерполяция методом Ньютона в заданной точности
+ * @tparam Storage Тип хранения узлов и коэффициентов
+ * @tparam Accumulator Тип входных данных, разделенных разностей и схемы Горнера
+ *
+ * Разделенные разности строятся в типе Accumulator тем же проходом, что и в
+ * DividedDifferenceEngine (DividedDifferenceEngine::compute_coefficients), и
+ * округляются до Storage. Схема Горнера - EvaluationKernels::horner_lanes, а
+ * для <double, double> - ядра с выбором набора инструкций.
+ * float вдвое увеличивает число точек в SIMD-регистре для таблиц малой
+ * степени, long double дает запас точности для высоких степеней, а пара
+ * <float, double> хранит таблицу в float и накапливает результат в double.
+ * Инстанцирования для этих вариантов собраны в basic_newton_interpolator.cpp.
+ *
+ * NewtonInterpolator наследует BasicNewtonInterpolator<double>: узлы,
+ * коэффициенты и вычисление в точке общие, а барицентрический и кусочный
+ * режимы, скользящее окно и пакетные ядра добавляются поверх. Его set_data
+ * и interpolate скрывают одноименные методы этого класса.
+ */
+template <typename Storage, typename Accumulator = Storage>
+class BasicNewtonInterpolator {
+    static_assert(std::is_floating_point<Storage>::value && std::is_floating_point<Accumulator>::value,
+                  "Типы хранения и накопления должны быть вещественными");
+    static_assert(sizeof(Accumulator) >= sizeof(Storage),
+                  "Тип накопления не может быть уже типа хранения");
+
+public:
+    using storage_type = Storage;          ///< Тип хранения таблицы
+    using accumulator_type = Accumulator;  ///< Тип вычислений и результатов
+
+protected:
+    AlignedVector<Storage> x_values;      ///< Узлы полинома
+    AlignedVector<Storage> coefficients;  ///< Коэффициенты полинома Ньютона
+
+    /**
+     * @brief Вычисляет полином Ньютона в точке по схеме Горнера
+     * @param point Точка (узлы должны быть заданы)
+     */
+    Accumulator evaluate_newton(Accumulator point) const;
+
+public:
+    /**
+     * @brief Конструктор по умолчанию
+     */
+    BasicNewtonInterpolator();
+
+    /**
+     * @brief Конструктор с инициализацией данными
+     * @param x Вектор значений x
+     * @param y Вектор значений y
+     */
+    BasicNewtonInterpolator(const std::vector<Accumulator>& x, const std::vector<Accumulator>& y);
+
+    /**
+     * @brief Устанавливает данные для интерполяции
+     * @param x Вектор значений x
+     * @param y Вектор значений y
+     */
+    void set_data(const std::vector<Accumulator>& x, const std::vector<Accumulator>& y);
+
+    /**
+     * @brief Выполняет интерполяцию в точке
+     * @param point Точка для интерполяции
+     * @return Интерполированное значение
+     */
+    Accumulator interpolate(Accumulator point) const;
+
+    /**
+     * @brief Выполняет интерполяцию для множества точек с использованием OpenMP
+     * @param points Вектор точек для интерполяции
+     * @return Вектор интерполированных значений
+     */
+    std::vector<Accumulator> interpolate_multiple(const std::vector<Accumulator>& points) const;
+
+    /**
+     * @brief Возвращает коэффициенты полинома Ньютона в типе хранения
+     */
+    const AlignedVector<Storage>& get_coefficients() const;
+
+    /**
+     * @brief Возвращает количество узлов
+     */
+    size_t get_node_count() const;
+};
+
+extern template class BasicNewtonInterpolator<float>;
+extern template class BasicNewtonInterpolator<double>;
+extern template class BasicNewtonInterpolator<long double>;
+extern template class BasicNewtonInterpolator<float, double>;
+
+using NewtonInterpolatorF = BasicNewtonInterpolator<float>;                ///< Одинарная точность
+using NewtonInterpolatorLD = BasicNewtonInterpolator<long double>;         ///< Расширенная точность
+using MixedNewtonInterpolator = BasicNewtonInterpolator<float, double>;    ///< Хранение float, накопление double
+
+#endif // BASIC_NEWTON_INTERPOLATOR_H
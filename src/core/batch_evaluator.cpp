@@ -0,0 +1,62 @@
+#include "batch_evaluator.h"
+#include <stdexcept>
+#include <algorithm>
+
+BatchEvaluator::BatchEvaluator(size_t points_per_block, size_t nodes_per_block) {
+    set_tiling(points_per_block, nodes_per_block);
+}
+
+void BatchEvaluator::set_tiling(size_t points_per_block, size_t nodes_per_block) {
+    if (points_per_block == 0 || nodes_per_block == 0) {
+        throw std::invalid_argument("Размеры блоков должны быть положительными");
+    }
+    point_block = points_per_block;
+    node_block = nodes_per_block;
+}
+
+size_t BatchEvaluator::get_point_block() const {
+    return point_block;
+}
+
+size_t BatchEvaluator::get_node_block() const {
+    return node_block;
+}
+
+void BatchEvaluator::evaluate_block(EvaluationKernel kernel,
+                                    const double* x, const double* coefficients, size_t n,
+                                    const double* points, double* results, size_t count) const {
+    if (n == 0) {
+        return;
+    }
+    
+    for (size_t begin = 0; begin < count; begin += point_block) {
+        const size_t block_count = std::min(point_block, count - begin);
+        const double* block_points = points + begin;
+        double* state = results + begin;
+        
+        // Частичные суммы хранятся прямо в массиве результатов блока
+        std::fill(state, state + block_count, coefficients[n-1]);
+        for (size_t tile_end = n - 1; tile_end > 0; ) {
+            const size_t tile_begin = tile_end > node_block ? tile_end - node_block : 0;
+            EvaluationKernels::horner_range(kernel, x, coefficients, tile_begin, tile_end,
+                                            block_points, state, block_count);
+            tile_end = tile_begin;
+        }
+    }
+}
+
+void BatchEvaluator::evaluate(EvaluationKernel kernel,
+                              const double* x, const double* coefficients, size_t n,
+                              const double* points, double* results, size_t count,
+                              const ParallelSchedule& schedule) const {
+    const EvaluationKernel resolved = EvaluationKernels::resolve(kernel);
+    const size_t block = point_block;
+    const size_t num_blocks = (count + block - 1) / block;
+
+    auto body = [&](size_t first_block, size_t last_block) {
+        const size_t begin = first_block * block;
+        const size_t end = std::min(last_block * block, count);
+        evaluate_block(resolved, x, coefficients, n, points + begin, results + begin, end - begin);
+    };
+    ParallelScheduler::parallel_for(schedule, num_blocks, body);
+}
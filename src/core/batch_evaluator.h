@@ -0,0 +1,85 @@
+/**
+ * @file batch_evaluator.h
+ * @brief Блочное (cache-blocked) вычисление полинома Ньютона в большом наборе точек
+ */
+
+#ifndef BATCH_EVALUATOR_H
+#define BATCH_EVALUATOR_H
+
+#include "evaluation_kernels.h"
+#include "parallel_scheduler.h"
+#include <cstddef>
+
+/**
+ * @class BatchEvaluator
+ * @brief Вычисляет полином по плиткам "точки x узлы"
+ *
+ * Блок точек проходит по блокам узлов от старших к младшим, частичные суммы
+ * схемы Горнера переносятся между блоками узлов. Размеры подобраны так, чтобы
+ * частичные суммы блока точек и блок узлов с коэффициентами одновременно
+ * помещались в L1, поэтому узлы не перечитываются из памяти для каждой группы
+ * точек и производительность не падает, когда таблица перестает помещаться в кэш.
+ */
+class BatchEvaluator {
+private:
+    size_t point_block;  ///< Количество точек в блоке
+    size_t node_block;   ///< Количество узлов в блоке
+
+public:
+    /**
+     * @brief Конструктор
+     * @param points_per_block Количество точек в блоке
+     * @param nodes_per_block Количество узлов в блоке
+     */
+    explicit BatchEvaluator(size_t points_per_block = 256, size_t nodes_per_block = 1024);
+    
+    /**
+     * @brief Устанавливает размеры блоков
+     * @param points_per_block Количество точек в блоке
+     * @param nodes_per_block Количество узлов в блоке
+     * @throws std::invalid_argument если один из размеров равен 0
+     */
+    void set_tiling(size_t points_per_block, size_t nodes_per_block);
+    
+    /**
+     * @brief Возвращает количество точек в блоке
+     */
+    size_t get_point_block() const;
+    
+    /**
+     * @brief Возвращает количество узлов в блоке
+     */
+    size_t get_node_block() const;
+    
+    /**
+     * @brief Последовательно вычисляет полином в наборе точек по плиткам
+     * @param kernel Ядро вычисления
+     * @param x Узлы интерполяции
+     * @param coefficients Коэффициенты полинома Ньютона
+     * @param n Количество узлов
+     * @param points Точки для вычисления
+     * @param results Массив результатов (count элементов)
+     * @param count Количество точек
+     */
+    void evaluate_block(EvaluationKernel kernel,
+                        const double* x, const double* coefficients, size_t n,
+                        const double* points, double* results, size_t count) const;
+    
+    /**
+     * @brief Вычисляет полином в наборе точек, распределяя блоки точек между потоками
+     * @param kernel Ядро вычисления
+     * @param x Узлы интерполяции
+     * @param coefficients Коэффициенты полинома Ньютона
+     * @param n Количество узлов
+     * @param points Точки для вычисления
+     * @param results Массив результатов (count элементов)
+     * @param count Количество точек
+     * @param schedule Распределение блоков точек (по умолчанию OpenMP dynamic по одному блоку)
+     */
+    void evaluate(EvaluationKernel kernel,
+                  const double* x, const double* coefficients, size_t n,
+                  const double* points, double* results, size_t count,
+                  const ParallelSchedule& schedule = ParallelSchedule()) const;
+};
+
+#endif // BATCH_EVALUATOR_H
@@ -0,0 +1,71 @@
+#include "batch_telemetry.h"
+#include <algorithm>
+
+double BatchTelemetry::utilization(size_t thread) const {
+    if (thread >= threads.size() || wall_ms <= 0.0) {
+        return 0.0;
+    }
+    return std::min(1.0, threads[thread].busy_ms / wall_ms);
+}
+
+double BatchTelemetry::imbalance() const {
+    if (threads.empty()) {
+        return 1.0;
+    }
+    double max_busy = 0.0;
+    for (const ThreadTelemetry& t : threads) {
+        max_busy = std::max(max_busy, t.busy_ms);
+    }
+    const double mean_busy = total_busy_ms() / threads.size();
+    return mean_busy > 0.0 ? max_busy / mean_busy : 1.0;
+}
+
+double BatchTelemetry::total_busy_ms() const {
+    double total = 0.0;
+    for (const ThreadTelemetry& t : threads) {
+        total += t.busy_ms;
+    }
+    return total;
+}
+
+TelemetryRecorder::TelemetryRecorder(size_t team_size)
+    : start(clock::now()), cells(std::max<size_t>(team_size, 1)), dropped_chunks(0) {}
+
+void TelemetryRecorder::record_chunk(size_t thread, clock::time_point chunk_start,
+                                     clock::time_point chunk_end, size_t points) {
+    if (thread >= cells.size()) {
+        dropped_chunks.fetch_add(1, std::memory_order_relaxed);
+        return;
+    }
+    Cell& cell = cells[thread];
+    if (cell.chunks == 0) {
+        cell.first_start = chunk_start;
+    }
+    cell.last_end = chunk_end;
+    cell.busy_ms += std::chrono::duration<double, std::milli>(chunk_end - chunk_start).count();
+    cell.points += points;
+    cell.chunks++;
+}
+
+BatchTelemetry TelemetryRecorder::finish() const {
+    const clock::time_point end = clock::now();
+    BatchTelemetry telemetry;
+    telemetry.wall_ms = std::chrono::duration<double, std::milli>(end - start).count();
+    telemetry.threads.resize(cells.size());
+    telemetry.dropped_chunks = dropped_chunks.load(std::memory_order_relaxed);
+    for (size_t i = 0; i < cells.size(); i++) {
+        const Cell& cell = cells[i];
+        ThreadTelemetry& t = telemetry.threads[i];
+        t.thread = i;
+        t.busy_ms = cell.busy_ms;
+        t.points = cell.points;
+        t.chunks = cell.chunks;
+        if (cell.chunks > 0) {
+            t.startup_ms = std::chrono::duration<double, std::milli>(cell.first_start - start).count();
+            t.wait_ms = std::chrono::duration<double, std::milli>(end - cell.last_end).count();
+        } else {
+            t.wait_ms = telemetry.wall_ms;  // поток не получил работы и весь пакет простаивал
+        }
+    }
+    return telemetry;
+}
@@ -0,0 +1,105 @@
+/**
+ * @file batch_telemetry.h
+ * @brief Телеметрия потоков при пакетном вычислении: занятость, ожидание, порции
+ */
+
+#ifndef BATCH_TELEMETRY_H
+#define BATCH_TELEMETRY_H
+
+#include "aligned_buffer.h"
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <vector>
+
+/**
+ * @struct ThreadTelemetry
+ * @brief Статистика одного потока за один пакет
+ */
+struct ThreadTelemetry {
+    size_t thread = 0;        ///< Номер потока
+    double busy_ms = 0.0;     ///< Время вычисления порций
+    double startup_ms = 0.0;  ///< От начала пакета до первой порции (запуск потока)
+    double wait_ms = 0.0;     ///< От последней порции до конца пакета (ожидание на барьере)
+    size_t points = 0;        ///< Вычисленных точек
+    size_t chunks = 0;        ///< Полученных порций
+};
+
+/**
+ * @struct BatchTelemetry
+ * @brief Телеметрия пакетного вычисления по всем потокам команды
+ *
+ * Если занятость потоков заметно различается (imbalance() > 1), ускорение
+ * ограничено дисбалансом нагрузки и лечится распределением. Если занятость
+ * ровная, но суммарное время занятости растет с числом потоков, порции
+ * замедляются из-за общей памяти, то есть упираются в пропускную способность.
+ */
+struct BatchTelemetry {
+    double wall_ms = 0.0;                  ///< Время пакета целиком
+    std::vector<ThreadTelemetry> threads;  ///< Потоки команды (включая не получивших порций)
+    size_t dropped_chunks = 0;             ///< Порции с номером потока вне команды (не учтены)
+
+    /**
+     * @brief Доля времени пакета, которую поток вычислял (0..1)
+     */
+    double utilization(size_t thread) const;
+
+    /**
+     * @brief Отношение максимальной занятости к средней (1 - идеальный баланс)
+     */
+    double imbalance() const;
+
+    /**
+     * @brief Суммарная занятость всех потоков, мс
+     */
+    double total_busy_ms() const;
+};
+
+/**
+ * @class TelemetryRecorder
+ * @brief Сбор телеметрии без блокировок: каждый поток пишет только свою ячейку
+ */
+class TelemetryRecorder {
+public:
+    using clock = std::chrono::steady_clock;
+
+private:
+    /**
+     * @brief Ячейка потока на отдельной кэш-линии (без ложного разделения)
+     */
+    struct alignas(64) Cell {
+        clock::time_point first_start;
+        clock::time_point last_end;
+        double busy_ms = 0.0;
+        size_t points = 0;
+        size_t chunks = 0;
+    };
+
+    clock::time_point start;                    ///< Начало пакета
+    AlignedVector<Cell> cells;                  ///< Ячейки потоков
+    std::atomic<size_t> dropped_chunks;         ///< Порции с номером потока вне команды
+
+public:
+    /**
+     * @brief Начинает пакет
+     * @param team_size Количество потоков команды (ParallelScheduler::team_size расписания пакета)
+     */
+    explicit TelemetryRecorder(size_t team_size);
+
+    /**
+     * @brief Учитывает порцию, вычисленную потоком
+     * @param thread Номер потока; порция с номером вне команды не учитывается в ячейках,
+     *               а только в счетчике dropped_chunks (чужая ячейка означала бы гонку)
+     * @param chunk_start Начало порции
+     * @param chunk_end Конец порции
+     * @param points Точек в порции
+     */
+    void record_chunk(size_t thread, clock::time_point chunk_start, clock::time_point chunk_end, size_t points);
+
+    /**
+     * @brief Завершает пакет и формирует телеметрию
+     */
+    BatchTelemetry finish() const;
+};
+
+#endif // BATCH_TELEMETRY_H
@@ -0,0 +1,49 @@
+#include "benchmark.h"
+#include <algorithm>
+#include <cmath>
+#include <stdexcept>
+
+BenchmarkStats BenchmarkStats::from_samples(std::vector<double> samples) {
+    if (samples.empty()) {
+        throw std::invalid_argument("Нет измерений для статистики");
+    }
+    std::sort(samples.begin(), samples.end());
+    const size_t k = samples.size();
+
+    BenchmarkStats stats;
+    stats.runs = k;
+    stats.min_ms = samples.front();
+    stats.max_ms = samples.back();
+    stats.median_ms = k % 2 == 1 ? samples[k / 2] : 0.5 * (samples[k / 2 - 1] + samples[k / 2]);
+    const size_t rank = static_cast<size_t>(std::ceil(0.95 * k));
+    stats.p95_ms = samples[std::max<size_t>(rank, 1) - 1];
+
+    double sum = 0.0;
+    for (double s : samples) {
+        sum += s;
+    }
+    stats.mean_ms = sum / k;
+    if (k > 1) {
+        double squares = 0.0;
+        for (double s : samples) {
+            squares += (s - stats.mean_ms) * (s - stats.mean_ms);
+        }
+        stats.stddev_ms = std::sqrt(squares / (k - 1));
+    }
+    return stats;
+}
+
+Benchmark::Benchmark(size_t warmup_runs, size_t measured_runs)
+    : warmup_runs(warmup_runs), measured_runs(measured_runs) {
+    if (measured_runs == 0) {
+        throw std::invalid_argument("Количество измеряемых прогонов должно быть положительным");
+    }
+}
+
+size_t Benchmark::get_warmup_runs() const {
+    return warmup_runs;
+}
+
+size_t Benchmark::get_measured_runs() const {
+    return measured_runs;
+}
@@ -0,0 +1,94 @@
+/**
+ * @file benchmark.h
+ * @brief Повторные измерения времени с прогревом и статистикой
+ */
+
+#ifndef BENCHMARK_H
+#define BENCHMARK_H
+
+#include <chrono>
+#include <cstddef>
+#include <vector>
+
+/**
+ * @struct BenchmarkStats
+ * @brief Статистика серии измерений, мс
+ */
+struct BenchmarkStats {
+    size_t runs = 0;          ///< Количество измерений
+    double min_ms = 0.0;      ///< Минимум
+    double median_ms = 0.0;   ///< Медиана
+    double p95_ms = 0.0;      ///< 95-й перцентиль (по ближайшему рангу)
+    double mean_ms = 0.0;     ///< Среднее
+    double stddev_ms = 0.0;   ///< Выборочное стандартное отклонение
+    double max_ms = 0.0;      ///< Максимум
+
+    /**
+     * @brief Вычисляет статистику по выборке
+     * @param samples Времена измерений, мс
+     * @throws std::invalid_argument если выборка пуста
+     */
+    static BenchmarkStats from_samples(std::vector<double> samples);
+};
+
+/**
+ * @class Benchmark
+ * @brief Выполняет прогревочные и измеряемые прогоны функции
+ */
+class Benchmark {
+private:
+    size_t warmup_runs;    ///< Прогоны без измерения (кэши, страницы, потоки OpenMP)
+    size_t measured_runs;  ///< Измеряемые прогоны
+
+public:
+    /**
+     * @brief Конструктор
+     * @param warmup_runs Количество прогревочных прогонов
+     * @param measured_runs Количество измеряемых прогонов (не менее 1)
+     * @throws std::invalid_argument если measured_runs равно 0
+     */
+    explicit Benchmark(size_t warmup_runs = 3, size_t measured_runs = 20);
+
+    /**
+     * @brief Измеряет функцию и возвращает отдельные измерения
+     * @param body Функция без аргументов
+     * @return Времена измеряемых прогонов в порядке выполнения, мс
+     */
+    template <typename Body>
+    std::vector<double> sample(Body&& body) const {
+        for (size_t i = 0; i < warmup_runs; i++) {
+            body();
+        }
+        std::vector<double> samples;
+        samples.reserve(measured_runs);
+        for (size_t i = 0; i < measured_runs; i++) {
+            std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+            body();
+            std::chrono::duration<double, std::milli> elapsed = std::chrono::steady_clock::now() - start;
+            samples.push_back(elapsed.count());
+        }
+        return samples;
+    }
+
+    /**
+     * @brief Измеряет функцию
+     * @param body Функция без аргументов
+     * @return Статистика измеряемых прогонов
+     */
+    template <typename Body>
+    BenchmarkStats measure(Body&& body) const {
+        return BenchmarkStats::from_samples(sample(body));
+    }
+
+    /**
+     * @brief Возвращает количество прогревочных прогонов
+     */
+    size_t get_warmup_runs() const;
+
+    /**
+     * @brief Возвращает количество измеряемых прогонов
+     */
+    size_t get_measured_runs() const;
+};
+
+#endif // BENCHMARK_H
@@ -0,0 +1,75 @@
+#include "benchmark_report.h"
+#include <fstream>
+#include <sstream>
+#include <stdexcept>
+
+/**
+ * @brief Записывает строку в файл целиком
+ */
+static void write_text_file(const std::string& path, const std::string& text) {
+    std::ofstream file(path);
+    if (!file) {
+        throw std::runtime_error("Не удалось открыть файл для записи: " + path);
+    }
+    file << text;
+    if (!file) {
+        throw std::runtime_error("Ошибка записи файла: " + path);
+    }
+}
+
+double BenchmarkRecord::points_per_second() const {
+    if (batch == 0 || stats.median_ms <= 0.0) {
+        return 0.0;
+    }
+    return static_cast<double>(batch) / (stats.median_ms * 1e-3);
+}
+
+BenchmarkReport::BenchmarkReport(unsigned seed) : seed(seed) {}
+
+void BenchmarkReport::add(const BenchmarkRecord& record) {
+    records.push_back(record);
+}
+
+const std::vector<BenchmarkRecord>& BenchmarkReport::get_records() const {
+    return records;
+}
+
+std::string BenchmarkReport::to_csv() const {
+    std::ostringstream out;
+    out.precision(9);
+    out << "mode,phase,kernel,schedule,nodes,batch,threads,runs,min_ms,median_ms,p95_ms,mean_ms,stddev_ms,max_ms,points_per_second\n";
+    for (const BenchmarkRecord& r : records) {
+        out << r.mode << "," << r.phase << "," << r.kernel << "," << r.schedule << "," << r.nodes << "," << r.batch << "," << r.threads << ","
+            << r.stats.runs << "," << r.stats.min_ms << "," << r.stats.median_ms << "," << r.stats.p95_ms << ","
+            << r.stats.mean_ms << "," << r.stats.stddev_ms << "," << r.stats.max_ms << ","
+            << r.points_per_second() << "\n";
+    }
+    return out.str();
+}
+
+std::string BenchmarkReport::to_json() const {
+    std::ostringstream out;
+    out.precision(9);
+    out << "{\n  \"seed\": " << seed << ",\n  \"results\": [";
+    for (size_t i = 0; i < records.size(); i++) {
+        const BenchmarkRecord& r = records[i];
+        out << (i == 0 ? "\n" : ",\n")
+            << "    {\"mode\": \"" << r.mode << "\", \"phase\": \"" << r.phase << "\""
+            << ", \"kernel\": \"" << r.kernel << "\", \"schedule\": \"" << r.schedule << "\""
+            << ", \"nodes\": " << r.nodes << ", \"batch\": " << r.batch << ", \"threads\": " << r.threads
+            << ", \"runs\": " << r.stats.runs << ", \"min_ms\": " << r.stats.min_ms
+            << ", \"median_ms\": " << r.stats.median_ms << ", \"p95_ms\": " << r.stats.p95_ms
+            << ", \"mean_ms\": " << r.stats.mean_ms << ", \"stddev_ms\": " << r.stats.stddev_ms
+            << ", \"max_ms\": " << r.stats.max_ms << ", \"points_per_second\": " << r.points_per_second() << "}";
+    }
+    out << (records.empty() ? "]\n}\n" : "\n  ]\n}\n");
+    return out.str();
+}
+
+void BenchmarkReport::write_csv(const std::string& path) const {
+    write_text_file(path, to_csv());
+}
+
+void BenchmarkReport::write_json(const std::string& path) const {
+    write_text_file(path, to_json());
+}
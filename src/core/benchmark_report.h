@@ -0,0 +1,83 @@
+/**
+ * @file benchmark_report.h
+ * @brief Таблица результатов бенчмарка с выводом в CSV и JSON
+ */
+
+#ifndef BENCHMARK_REPORT_H
+#define BENCHMARK_REPORT_H
+
+#include "benchmark.h"
+#include <string>
+#include <vector>
+#include <cstddef>
+
+/**
+ * @struct BenchmarkRecord
+ * @brief Одна точка параметрического прогона
+ */
+struct BenchmarkRecord {
+    std::string mode;        ///< Режим вычисления (newton, barycentric, piecewise, ...)
+    std::string phase;       ///< Измеряемый этап (set_data, evaluate)
+    std::string kernel;      ///< Ядро вычисления (scalar, sse2, ...; "-" если этап его не использует)
+    std::string schedule;    ///< Политика распределения (static, dynamic, guided, work-stealing; "-" для set_data)
+    size_t nodes = 0;        ///< Количество узлов
+    size_t batch = 0;        ///< Количество точек (0 для set_data)
+    size_t threads = 0;      ///< Количество потоков
+    BenchmarkStats stats;    ///< Статистика времени
+
+    /**
+     * @brief Пропускная способность по медиане, точек в секунду (0 для set_data)
+     */
+    double points_per_second() const;
+};
+
+/**
+ * @class BenchmarkReport
+ * @brief Накапливает записи и сохраняет их в CSV или JSON
+ */
+class BenchmarkReport {
+private:
+    std::vector<BenchmarkRecord> records;  ///< Записи в порядке добавления
+    unsigned seed;                         ///< Зерно генератора данных (записывается в JSON)
+
+public:
+    /**
+     * @brief Конструктор
+     * @param seed Зерно генератора данных прогона
+     */
+    explicit BenchmarkReport(unsigned seed = 0);
+
+    /**
+     * @brief Добавляет запись
+     */
+    void add(const BenchmarkRecord& record);
+
+    /**
+     * @brief Возвращает записи
+     */
+    const std::vector<BenchmarkRecord>& get_records() const;
+
+    /**
+     * @brief Формирует CSV с заголовком
+     */
+    std::string to_csv() const;
+
+    /**
+     * @brief Формирует JSON-объект {"seed": ..., "results": [...]}
+     */
+    std::string to_json() const;
+
+    /**
+     * @brief Сохраняет CSV в файл
+     * @throws std::runtime_error если файл не удалось записать
+     */
+    void write_csv(const std::string& path) const;
+
+    /**
+     * @brief Сохраняет JSON в файл
+     * @throws std::runtime_error если файл не удалось записать
+     */
+    void write_json(const std::string& path) const;
+};
+
+#endif // BENCHMARK_REPORT_H
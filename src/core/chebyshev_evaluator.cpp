@@ -0,0 +1,104 @@
+#include "chebyshev_evaluator.h"
+#include <omp.h>
+#include <stdexcept>
+#include <algorithm>
+
+/**
+ * @brief Количество точек, вычисляемых одновременно (цикл по точкам векторизуется)
+ */
+static const size_t CHEBYSHEV_BLOCK_SIZE = 64;
+
+ChebyshevEvaluator::ChebyshevEvaluator() : center(0.0), inverse_half_width(1.0) {}
+
+ChebyshevEvaluator::ChebyshevEvaluator(const double* x, const double* newton_coefficients, size_t n,
+                                       double a, double b) {
+    if (!(b > a)) {
+        throw std::invalid_argument("Интервал должен удовлетворять условию a < b");
+    }
+    center = 0.5 * (a + b);
+    const double half_width = 0.5 * (b - a);
+    inverse_half_width = 1.0 / half_width;
+
+    coefficients.assign(n, 0.0);
+    if (n == 0) {
+        return;
+    }
+
+    // Вложенная схема в базисе Чебышева: s = c_{n-1}; s = h (u - u_i) s + c_i,
+    // умножение на u: u T_0 = T_1, u T_k = (T_{k-1} + T_{k+1}) / 2
+    double* s = coefficients.data();
+    AlignedVector<double> product(n, 0.0);
+    s[0] = newton_coefficients[n-1];
+    for (size_t i = n - 1, m = 1; i-- > 0; m++) {
+        const double u_i = (x[i] - center) * inverse_half_width;
+        std::fill(product.begin(), product.begin() + m + 1, 0.0);
+        product[1] += s[0];
+        for (size_t k = 1; k < m; k++) {
+            product[k-1] += 0.5 * s[k];
+            product[k+1] += 0.5 * s[k];
+        }
+        for (size_t k = 0; k < m; k++) {
+            product[k] -= u_i * s[k];
+        }
+        for (size_t k = 0; k <= m; k++) {
+            s[k] = half_width * product[k];
+        }
+        s[0] += newton_coefficients[i];
+    }
+}
+
+double ChebyshevEvaluator::evaluate(double point) const {
+    const size_t n = coefficients.size();
+    if (n == 0) {
+        return 0.0;
+    }
+    const double u = (point - center) * inverse_half_width;
+    const double two_u = 2.0 * u;
+    double b1 = 0.0;
+    double b2 = 0.0;
+    for (size_t k = n; k-- > 1; ) {
+        double b0 = coefficients[k] + two_u * b1 - b2;
+        b2 = b1;
+        b1 = b0;
+    }
+    return coefficients[0] + u * b1 - b2;
+}
+
+void ChebyshevEvaluator::evaluate(const double* points, double* results, size_t count) const {
+    const size_t n = coefficients.size();
+    const double* a = coefficients.data();
+    const long num_blocks = static_cast<long>((count + CHEBYSHEV_BLOCK_SIZE - 1) / CHEBYSHEV_BLOCK_SIZE);
+
+    #pragma omp parallel for schedule(static)
+    for (long block = 0; block < num_blocks; block++) {
+        const size_t first = static_cast<size_t>(block) * CHEBYSHEV_BLOCK_SIZE;
+        const size_t m = std::min(CHEBYSHEV_BLOCK_SIZE, count - first);
+        double u[CHEBYSHEV_BLOCK_SIZE];
+        double b1[CHEBYSHEV_BLOCK_SIZE];
+        double b2[CHEBYSHEV_BLOCK_SIZE];
+        for (size_t j = 0; j < m; j++) {
+            u[j] = (points[first + j] - center) * inverse_half_width;
+            b1[j] = 0.0;
+            b2[j] = 0.0;
+        }
+        for (size_t k = n; k-- > 1; ) {
+            const double ak = a[k];
+            for (size_t j = 0; j < m; j++) {
+                double b0 = ak + 2.0 * u[j] * b1[j] - b2[j];
+                b2[j] = b1[j];
+                b1[j] = b0;
+            }
+        }
+        for (size_t j = 0; j < m; j++) {
+            results[first + j] = n > 0 ? a[0] + u[j] * b1[j] - b2[j] : 0.0;
+        }
+    }
+}
+
+const AlignedVector<double>& ChebyshevEvaluator::get_coefficients() const {
+    return coefficients;
+}
+
+size_t ChebyshevEvaluator::size() const {
+    return coefficients.size();
+}
@@ -0,0 +1,67 @@
+/**
+ * @file chebyshev_evaluator.h
+ * @brief Полином в виде ряда Чебышева, полученный из формы Ньютона
+ */
+
+#ifndef CHEBYSHEV_EVALUATOR_H
+#define CHEBYSHEV_EVALUATOR_H
+
+#include "aligned_buffer.h"
+#include <cstddef>
+
+/**
+ * @class ChebyshevEvaluator
+ * @brief Компактный вычислитель p(t) = sum a_k T_k(u), u = (2t - a - b) / (b - a)
+ *
+ * Хранит только один массив коэффициентов и вычисляется алгоритмом
+ * Кленшоу, который устойчив на [a, b] и при высоких степенях.
+ */
+class ChebyshevEvaluator {
+private:
+    AlignedVector<double> coefficients;  ///< Коэффициенты a_k при T_k
+    double center;                       ///< Центр интервала (a + b) / 2
+    double inverse_half_width;           ///< 2 / (b - a)
+
+public:
+    /**
+     * @brief Конструктор по умолчанию (пустой ряд)
+     */
+    ChebyshevEvaluator();
+
+    /**
+     * @brief Переводит полином Ньютона в ряд Чебышева на [a, b] за O(n^2)
+     * @param x Узлы интерполяции
+     * @param newton_coefficients Коэффициенты полинома Ньютона
+     * @param n Количество узлов
+     * @param a Левая граница интервала
+     * @param b Правая граница интервала
+     */
+    ChebyshevEvaluator(const double* x, const double* newton_coefficients, size_t n, double a, double b);
+
+    /**
+     * @brief Вычисляет ряд в точке алгоритмом Кленшоу
+     * @param point Точка
+     * @return Значение полинома
+     */
+    double evaluate(double point) const;
+
+    /**
+     * @brief Вычисляет ряд в наборе точек с использованием OpenMP
+     * @param points Точки
+     * @param results Массив результатов (count элементов)
+     * @param count Количество точек
+     */
+    void evaluate(const double* points, double* results, size_t count) const;
+
+    /**
+     * @brief Возвращает коэффициенты a_k
+     */
+    const AlignedVector<double>& get_coefficients() const;
+
+    /**
+     * @brief Возвращает количество членов ряда
+     */
+    size_t size() const;
+};
+
+#endif // CHEBYSHEV_EVALUATOR_H
@@ -0,0 +1,182 @@
+#include "curve_decimator.h"
+#include <algorithm>
+#include <cmath>
+#include <stdexcept>
+
+namespace {
+
+/**
+ * @brief Проверяет входные данные прореживания
+ */
+void validate_curve(std::span<const double> x, std::span<const double> y) {
+    if (x.size() != y.size()) {
+        throw std::invalid_argument("Размеры векторов x и y должны совпадать");
+    }
+    if (!std::is_sorted(x.begin(), x.end())) {
+        throw std::invalid_argument("Точки кривой должны быть упорядочены по x");
+    }
+}
+
+/**
+ * @brief Копирует кривую без прореживания
+ */
+void copy_curve(std::span<const double> x, std::span<const double> y,
+                std::vector<double>& out_x, std::vector<double>& out_y) {
+    out_x.assign(x.begin(), x.end());
+    out_y.assign(y.begin(), y.end());
+}
+
+} // namespace
+
+void CurveDecimator::min_max(std::span<const double> x, std::span<const double> y, size_t width,
+                             std::vector<double>& out_x, std::vector<double>& out_y) {
+    validate_curve(x, y);
+    if (width == 0) {
+        throw std::invalid_argument("Ширина графика должна быть положительной");
+    }
+    const size_t n = x.size();
+    if (n <= 4 * width) {
+        copy_curve(x, y, out_x, out_y);
+        return;
+    }
+
+    const double left = x.front();
+    const double range = x.back() - left;
+    auto column_of = [&](double value) {
+        if (range <= 0.0) {
+            return size_t{0};
+        }
+        const double position = std::floor((value - left) / range * static_cast<double>(width));
+        return std::min(width - 1, static_cast<size_t>(std::max(0.0, position)));
+    };
+
+    // Столбец точки монотонен по x, поэтому каждому столбцу соответствует непрерывный отрезок индексов
+    std::vector<size_t> bounds(width + 1);
+    bounds[width] = n;
+    #pragma omp parallel for schedule(static)
+    for (long c = 0; c < static_cast<long>(width); c++) {
+        const size_t column = static_cast<size_t>(c);
+        const auto first = std::partition_point(x.begin(), x.end(),
+                                                [&](double value) { return column_of(value) < column; });
+        bounds[column] = static_cast<size_t>(first - x.begin());
+    }
+
+    std::vector<size_t> selected(4 * width);
+    std::vector<size_t> counts(width);
+    #pragma omp parallel for schedule(static)
+    for (long c = 0; c < static_cast<long>(width); c++) {
+        const size_t begin = bounds[c];
+        const size_t end = bounds[c + 1];
+        if (begin == end) {
+            counts[c] = 0;
+            continue;
+        }
+        size_t lowest = begin;
+        size_t highest = begin;
+        for (size_t i = begin + 1; i < end; i++) {
+            if (y[i] < y[lowest]) {
+                lowest = i;
+            }
+            if (y[i] > y[highest]) {
+                highest = i;
+            }
+        }
+        size_t* column = selected.data() + 4 * c;
+        size_t picks[4] = {begin, std::min(lowest, highest), std::max(lowest, highest), end - 1};
+        size_t count = 0;
+        for (size_t pick : picks) {
+            if (count == 0 || column[count - 1] != pick) {
+                column[count++] = pick;
+            }
+        }
+        counts[c] = count;
+    }
+
+    std::vector<size_t> offsets(width + 1, 0);
+    for (size_t c = 0; c < width; c++) {
+        offsets[c + 1] = offsets[c] + counts[c];
+    }
+    out_x.resize(offsets[width]);
+    out_y.resize(offsets[width]);
+    #pragma omp parallel for schedule(static)
+    for (long c = 0; c < static_cast<long>(width); c++) {
+        for (size_t k = 0; k < counts[c]; k++) {
+            const size_t index = selected[4 * c + k];
+            out_x[offsets[c] + k] = x[index];
+            out_y[offsets[c] + k] = y[index];
+        }
+    }
+}
+
+void CurveDecimator::lttb(std::span<const double> x, std::span<const double> y, size_t threshold,
+                          std::vector<double>& out_x, std::vector<double>& out_y) {
+    validate_curve(x, y);
+    if (threshold < 3) {
+        throw std::invalid_argument("LTTB требует не менее 3 точек результата");
+    }
+    const size_t n = x.size();
+    if (threshold >= n) {
+        copy_curve(x, y, out_x, out_y);
+        return;
+    }
+
+    out_x.resize(threshold);
+    out_y.resize(threshold);
+    out_x[0] = x[0];
+    out_y[0] = y[0];
+
+    // Внутренние точки делятся на threshold - 2 корзины; из каждой берется точка,
+    // образующая наибольший треугольник с предыдущей выбранной и средним следующей корзины
+    const double bucket = static_cast<double>(n - 2) / static_cast<double>(threshold - 2);
+    size_t previous = 0;
+    for (size_t b = 0; b < threshold - 2; b++) {
+        const size_t begin = static_cast<size_t>(std::floor(b * bucket)) + 1;
+        const size_t end = static_cast<size_t>(std::floor((b + 1) * bucket)) + 1;
+
+        const size_t next_begin = end;
+        const size_t next_end = std::min(n, static_cast<size_t>(std::floor((b + 2) * bucket)) + 1);
+        double average_x = 0.0;
+        double average_y = 0.0;
+        for (size_t i = next_begin; i < next_end; i++) {
+            average_x += x[i];
+            average_y += y[i];
+        }
+        const double next_count = static_cast<double>(next_end - next_begin);
+        average_x /= next_count;
+        average_y /= next_count;
+
+        double largest = -1.0;
+        size_t chosen = begin;
+        for (size_t i = begin; i < end; i++) {
+            const double area = std::abs((x[previous] - average_x) * (y[i] - y[previous]) -
+                                         (x[previous] - x[i]) * (average_y - y[previous]));
+            if (area > largest) {
+                largest = area;
+                chosen = i;
+            }
+        }
+        out_x[b + 1] = x[chosen];
+        out_y[b + 1] = y[chosen];
+        previous = chosen;
+    }
+
+    out_x[threshold - 1] = x[n - 1];
+    out_y[threshold - 1] = y[n - 1];
+}
+
+void CurveDecimator::decimate(DecimationMethod method, std::span<const double> x, std::span<const double> y,
+                              size_t width, std::vector<double>& out_x, std::vector<double>& out_y) {
+    switch (method) {
+        case DecimationMethod::None:
+            validate_curve(x, y);
+            copy_curve(x, y, out_x, out_y);
+            return;
+        case DecimationMethod::MinMax:
+            min_max(x, y, width, out_x, out_y);
+            return;
+        case DecimationMethod::Lttb:
+            lttb(x, y, std::max<size_t>(3, 2 * width), out_x, out_y);
+            return;
+    }
+    throw std::invalid_argument("Неизвестный способ прореживания");
+}
@@ -0,0 +1,67 @@
+/**
+ * @file curve_decimator.h
+ * @brief Прореживание кривых из миллионов точек до разрешения графика
+ */
+
+#ifndef CURVE_DECIMATOR_H
+#define CURVE_DECIMATOR_H
+
+#include <cstddef>
+#include <span>
+#include <vector>
+
+/**
+ * @brief Способ прореживания кривой перед построением
+ */
+enum class DecimationMethod {
+    None,       ///< Все точки
+    MinMax,     ///< Первая, минимальная, максимальная и последняя точки каждого столбца пикселей (M4)
+    Lttb        ///< Largest-Triangle-Three-Buckets: заданное число точек с сохранением формы
+};
+
+/**
+ * @class CurveDecimator
+ * @brief Сокращает кривую y(x) с упорядоченными x до размера, различимого на графике
+ *
+ * Для ломаной шириной width пикселей прореживание MinMax отрисовывается так
+ * же, как исходная кривая: в каждом столбце сохраняются точки входа и выхода
+ * и экстремумы. Столбцы независимы и обрабатываются параллельно (OpenMP).
+ * LTTB выбирает точки последовательно (каждый выбор зависит от предыдущего)
+ * и дает более гладкий результат при меньшем числе точек.
+ */
+class CurveDecimator {
+public:
+    /**
+     * @brief Прореживание по столбцам пикселей (M4)
+     * @param x Значения x (неубывающие)
+     * @param y Значения y
+     * @param width Число столбцов пикселей
+     * @param out_x Прореженные x (не более 4 * width точек, в исходном порядке)
+     * @param out_y Прореженные y
+     * @throws std::invalid_argument при несовпадении размеров, width == 0 или неупорядоченных x
+     */
+    static void min_max(std::span<const double> x, std::span<const double> y, size_t width,
+                        std::vector<double>& out_x, std::vector<double>& out_y);
+
+    /**
+     * @brief Прореживание Largest-Triangle-Three-Buckets
+     * @param x Значения x (неубывающие)
+     * @param y Значения y
+     * @param threshold Число точек результата (не меньше 3; при threshold >= size копия)
+     * @param out_x Прореженные x (первая и последняя точки сохраняются)
+     * @param out_y Прореженные y
+     * @throws std::invalid_argument при несовпадении размеров, threshold < 3 или неупорядоченных x
+     */
+    static void lttb(std::span<const double> x, std::span<const double> y, size_t threshold,
+                     std::vector<double>& out_x, std::vector<double>& out_y);
+
+    /**
+     * @brief Прореживает выбранным способом до ширины графика
+     * @param method Способ прореживания
+     * @param width Ширина графика в пикселях (LTTB оставляет 2 * width точек)
+     */
+    static void decimate(DecimationMethod method, std::span<const double> x, std::span<const double> y,
+                         size_t width, std::vector<double>& out_x, std::vector<double>& out_y);
+};
+
+#endif // CURVE_DECIMATOR_H
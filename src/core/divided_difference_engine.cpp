@@ -0,0 +1,192 @@
+#include "divided_difference_engine.h"
+#include <omp.h>
+#include <stdexcept>
+#include <cmath>
+#include <algorithm>
+
+DividedDifferenceEngine::DividedDifferenceEngine(bool keep_table)
+    : keep_full_table(keep_table), node_count(0), parallel_threshold(DEFAULT_PARALLEL_BUILD_THRESHOLD) {}
+
+size_t DividedDifferenceEngine::column_offset(size_t j) const {
+    return j * node_count - j * (j - 1) / 2;
+}
+
+void DividedDifferenceEngine::compute(const double* x, const double* y, size_t n) {
+    check_nodes(x, n);
+
+    node_count = n;
+    coefficients.resize(n);
+    diagonal.resize(n);
+    work.assign(y, y + n);
+
+    if (keep_full_table) {
+        packed_table.resize(n * (n + 1) / 2);
+        std::copy(y, y + n, packed_table.begin());
+    } else {
+        packed_table.clear();
+        packed_table.shrink_to_fit();
+    }
+
+    if (n == 0) {
+        return;
+    }
+    coefficients[0] = work[0];
+    diagonal[n-1] = work[n-1];
+
+    size_t first_serial_column = 1;
+    if (n > parallel_threshold && omp_get_max_threads() > 1) {
+        first_serial_column = compute_parallel_columns(x, n);
+    }
+
+    double* w = work.data();
+    for (size_t j = first_serial_column; j < n; j++) {
+        const size_t m = n - j;
+        difference_column(x, j, w, m);
+        coefficients[j] = w[0];
+        diagonal[m-1] = w[m-1];
+
+        if (keep_full_table) {
+            std::copy(w, w + m, packed_table.begin() + column_offset(j));
+        }
+    }
+}
+
+void DividedDifferenceEngine::assign(const double* c, size_t n) {
+    coefficients.assign(c, c + n);
+    packed_table.clear();
+    diagonal.clear();
+    node_count = n;
+}
+
+bool DividedDifferenceEngine::has_diagonal() const {
+    return diagonal.size() == node_count;
+}
+
+size_t DividedDifferenceEngine::compute_parallel_columns(const double* x, size_t n) {
+    // Пока столбец длиннее порога, он делится между потоками. Проход на месте
+    // здесь невозможен (граница между потоками), поэтому столбцы чередуются
+    // между двумя буферами
+    const size_t last_parallel_column = std::min(n - parallel_threshold, n - 1);
+    work_next.resize(n);
+    double* const packed = keep_full_table ? packed_table.data() : nullptr;
+
+    #pragma omp parallel
+    {
+        const double* src = work.data();
+        double* dst = work_next.data();
+        for (size_t j = 1; j <= last_parallel_column; j++) {
+            const long m = static_cast<long>(n - j);
+            const double* x_right = x + j;
+
+            #pragma omp for schedule(static)
+            for (long i = 0; i < m; i++) {
+                dst[i] = (src[i+1] - src[i]) / (x_right[i] - x[i]);
+            }
+
+            #pragma omp single nowait
+            {
+                coefficients[j] = dst[0];
+                diagonal[m-1] = dst[m-1];
+                if (packed) {
+                    std::copy(dst, dst + m, packed + column_offset(j));
+                }
+            }
+
+            double* previous = const_cast<double*>(src);
+            src = dst;
+            dst = previous;
+        }
+    }
+
+    // Последний параллельный столбец записан в work_next при нечетном их числе
+    if (last_parallel_column % 2 == 1) {
+        work.swap(work_next);
+    }
+    return last_parallel_column + 1;
+}
+
+void DividedDifferenceEngine::set_parallel_threshold(size_t threshold) {
+    parallel_threshold = threshold;
+}
+
+size_t DividedDifferenceEngine::get_parallel_threshold() const {
+    return parallel_threshold;
+}
+
+void DividedDifferenceEngine::append(const double* x, double x_new, double y_new) {
+    const size_t n = node_count;
+    for (size_t i = 0; i < n; i++) {
+        if (std::abs(x_new - x[i]) < 1e-10) {
+            throw std::runtime_error("Деление на ноль при вычислении разделенных разностей");
+        }
+    }
+
+    packed_table.clear();
+
+    // Новая диагональ: e_n = y_new, e_i = (e_{i+1} - f[x_i..x_{n-1}]) / (x_new - x_i)
+    diagonal.push_back(y_new);
+    for (size_t i = n; i-- > 0; ) {
+        diagonal[i] = (diagonal[i+1] - diagonal[i]) / (x_new - x[i]);
+    }
+    coefficients.push_back(diagonal[0]);
+    node_count = n + 1;
+}
+
+void DividedDifferenceEngine::drop_front(const double* x) {
+    if (node_count == 0) {
+        throw std::logic_error("Нет узлов для удаления");
+    }
+    const size_t n = node_count;
+
+    packed_table.clear();
+
+    // Чтение c[j+1] опережает запись c[j], поэтому пересчет выполняется на месте
+    double* c = coefficients.data();
+    for (size_t j = 0; j + 1 < n; j++) {
+        c[j] = c[j] + (x[j+1] - x[0]) * c[j+1];
+    }
+    coefficients.pop_back();
+
+    // Элементы диагонали f[x_i..x_{n-1}] при i >= 1 остаются верными
+    diagonal.erase(diagonal.begin());
+    node_count = n - 1;
+}
+
+void DividedDifferenceEngine::clear() {
+    coefficients.clear();
+    work.clear();
+    work_next.clear();
+    packed_table.clear();
+    diagonal.clear();
+    node_count = 0;
+}
+
+void DividedDifferenceEngine::set_keep_full_table(bool keep_table) {
+    keep_full_table = keep_table;
+}
+
+bool DividedDifferenceEngine::get_keep_full_table() const {
+    return keep_full_table;
+}
+
+const AlignedVector<double>& DividedDifferenceEngine::get_coefficients() const {
+    return coefficients;
+}
+
+void DividedDifferenceEngine::swap_coefficients(AlignedVector<double>& other) noexcept {
+    coefficients.swap(other);
+}
+
+double DividedDifferenceEngine::get_divided_difference(size_t i, size_t j) const {
+    if (packed_table.empty()) {
+        throw std::logic_error("Полная таблица разделенных разностей не сохранялась");
+    }
+    if (i + j >= node_count) {
+        throw std::out_of_range("Индекс разделенной разности вне таблицы");
+    }
+    return packed_table[column_offset(j) + i];
+}
+
+size_t DividedDifferenceEngine::size() const {
+    return node_count;
+}
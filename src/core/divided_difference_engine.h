@@ -0,0 +1,225 @@
+/**
+ * @file divided_difference_engine.h
+ * @brief Вычисление коэффициентов полинома Ньютона в непрерывном буфере
+ */
+
+#ifndef DIVIDED_DIFFERENCE_ENGINE_H
+#define DIVIDED_DIFFERENCE_ENGINE_H
+
+#include "aligned_buffer.h"
+#include <cmath>
+#include <cstddef>
+#include <stdexcept>
+
+/**
+ * @brief Длина столбца таблицы, начиная с которой он вычисляется параллельно
+ */
+constexpr size_t DEFAULT_PARALLEL_BUILD_THRESHOLD = 8192;
+
+/**
+ * @class DividedDifferenceEngine
+ * @brief Вычисляет разделенные разности на месте, используя O(n) памяти
+ *
+ * Столбцы таблицы разделенных разностей вычисляются последовательно в одном
+ * рабочем буфере с единичным шагом, коэффициенты полинома Ньютона - первые
+ * элементы столбцов. По запросу вся треугольная таблица сохраняется в
+ * упакованном виде: столбец порядка j занимает n - j подряд идущих элементов.
+ *
+ * Дополнительно хранится последняя диагональ таблицы f[x_i..x_{n-1}], что
+ * позволяет добавлять узел в конец и удалять первый узел за O(n).
+ */
+class DividedDifferenceEngine {
+private:
+    AlignedVector<double> coefficients;  ///< Коэффициенты f[x_0..x_j]
+    AlignedVector<double> work;          ///< Рабочий столбец таблицы
+    AlignedVector<double> work_next;     ///< Второй рабочий буфер для параллельного прохода
+    AlignedVector<double> packed_table;  ///< Упакованная треугольная таблица (опционально)
+    AlignedVector<double> diagonal;      ///< Последняя диагональ f[x_i..x_{n-1}]
+    bool keep_full_table;                ///< Сохранять ли всю таблицу
+    size_t node_count;                   ///< Количество узлов
+    size_t parallel_threshold;           ///< Минимальная длина столбца для параллельного прохода
+
+    /**
+     * @brief Смещение столбца порядка j в упакованной таблице
+     */
+    size_t column_offset(size_t j) const;
+
+    /**
+     * @brief Вычисляет длинные столбцы таблицы параллельно (OpenMP)
+     * @param x Указатель на значения x
+     * @param n Количество узлов
+     * @return Номер первого столбца, который нужно досчитать последовательно
+     */
+    size_t compute_parallel_columns(const double* x, size_t n);
+
+public:
+    /**
+     * @brief Конструктор
+     * @param keep_table Сохранять ли полную треугольную таблицу
+     */
+    explicit DividedDifferenceEngine(bool keep_table = false);
+
+    /**
+     * @brief Проверяет, что соседние отсортированные узлы различны
+     * @tparam Node Тип узлов
+     * @param x Указатель на значения x (по возрастанию)
+     * @param n Количество узлов
+     * @throws std::runtime_error если знаменатель разностей близок к нулю
+     *
+     * Минимальный знаменатель x[i+j] - x[i] достигается на соседних узлах,
+     * поэтому достаточно одной проверки до вычислений.
+     */
+    template <typename Node>
+    static void check_nodes(const Node* x, size_t n) {
+        for (size_t i = 1; i < n; i++) {
+            if (std::abs(x[i] - x[i-1]) < 1e-10) {
+                throw std::runtime_error("Деление на ноль при вычислении разделенных разностей");
+            }
+        }
+    }
+
+    /**
+     * @brief Вычисляет столбец порядка j на месте
+     * @tparam Node Тип узлов
+     * @tparam Value Тип вычислений
+     * @param x Указатель на значения x
+     * @param j Порядок столбца
+     * @param w Столбец порядка j - 1 на входе (m + 1 элементов), порядка j на выходе (m элементов)
+     * @param m Длина столбца порядка j
+     *
+     * Чтение w[i+1] опережает запись w[i], поэтому проход выполняется
+     * на месте с единичным шагом и векторизуется компилятором.
+     */
+    template <typename Node, typename Value>
+    static void difference_column(const Node* x, size_t j, Value* w, size_t m) {
+        const Node* x_right = x + j;
+        for (size_t i = 0; i < m; i++) {
+            w[i] = (w[i+1] - w[i]) / (static_cast<Value>(x_right[i]) - static_cast<Value>(x[i]));
+        }
+    }
+
+    /**
+     * @brief Последовательно вычисляет коэффициенты в произвольной точности
+     * @tparam Node Тип узлов
+     * @tparam Value Тип вычислений
+     * @param x Указатель на значения x (строго возрастающие)
+     * @param w Рабочий буфер со значениями y (n элементов), разрушается
+     * @param c Коэффициенты f[x_0..x_j] (n элементов)
+     * @param n Количество узлов
+     *
+     * Тот же проход по столбцам, что и в compute, но без таблицы, диагонали
+     * и параллельного режима - для интерполяторов в других типах.
+     */
+    template <typename Node, typename Value>
+    static void compute_coefficients(const Node* x, Value* w, Value* c, size_t n) {
+        check_nodes(x, n);
+        if (n == 0) {
+            return;
+        }
+        c[0] = w[0];
+        for (size_t j = 1; j < n; j++) {
+            difference_column(x, j, w, n - j);
+            c[j] = w[0];
+        }
+    }
+
+    /**
+     * @brief Вычисляет коэффициенты по отсортированным узлам
+     * @param x Указатель на значения x (строго возрастающие)
+     * @param y Указатель на значения y
+     * @param n Количество узлов
+     */
+    void compute(const double* x, const double* y, size_t n);
+
+    /**
+     * @brief Устанавливает готовые коэффициенты без построения таблицы
+     * @param c Указатель на коэффициенты f[x_0..x_j]
+     * @param n Количество узлов
+     *
+     * Последняя диагональ не восстанавливается (см. has_diagonal), полная
+     * таблица сбрасывается.
+     */
+    void assign(const double* c, size_t n);
+
+    /**
+     * @brief Проверяет, доступна ли последняя диагональ для append и drop_front
+     */
+    bool has_diagonal() const;
+
+    /**
+     * @brief Добавляет узел в конец таблицы за O(n)
+     * @param x Указатель на текущие значения x (size() элементов)
+     * @param x_new Значение x нового узла
+     * @param y_new Значение y нового узла
+     *
+     * Полная таблица при инкрементальных изменениях не поддерживается и сбрасывается.
+     */
+    void append(const double* x, double x_new, double y_new);
+
+    /**
+     * @brief Удаляет первый узел за O(n)
+     * @param x Указатель на текущие значения x (до удаления узла)
+     *
+     * Коэффициенты пересчитываются по формуле
+     * f[x_1..x_{j+1}] = f[x_0..x_j] + (x_{j+1} - x_0) * f[x_0..x_{j+1}].
+     */
+    void drop_front(const double* x);
+
+    /**
+     * @brief Очищает все буферы
+     */
+    void clear();
+
+    /**
+     * @brief Включает или отключает сохранение полной таблицы
+     * @param keep_table Новое значение режима (вступает в силу при следующем compute)
+     */
+    void set_keep_full_table(bool keep_table);
+
+    /**
+     * @brief Возвращает режим сохранения полной таблицы
+     */
+    bool get_keep_full_table() const;
+
+    /**
+     * @brief Устанавливает порог параллельного построения
+     * @param threshold Столбцы длиннее порога делятся между потоками OpenMP,
+     *                  короткие (и все при малом n) вычисляются последовательно
+     */
+    void set_parallel_threshold(size_t threshold);
+
+    /**
+     * @brief Возвращает порог параллельного построения
+     */
+    size_t get_parallel_threshold() const;
+
+    /**
+     * @brief Возвращает коэффициенты полинома Ньютона
+     */
+    const AlignedVector<double>& get_coefficients() const;
+
+    /**
+     * @brief Обменивает буфер коэффициентов с буфером владельца
+     * @param other Буфер, в котором владелец хранит коэффициенты
+     *
+     * Позволяет хранить коэффициенты вне движка (NewtonInterpolator держит их
+     * в BasicNewtonInterpolator): буфер передается движку на время compute,
+     * assign, append или drop_front и возвращается обратно без копирования.
+     */
+    void swap_coefficients(AlignedVector<double>& other) noexcept;
+
+    /**
+     * @brief Возвращает разделенную разность f[x_i..x_{i+j}]
+     * @param i Индекс первого узла
+     * @param j Порядок разности
+     * @return Значение разделенной разности
+     */
+    double get_divided_difference(size_t i, size_t j) const;
+
+    /**
+     * @brief Возвращает количество узлов
+     */
+    size_t size() const;
+};
+
+#endif // DIVIDED_DIFFERENCE_ENGINE_H
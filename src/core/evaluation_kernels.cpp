@@ -0,0 +1,190 @@
+#include "evaluation_kernels.h"
+#include <stdexcept>
+#include <string>
+#include <algorithm>
+
+#if defined(__x86_64__) || defined(__i386__)
+#define NEWTON_X86_KERNELS 1
+#include <immintrin.h>
+#endif
+
+namespace {
+
+// Ядра продолжают схему Горнера по узлам [begin, end) в порядке убывания:
+// state = state * (t - x_i) + c_i. Каждое ведет две независимые цепочки,
+// чтобы скрыть задержку умножения
+
+void horner_scalar(const double* x, const double* c, size_t begin, size_t end,
+                   const double* points, double* state, size_t count) {
+    for (size_t k = 0; k < count; k++) {
+        const double t = points[k];
+        double p = state[k];
+        for (size_t i = end; i-- > begin; ) {
+            p = p * (t - x[i]) + c[i];
+        }
+        state[k] = p;
+    }
+}
+
+#ifdef NEWTON_X86_KERNELS
+
+__attribute__((target("sse2")))
+void horner_sse2(const double* x, const double* c, size_t begin, size_t end,
+                 const double* points, double* state, size_t count) {
+    size_t k = 0;
+    for (; k + 4 <= count; k += 4) {
+        __m128d t0 = _mm_loadu_pd(points + k);
+        __m128d t1 = _mm_loadu_pd(points + k + 2);
+        __m128d p0 = _mm_loadu_pd(state + k);
+        __m128d p1 = _mm_loadu_pd(state + k + 2);
+        for (size_t i = end; i-- > begin; ) {
+            __m128d xi = _mm_set1_pd(x[i]);
+            __m128d ci = _mm_set1_pd(c[i]);
+            p0 = _mm_add_pd(_mm_mul_pd(p0, _mm_sub_pd(t0, xi)), ci);
+            p1 = _mm_add_pd(_mm_mul_pd(p1, _mm_sub_pd(t1, xi)), ci);
+        }
+        _mm_storeu_pd(state + k, p0);
+        _mm_storeu_pd(state + k + 2, p1);
+    }
+    horner_scalar(x, c, begin, end, points + k, state + k, count - k);
+}
+
+__attribute__((target("avx2,fma")))
+void horner_avx2(const double* x, const double* c, size_t begin, size_t end,
+                 const double* points, double* state, size_t count) {
+    size_t k = 0;
+    for (; k + 8 <= count; k += 8) {
+        __m256d t0 = _mm256_loadu_pd(points + k);
+        __m256d t1 = _mm256_loadu_pd(points + k + 4);
+        __m256d p0 = _mm256_loadu_pd(state + k);
+        __m256d p1 = _mm256_loadu_pd(state + k + 4);
+        for (size_t i = end; i-- > begin; ) {
+            __m256d xi = _mm256_broadcast_sd(x + i);
+            __m256d ci = _mm256_broadcast_sd(c + i);
+            p0 = _mm256_fmadd_pd(p0, _mm256_sub_pd(t0, xi), ci);
+            p1 = _mm256_fmadd_pd(p1, _mm256_sub_pd(t1, xi), ci);
+        }
+        _mm256_storeu_pd(state + k, p0);
+        _mm256_storeu_pd(state + k + 4, p1);
+    }
+    horner_scalar(x, c, begin, end, points + k, state + k, count - k);
+}
+
+__attribute__((target("avx512f")))
+void horner_avx512(const double* x, const double* c, size_t begin, size_t end,
+                   const double* points, double* state, size_t count) {
+    size_t k = 0;
+    for (; k + 16 <= count; k += 16) {
+        __m512d t0 = _mm512_loadu_pd(points + k);
+        __m512d t1 = _mm512_loadu_pd(points + k + 8);
+        __m512d p0 = _mm512_loadu_pd(state + k);
+        __m512d p1 = _mm512_loadu_pd(state + k + 8);
+        for (size_t i = end; i-- > begin; ) {
+            __m512d xi = _mm512_set1_pd(x[i]);
+            __m512d ci = _mm512_set1_pd(c[i]);
+            p0 = _mm512_fmadd_pd(p0, _mm512_sub_pd(t0, xi), ci);
+            p1 = _mm512_fmadd_pd(p1, _mm512_sub_pd(t1, xi), ci);
+        }
+        _mm512_storeu_pd(state + k, p0);
+        _mm512_storeu_pd(state + k + 8, p1);
+    }
+    horner_scalar(x, c, begin, end, points + k, state + k, count - k);
+}
+
+#endif // NEWTON_X86_KERNELS
+
+} // namespace
+
+EvaluationKernel EvaluationKernels::detect_best() {
+    static const EvaluationKernel best = [] {
+        if (is_supported(EvaluationKernel::AVX512)) return EvaluationKernel::AVX512;
+        if (is_supported(EvaluationKernel::AVX2)) return EvaluationKernel::AVX2;
+        if (is_supported(EvaluationKernel::SSE2)) return EvaluationKernel::SSE2;
+        return EvaluationKernel::Scalar;
+    }();
+    return best;
+}
+
+bool EvaluationKernels::is_supported(EvaluationKernel kernel) {
+    switch (kernel) {
+        case EvaluationKernel::Auto:
+        case EvaluationKernel::Scalar:
+            return true;
+#ifdef NEWTON_X86_KERNELS
+        case EvaluationKernel::SSE2:
+            return __builtin_cpu_supports("sse2");
+        case EvaluationKernel::AVX2:
+            return __builtin_cpu_supports("avx2") && __builtin_cpu_supports("fma");
+        case EvaluationKernel::AVX512:
+            return __builtin_cpu_supports("avx512f");
+#endif
+        default:
+            return false;
+    }
+}
+
+EvaluationKernel EvaluationKernels::resolve(EvaluationKernel kernel) {
+    EvaluationKernel resolved = kernel;
+    if (!try_resolve(kernel, resolved)) {
+        throw std::invalid_argument(std::string("Ядро не поддерживается процессором: ") + name(kernel));
+    }
+    return resolved;
+}
+
+bool EvaluationKernels::try_resolve(EvaluationKernel kernel, EvaluationKernel& resolved) noexcept {
+    if (kernel == EvaluationKernel::Auto) {
+        resolved = detect_best();
+        return true;
+    }
+    if (!is_supported(kernel)) {
+        return false;
+    }
+    resolved = kernel;
+    return true;
+}
+
+const char* EvaluationKernels::name(EvaluationKernel kernel) {
+    switch (kernel) {
+        case EvaluationKernel::Auto:   return "auto";
+        case EvaluationKernel::Scalar: return "scalar";
+        case EvaluationKernel::SSE2:   return "sse2";
+        case EvaluationKernel::AVX2:   return "avx2";
+        case EvaluationKernel::AVX512: return "avx512";
+    }
+    return "unknown";
+}
+
+void EvaluationKernels::evaluate(EvaluationKernel kernel,
+                                 const double* x, const double* coefficients, size_t n,
+                                 const double* points, double* results, size_t count) {
+    if (n == 0 || count == 0) {
+        return;
+    }
+    std::fill(results, results + count, coefficients[n-1]);
+    horner_range(kernel, x, coefficients, 0, n - 1, points, results, count);
+}
+
+void EvaluationKernels::horner_range(EvaluationKernel kernel,
+                                     const double* x, const double* coefficients,
+                                     size_t begin, size_t end,
+                                     const double* points, double* state, size_t count) {
+    if (begin >= end || count == 0) {
+        return;
+    }
+    switch (resolve(kernel)) {
+#ifdef NEWTON_X86_KERNELS
+        case EvaluationKernel::SSE2:
+            horner_sse2(x, coefficients, begin, end, points, state, count);
+            break;
+        case EvaluationKernel::AVX2:
+            horner_avx2(x, coefficients, begin, end, points, state, count);
+            break;
+        case EvaluationKernel::AVX512:
+            horner_avx512(x, coefficients, begin, end, points, state, count);
+            break;
+#endif
+        default:
+            horner_scalar(x, coefficients, begin, end, points, state, count);
+            break;
+    }
+}
@@ -0,0 +1,125 @@
+/**
+ * @file evaluation_kernels.h
+ * @brief Векторные ядра вычисления полинома Ньютона с выбором набора инструкций во время выполнения
+ */
+
+#ifndef EVALUATION_KERNELS_H
+#define EVALUATION_KERNELS_H
+
+#include <cstddef>
+
+/**
+ * @brief Ядро вычисления полинома
+ */
+enum class EvaluationKernel {
+    Auto,    ///< Лучшее ядро, поддерживаемое процессором
+    Scalar,  ///< Скалярное ядро (доступно всегда)
+    SSE2,    ///< 2 точки на инструкцию
+    AVX2,    ///< 4 точки на инструкцию (AVX2 + FMA)
+    AVX512   ///< 8 точек на инструкцию (AVX-512F)
+};
+
+/**
+ * @class EvaluationKernels
+ * @brief Вычисление полинома Ньютона по вложенной схеме сразу в нескольких точках
+ *
+ * Полином p(t) = c_0 + (t - x_0)(c_1 + (t - x_1)(c_2 + ...)) вычисляется
+ * по схеме Горнера, каждая векторная инструкция обрабатывает 2/4/8 точек.
+ * Все ядра собираются в одном бинарном файле, подходящее выбирается по CPUID.
+ */
+class EvaluationKernels {
+public:
+    /**
+     * @brief Определяет лучшее ядро для текущего процессора
+     * @return Самое широкое поддерживаемое ядро
+     */
+    static EvaluationKernel detect_best();
+    
+    /**
+     * @brief Проверяет, поддерживает ли процессор ядро
+     * @param kernel Ядро
+     * @return true, если ядро можно использовать
+     */
+    static bool is_supported(EvaluationKernel kernel);
+    
+    /**
+     * @brief Заменяет Auto на конкретное ядро
+     * @param kernel Запрошенное ядро
+     * @return Конкретное ядро
+     */
+    static EvaluationKernel resolve(EvaluationKernel kernel);
+    
+    /**
+     * @brief Заменяет Auto на конкретное ядро без исключений
+     * @param kernel Запрошенное ядро
+     * @param resolved Конкретное ядро (не меняется, если ядро не поддерживается)
+     * @return false, если процессор не поддерживает ядро
+     */
+    static bool try_resolve(EvaluationKernel kernel, EvaluationKernel& resolved) noexcept;
+    
+    /**
+     * @brief Возвращает название ядра
+     * @param kernel Ядро
+     * @return Строка с названием
+     */
+    static const char* name(EvaluationKernel kernel);
+    
+    /**
+     * @brief Вычисляет полином Ньютона в наборе точек
+     * @param kernel Ядро (Auto допускается)
+     * @param x Узлы интерполяции
+     * @param coefficients Коэффициенты полинома Ньютона
+     * @param n Количество узлов
+     * @param points Точки для вычисления
+     * @param results Массив результатов (count элементов)
+     * @param count Количество точек
+     */
+    static void evaluate(EvaluationKernel kernel,
+                         const double* x, const double* coefficients, size_t n,
+                         const double* points, double* results, size_t count);
+    
+    /**
+     * @brief Продолжает схему Горнера по части узлов
+     * @param kernel Ядро (Auto допускается)
+     * @param x Узлы интерполяции
+     * @param coefficients Коэффициенты полинома Ньютона
+     * @param begin Первый узел диапазона
+     * @param end Узел за последним в диапазоне
+     * @param points Точки для вычисления
+     * @param state Частичные суммы (count элементов), обновляются на месте
+     * @param count Количество точек
+     *
+     * Для каждого i от end - 1 до begin выполняет state = state * (t - x_i) + c_i,
+     * что позволяет вычислять полином по блокам узлов.
+     */
+    static void horner_range(EvaluationKernel kernel,
+                             const double* x, const double* coefficients,
+                             size_t begin, size_t end,
+                             const double* points, double* state, size_t count);
+    
+    /**
+     * @brief Переносимое ядро horner_range для произвольных вещественных типов
+     * @tparam Node Тип узлов и коэффициентов
+     * @tparam Value Тип точек и частичных сумм
+     *
+     * Узлы идут во внешнем цикле, точки - во внутреннем: каждая точка
+     * занимает свою SIMD-ленту, поэтому для float лент вдвое больше, чем для
+     * double. Векторизацию выполняет компилятор; для double предпочтительны
+     * ядра horner_range с выбором набора инструкций.
+     */
+    template <typename Node, typename Value>
+    static void horner_lanes(const Node* x, const Node* coefficients,
+                             size_t begin, size_t end,
+                             const Value* points, Value* state, size_t count) {
+        for (size_t i = end; i-- > begin; ) {
+            const Value xi = static_cast<Value>(x[i]);
+            const Value ci = static_cast<Value>(coefficients[i]);
+            #pragma omp simd
+            for (size_t k = 0; k < count; k++) {
+                state[k] = state[k] * (points[k] - xi) + ci;
+            }
+        }
+    }
+};
+
+#endif // EVALUATION_KERNELS_H
@@ -0,0 +1,146 @@
+/**
+ * @file fixed_newton_interpolator.h
+ * @brief Полином Ньютона с числом узлов, известным при компиляции
+ */
+
+#ifndef FIXED_NEWTON_INTERPOLATOR_H
+#define FIXED_NEWTON_INTERPOLATOR_H
+
+#include <array>
+#include <vector>
+#include <cstddef>
+#include <stdexcept>
+
+/**
+ * @class FixedNewtonInterpolator
+ * @brief Интерполяция методом Ньютона по N узлам без динамической памяти
+ * @tparam N Количество узлов
+ *
+ * Узлы и коэффициенты хранятся в std::array, схема Горнера развернута
+ * шаблонной рекурсией. Построение и вычисление - constexpr, поэтому таблица,
+ * объявленная как constexpr, превращается в коэффициенты при компиляции.
+ */
+template <size_t N>
+class FixedNewtonInterpolator {
+    static_assert(N >= 2, "Необходимо как минимум 2 точки для интерполяции");
+
+private:
+    std::array<double, N> x_values{};      ///< Отсортированные узлы
+    std::array<double, N> coefficients{};  ///< Коэффициенты полинома Ньютона
+
+    /**
+     * @brief Шаг схемы Горнера для узла I - 1 и всех предыдущих
+     */
+    template <size_t I>
+    constexpr double horner(double result, double point) const {
+        if constexpr (I == 0) {
+            return result;
+        } else {
+            return horner<I - 1>(result * (point - x_values[I - 1]) + coefficients[I - 1], point);
+        }
+    }
+
+public:
+    /**
+     * @brief Конструктор по умолчанию (нулевой полином)
+     */
+    constexpr FixedNewtonInterpolator() = default;
+
+    /**
+     * @brief Конструктор с инициализацией данными
+     * @param x Значения x
+     * @param y Значения y
+     */
+    constexpr FixedNewtonInterpolator(const std::array<double, N>& x, const std::array<double, N>& y) {
+        set_data(x, y);
+    }
+
+    /**
+     * @brief Устанавливает данные для интерполяции
+     * @param x Значения x
+     * @param y Значения y
+     *
+     * Узлы сортируются вставками; совпадающие узлы вызывают исключение
+     * (при вычислении на этапе компиляции - ошибку компиляции).
+     */
+    constexpr void set_data(const std::array<double, N>& x, const std::array<double, N>& y) {
+        x_values = x;
+        coefficients = y;
+        for (size_t i = 1; i < N; i++) {
+            double xi = x_values[i];
+            double yi = coefficients[i];
+            size_t j = i;
+            while (j > 0 && x_values[j - 1] > xi) {
+                x_values[j] = x_values[j - 1];
+                coefficients[j] = coefficients[j - 1];
+                j--;
+            }
+            x_values[j] = xi;
+            coefficients[j] = yi;
+        }
+        for (size_t i = 1; i < N; i++) {
+            if (x_values[i] - x_values[i - 1] < 1e-10) {
+                throw std::runtime_error("Деление на ноль при вычислении разделенных разностей");
+            }
+        }
+
+        #pragma GCC unroll 32
+        for (size_t j = 1; j < N; j++) {
+            #pragma GCC unroll 32
+            for (size_t i = N - 1; i >= j; i--) {
+                coefficients[i] = (coefficients[i] - coefficients[i - 1]) / (x_values[i] - x_values[i - j]);
+            }
+        }
+    }
+
+    /**
+     * @brief Выполняет интерполяцию в точке
+     * @param point Точка для интерполяции
+     * @return Интерполированное значение
+     */
+    constexpr double interpolate(double point) const {
+        return horner<N - 1>(coefficients[N - 1], point);
+    }
+
+    /**
+     * @brief Вычисляет полином в массиве точек с использованием OpenMP
+     * @param points Точки
+     * @param results Результаты (count элементов)
+     * @param count Количество точек
+     */
+    void interpolate_multiple(const double* points, double* results, size_t count) const {
+        const long num_points = static_cast<long>(count);
+
+        #pragma omp parallel for simd schedule(static)
+        for (long i = 0; i < num_points; i++) {
+            results[i] = interpolate(points[i]);
+        }
+    }
+
+    /**
+     * @brief Выполняет интерполяцию для множества точек с использованием OpenMP
+     * @param points Вектор точек для интерполяции
+     * @return Вектор интерполированных значений
+     */
+    std::vector<double> interpolate_multiple(const std::vector<double>& points) const {
+        std::vector<double> results(points.size());
+        interpolate_multiple(points.data(), results.data(), points.size());
+        return results;
+    }
+
+    /**
+     * @brief Возвращает коэффициенты полинома Ньютона
+     */
+    constexpr const std::array<double, N>& get_coefficients() const {
+        return coefficients;
+    }
+
+    /**
+     * @brief Возвращает количество узлов
+     */
+    static constexpr size_t get_node_count() {
+        return N;
+    }
+};
+
+#endif // FIXED_NEWTON_INTERPOLATOR_H
@@ -0,0 +1,119 @@
+#include "gnuplot_process.h"
+#include <stdexcept>
+
+#ifndef _WIN32
+#include <csignal>
+#include <ctime>
+#include <pthread.h>
+#include <sys/wait.h>
+#endif
+
+namespace {
+
+/**
+ * @brief Блокирует SIGPIPE в текущем потоке на время записи в канал
+ *
+ * Без блокировки запись в канал завершившегося gnuplot прерывает всю
+ * программу. Сигнал, возникший во время записи, снимается до
+ * восстановления маски, а ошибка возвращается вызовом записи (EPIPE).
+ */
+class SigpipeGuard {
+#ifndef _WIN32
+private:
+    sigset_t previous_mask;
+    bool was_pending;
+
+public:
+    SigpipeGuard() {
+        sigset_t pending;
+        sigemptyset(&pending);
+        sigpending(&pending);
+        was_pending = sigismember(&pending, SIGPIPE) == 1;
+
+        sigset_t block;
+        sigemptyset(&block);
+        sigaddset(&block, SIGPIPE);
+        pthread_sigmask(SIG_BLOCK, &block, &previous_mask);
+    }
+
+    ~SigpipeGuard() {
+        if (!was_pending) {
+            sigset_t pending;
+            sigemptyset(&pending);
+            sigpending(&pending);
+            if (sigismember(&pending, SIGPIPE) == 1) {
+                sigset_t sigpipe;
+                sigemptyset(&sigpipe);
+                sigaddset(&sigpipe, SIGPIPE);
+                const timespec no_wait = {0, 0};
+                sigtimedwait(&sigpipe, nullptr, &no_wait);
+            }
+        }
+        pthread_sigmask(SIG_SETMASK, &previous_mask, nullptr);
+    }
+#endif
+};
+
+} // namespace
+
+GnuplotProcess::GnuplotProcess(const std::string& command) : pipe(nullptr), broken(false) {
+#ifdef _WIN32
+    pipe = _popen(command.c_str(), "wb");
+#else
+    pipe = popen(command.c_str(), "w");
+#endif
+    if (pipe == nullptr) {
+        throw std::runtime_error("Не удалось запустить gnuplot");
+    }
+}
+
+GnuplotProcess::~GnuplotProcess() {
+    close();
+}
+
+void GnuplotProcess::send(std::string_view text) {
+    send_binary(text.data(), text.size());
+}
+
+void GnuplotProcess::send_binary(const void* data, size_t bytes) {
+    if (pipe == nullptr) {
+        throw std::logic_error("Канал gnuplot закрыт");
+    }
+    SigpipeGuard guard;
+    if (broken || std::fwrite(data, 1, bytes, pipe) != bytes) {
+        broken = true;
+        throw std::runtime_error("gnuplot завершился до окончания передачи. Убедитесь, что gnuplot установлен в системе.");
+    }
+}
+
+void GnuplotProcess::flush() {
+    if (pipe == nullptr) {
+        throw std::logic_error("Канал gnuplot закрыт");
+    }
+    SigpipeGuard guard;
+    if (broken || std::fflush(pipe) != 0) {
+        broken = true;
+        throw std::runtime_error("gnuplot завершился до окончания передачи. Убедитесь, что gnuplot установлен в системе.");
+    }
+}
+
+int GnuplotProcess::close() {
+    if (pipe == nullptr) {
+        return 0;
+    }
+    SigpipeGuard guard;
+#ifdef _WIN32
+    int status = _pclose(pipe);
+#else
+    int status = pclose(pipe);
+    if (status != -1 && WIFEXITED(status)) {
+        status = WEXITSTATUS(status);
+    }
+#endif
+    pipe = nullptr;
+    return broken && status == 0 ? -1 : status;
+}
+
+bool GnuplotProcess::is_open() const {
+    return pipe != nullptr;
+}
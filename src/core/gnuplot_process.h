@@ -0,0 +1,86 @@
+/**
+ * @file gnuplot_process.h
+ * @brief Процесс gnuplot, получающий скрипт и данные через канал (popen)
+ */
+
+#ifndef GNUPLOT_PROCESS_H
+#define GNUPLOT_PROCESS_H
+
+#include <cstddef>
+#include <cstdio>
+#include <string>
+#include <string_view>
+
+/**
+ * @brief Команда запуска gnuplot по умолчанию (сообщения gnuplot подавляются)
+ */
+#ifdef _WIN32
+constexpr const char* DEFAULT_GNUPLOT_COMMAND = "gnuplot 2>nul";
+#else
+constexpr const char* DEFAULT_GNUPLOT_COMMAND = "gnuplot 2>/dev/null";
+#endif
+
+/**
+ * @class GnuplotProcess
+ * @brief Запущенный gnuplot со стандартным вводом, открытым на запись
+ *
+ * Скрипты и данные передаются в канал без временных файлов. Если gnuplot
+ * не установлен или завершился из-за ошибки в скрипте, запись в канал
+ * возвращает ошибку (SIGPIPE на время записи блокируется), а close
+ * возвращает ненулевой код.
+ */
+class GnuplotProcess {
+private:
+    FILE* pipe;   ///< Канал к стандартному вводу gnuplot
+    bool broken;  ///< Запись в канал завершилась ошибкой
+
+public:
+    /**
+     * @brief Запускает gnuplot
+     * @param command Команда запуска
+     * @throws std::runtime_error если процесс не запускается
+     */
+    explicit GnuplotProcess(const std::string& command = DEFAULT_GNUPLOT_COMMAND);
+
+    GnuplotProcess(const GnuplotProcess&) = delete;
+    GnuplotProcess& operator=(const GnuplotProcess&) = delete;
+
+    /**
+     * @brief Закрывает канал и ожидает завершения gnuplot
+     */
+    ~GnuplotProcess();
+
+    /**
+     * @brief Передает текст скрипта или встроенных данных
+     * @param text Текст
+     * @throws std::runtime_error если gnuplot уже завершился
+     */
+    void send(std::string_view text);
+
+    /**
+     * @brief Передает двоичные данные (для plot '-' binary)
+     * @param data Начало данных
+     * @param bytes Размер в байтах
+     * @throws std::runtime_error если gnuplot уже завершился
+     */
+    void send_binary(const void* data, size_t bytes);
+
+    /**
+     * @brief Сбрасывает буфер канала
+     * @throws std::runtime_error если gnuplot уже завершился
+     */
+    void flush();
+
+    /**
+     * @brief Закрывает канал и ожидает завершения gnuplot
+     * @return Код завершения (0 - все скрипты выполнены успешно)
+     */
+    int close();
+
+    /**
+     * @brief Проверяет, открыт ли канал
+     */
+    bool is_open() const;
+};
+
+#endif // GNUPLOT_PROCESS_H
@@ -0,0 +1,103 @@
+#include "gnuplot_session.h"
+#include <stdexcept>
+#include <utility>
+
+GnuplotSession::GnuplotSession(bool asynchronous, const std::string& command)
+    : process(command), asynchronous(asynchronous), sending(false), stopping(false) {
+    if (asynchronous) {
+        worker = std::thread(&GnuplotSession::worker_loop, this);
+    }
+}
+
+GnuplotSession::~GnuplotSession() {
+    try {
+        close();
+    } catch (const std::exception&) {
+        // Деструктор не бросает исключений; ошибку gnuplot сообщает явный close
+    }
+}
+
+void GnuplotSession::worker_loop() {
+    std::unique_lock<std::mutex> lock(mutex);
+    while (true) {
+        changed.wait(lock, [this] { return stopping || !pending.empty(); });
+        if (pending.empty()) {
+            return;
+        }
+        std::string script = std::move(pending.front());
+        pending.pop_front();
+        sending = true;
+        lock.unlock();
+        try {
+            process.send(script);
+            process.flush();
+        } catch (...) {
+            lock.lock();
+            error = std::current_exception();
+            pending.clear();
+            sending = false;
+            changed.notify_all();
+            continue;
+        }
+        lock.lock();
+        sending = false;
+        changed.notify_all();
+    }
+}
+
+void GnuplotSession::rethrow_error() {
+    if (error) {
+        std::exception_ptr failure = std::exchange(error, nullptr);
+        std::rethrow_exception(failure);
+    }
+}
+
+void GnuplotSession::submit(std::string script) {
+    if (!process.is_open()) {
+        throw std::logic_error("Сессия gnuplot закрыта");
+    }
+    if (!asynchronous) {
+        process.send(script);
+        process.flush();
+        return;
+    }
+    std::lock_guard<std::mutex> lock(mutex);
+    rethrow_error();
+    pending.push_back(std::move(script));
+    changed.notify_all();
+}
+
+void GnuplotSession::wait() {
+    if (!asynchronous) {
+        return;
+    }
+    std::unique_lock<std::mutex> lock(mutex);
+    changed.wait(lock, [this] { return pending.empty() && !sending; });
+    rethrow_error();
+}
+
+void GnuplotSession::close() {
+    if (!process.is_open()) {
+        return;
+    }
+    if (worker.joinable()) {
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            stopping = true;
+        }
+        changed.notify_all();
+        worker.join();
+    }
+    const int status = process.close();
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        rethrow_error();
+    }
+    if (status != 0) {
+        throw std::runtime_error("Ошибка при выполнении gnuplot. Убедитесь, что gnuplot установлен в системе.");
+    }
+}
+
+bool GnuplotSession::is_asynchronous() const {
+    return asynchronous;
+}
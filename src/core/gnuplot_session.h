@@ -0,0 +1,94 @@
+/**
+ * @file gnuplot_session.h
+ * @brief Долгоживущий процесс gnuplot для серии графиков с фоновой отрисовкой
+ */
+
+#ifndef GNUPLOT_SESSION_H
+#define GNUPLOT_SESSION_H
+
+#include "gnuplot_process.h"
+#include <condition_variable>
+#include <deque>
+#include <exception>
+#include <mutex>
+#include <string>
+#include <thread>
+
+/**
+ * @class GnuplotSession
+ * @brief Один процесс gnuplot на много графиков
+ *
+ * Каждый график - самостоятельный скрипт со встроенными данными (datablock),
+ * поэтому параллельные запуски не делят файлы, а запуск gnuplot и оболочки
+ * оплачивается один раз на сессию. В асинхронном режиме скрипты передаются
+ * фоновым потоком и submit не ждет gnuplot; ошибка фонового потока
+ * передается при следующем submit, wait или close.
+ *
+ * Файлы графиков гарантированно записаны после close.
+ */
+class GnuplotSession {
+private:
+    GnuplotProcess process;          ///< Процесс gnuplot
+    bool asynchronous;               ///< Передавать скрипты фоновым потоком
+    std::thread worker;              ///< Фоновый поток (в асинхронном режиме)
+    std::mutex mutex;                ///< Защита очереди и состояния
+    std::condition_variable changed; ///< Изменение очереди или состояния
+    std::deque<std::string> pending; ///< Скрипты, ожидающие передачи
+    bool sending;                    ///< Фоновый поток передает скрипт
+    bool stopping;                   ///< Сессия закрывается
+    std::exception_ptr error;        ///< Ошибка фонового потока
+
+    /**
+     * @brief Цикл фонового потока
+     */
+    void worker_loop();
+
+    /**
+     * @brief Передает ошибку фонового потока вызывающему (однократно)
+     */
+    void rethrow_error();
+
+public:
+    /**
+     * @brief Запускает gnuplot
+     * @param asynchronous Передавать скрипты фоновым потоком
+     * @param command Команда запуска gnuplot
+     * @throws std::runtime_error если процесс не запускается
+     */
+    explicit GnuplotSession(bool asynchronous = false, const std::string& command = DEFAULT_GNUPLOT_COMMAND);
+
+    GnuplotSession(const GnuplotSession&) = delete;
+    GnuplotSession& operator=(const GnuplotSession&) = delete;
+
+    /**
+     * @brief Закрывает сессию без исключений
+     */
+    ~GnuplotSession();
+
+    /**
+     * @brief Отправляет скрипт графика
+     * @param script Полный скрипт (см. GnuplotVisualizer::speedup_script)
+     * @throws std::runtime_error если gnuplot завершился
+     * @throws std::logic_error если сессия закрыта
+     */
+    void submit(std::string script);
+
+    /**
+     * @brief Ожидает передачи всех отправленных скриптов
+     * @throws std::runtime_error если gnuplot завершился
+     */
+    void wait();
+
+    /**
+     * @brief Передает оставшиеся скрипты и завершает gnuplot
+     * @throws std::runtime_error если gnuplot завершился с ошибкой
+     */
+    void close();
+
+    /**
+     * @brief Проверяет, передает ли сессия скрипты фоновым потоком
+     */
+    bool is_asynchronous() const;
+};
+
+#endif // GNUPLOT_SESSION_H
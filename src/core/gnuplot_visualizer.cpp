@@ -1,25 +1,43 @@
 #include "gnuplot_visualizer.h"
-#include <cstdlib>
 #include <stdexcept>
 #include <algorithm>
+#include <cmath>
+#include <sstream>
 
-void GnuplotVisualizer::save_data_to_file(const std::vector<double>& x, 
-                                        const std::vector<double>& y, 
-                                        const std::string& filename) {
-    std::ofstream file(filename);
-    if (!file.is_open()) {
-        throw std::runtime_error("Не удалось открыть файл: " + filename);
+namespace {
+
+/**
+ * @brief Заключает строку в одинарные кавычки gnuplot
+ */
+std::string quoted(const std::string& text) {
+    std::string result = "'";
+    for (char c : text) {
+        result += c;
+        if (c == '\'') {
+            result += '\'';
+        }
     }
-    
-    for (size_t i = 0; i < x.size(); i++) {
-        file << x[i] << " " << y[i] << "\n";
+    return result + "'";
+}
+
+/**
+ * @brief Экранирует % для формата sprintf gnuplot
+ */
+std::string escaped_percent(const std::string& text) {
+    std::string result;
+    for (char c : text) {
+        result += c;
+        if (c == '%') {
+            result += '%';
+        }
     }
-    file.close();
+    return result;
 }
 
-void GnuplotVisualizer::plot_speedup(const std::vector<int>& threads, 
-                                   const std::vector<double>& speedups,
-                                   const std::string& filename) {
+/**
+ * @brief Проверяет данные графика ускорения
+ */
+void validate_speedups(const std::vector<int>& threads, const std::vector<double>& speedups) {
     if (threads.empty() || speedups.empty()) {
         throw std::invalid_argument("Векторы threads и speedups не могут быть пустыми");
     }
@@ -27,43 +45,286 @@ void GnuplotVisualizer::plot_speedup(const std::vector<int>& threads,
     if (threads.size() != speedups.size()) {
         throw std::invalid_argument("Размеры векторов threads и speedups должны совпадать");
     }
-    
-    std::ofstream data_file("speedup_data.txt");
+}
+
+/**
+ * @brief Добавляет блок данных ускорения и его график
+ */
+void append_speedup_plot(std::ostringstream& script, const std::vector<int>& threads,
+                         const std::vector<double>& speedups, const std::string& title) {
+    script << "$speedup << EOD\n";
     for (size_t i = 0; i < threads.size(); i++) {
-        data_file << threads[i] << " " << speedups[i] << "\n";
-    }
-    data_file.close();
-    
-    std::ofstream script("plot_speedup.gp");
-    if (!script.is_open()) {
-        remove("speedup_data.txt");
-        throw std::runtime_error("Не удалось создать файл скрипта gnuplot");
+        script << threads[i] << " " << speedups[i] << "\n";
     }
-    
-    script << "set terminal pngcairo size 1200,800 enhanced font 'Arial,12'\n";
-    script << "set output '" << filename << "'\n";
-    script << "set title 'Зависимость ускорения многопоточной программы по сравнению с 1 потоком'\n";
+    script << "EOD\n";
+    script << "set title " << quoted(title) << "\n";
     script << "set xlabel 'Количество потоков'\n";
     script << "set ylabel 'Ускорение'\n";
     script << "set grid\n";
     script << "set key top left\n";
     script << "set xrange [0:" << threads.back() << "]\n";
     script << "set yrange [0:" << threads.back() << "]\n";
-    script << "plot 'speedup_data.txt' with linespoints pt 7 ps 2 lc rgb 'red' lw 2 title 'Измеренное ускорение', \\\n";
+    script << "plot $speedup with linespoints pt 7 ps 2 lc rgb 'red' lw 2 title 'Измеренное ускорение', \\\n";
     script << "     x with lines lw 2 lc rgb 'blue' title 'Линейное ускорение'\n";
-    script.close();
+}
+
+/**
+ * @brief Описание двоичного источника из count записей (x, y)
+ */
+std::string binary_source(size_t count) {
+    return "'-' binary record=(" + std::to_string(count) + ") format='%float64%float64' using 1:2";
+}
+
+/**
+ * @brief Добавляет к скрипту записи (x, y) в двоичном виде
+ */
+void append_binary_records(std::string& script, std::span<const double> x, std::span<const double> y) {
+    std::vector<double> records(2 * x.size());
+    for (size_t i = 0; i < x.size(); i++) {
+        records[2 * i] = x[i];
+        records[2 * i + 1] = y[i];
+    }
+    script.append(reinterpret_cast<const char*>(records.data()), records.size() * sizeof(double));
+}
+
+} // namespace
+
+void GnuplotVisualizer::run_script(const std::string& script) {
+    GnuplotSession session;
+    session.submit(script);
+    session.close();
+}
+
+std::string GnuplotVisualizer::speedup_script(const std::vector<int>& threads,
+                                              const std::vector<double>& speedups,
+                                              const std::string& filename) {
+    validate_speedups(threads, speedups);
+    
+    std::ostringstream script;
+    script << "reset\n";
+    script << "set terminal pngcairo size 1200,800 enhanced font 'Arial,12'\n";
+    script << "set output " << quoted(filename) << "\n";
+    append_speedup_plot(script, threads, speedups,
+                        "Зависимость ускорения многопоточной программы по сравнению с 1 потоком");
+    script << "unset output\n";
+    return script.str();
+}
+
+std::string GnuplotVisualizer::utilization_script(const std::vector<int>& threads,
+                                                  const std::vector<double>& speedups,
+                                                  const BatchTelemetry& telemetry,
+                                                  const std::string& filename) {
+    validate_speedups(threads, speedups);
+    
+    if (telemetry.threads.empty() || telemetry.wall_ms <= 0.0) {
+        throw std::invalid_argument("Телеметрия пакета не содержит данных о потоках");
+    }
+    
+    std::ostringstream script;
+    script << "reset\n";
+    script << "set terminal pngcairo size 1800,800 enhanced font 'Arial,12'\n";
+    script << "set output " << quoted(filename) << "\n";
+    script << "$utilization << EOD\n";
+    for (const ThreadTelemetry& thread : telemetry.threads) {
+        script << thread.thread << " "
+               << 100.0 * thread.busy_ms / telemetry.wall_ms << " "
+               << 100.0 * thread.startup_ms / telemetry.wall_ms << " "
+               << 100.0 * thread.wait_ms / telemetry.wall_ms << "\n";
+    }
+    script << "EOD\n";
+    script << "set multiplot layout 1,2\n";
+    append_speedup_plot(script, threads, speedups, "Ускорение по сравнению с 1 потоком");
+    script << "set title sprintf('Загрузка потоков (дисбаланс %.2f)', " << telemetry.imbalance() << ")\n";
+    script << "set xlabel 'Поток'\n";
+    script << "set ylabel 'Доля времени пакета, %'\n";
+    script << "set autoscale x\n";
+    script << "set yrange [0:100]\n";
+    script << "set style data histograms\n";
+    script << "set style histogram rowstacked\n";
+    script << "set style fill solid 0.8 border -1\n";
+    script << "set boxwidth 0.7\n";
+    script << "set key top right\n";
+    script << "plot $utilization using 2:xtic(1) lc rgb 'forest-green' title 'Работа', \\\n";
+    script << "     '' using 3 lc rgb 'orange' title 'Запуск', \\\n";
+    script << "     '' using 4 lc rgb 'gray' title 'Ожидание на барьере'\n";
+    script << "unset multiplot\n";
+    script << "unset output\n";
+    return script.str();
+}
+
+void GnuplotVisualizer::plot_speedup(const std::vector<int>& threads, 
+                                   const std::vector<double>& speedups,
+                                   const std::string& filename) {
+    run_script(speedup_script(threads, speedups, filename));
+}
+
+void GnuplotVisualizer::plot_speedup(GnuplotSession& session,
+                                     const std::vector<int>& threads,
+                                     const std::vector<double>& speedups,
+                                     const std::string& filename) {
+    session.submit(speedup_script(threads, speedups, filename));
+}
+
+void GnuplotVisualizer::plot_speedup_with_utilization(const std::vector<int>& threads,
+                                                      const std::vector<double>& speedups,
+                                                      const BatchTelemetry& telemetry,
+                                                      const std::string& filename) {
+    run_script(utilization_script(threads, speedups, telemetry, filename));
+}
+
+void GnuplotVisualizer::plot_speedup_with_utilization(GnuplotSession& session,
+                                                      const std::vector<int>& threads,
+                                                      const std::vector<double>& speedups,
+                                                      const BatchTelemetry& telemetry,
+                                                      const std::string& filename) {
+    session.submit(utilization_script(threads, speedups, telemetry, filename));
+}
+
+std::string GnuplotVisualizer::scaling_script(const std::vector<ScalingSeries>& series, const std::string& filename,
+                                              ScalingBand band) {
+    if (series.empty()) {
+        throw std::invalid_argument("Нет серий измерений для графика масштабируемости");
+    }
+    int max_threads = 1;
+    for (const ScalingSeries& run : series) {
+        if (run.points.empty()) {
+            throw std::invalid_argument("Серия " + run.label + " не содержит измерений");
+        }
+        for (const ScalingPoint& point : run.points) {
+            max_threads = std::max(max_threads, point.threads);
+        }
+    }
+    
+    std::ostringstream script;
+    script << "reset\n";
+    script << "set terminal pngcairo size 2400,800 enhanced font 'Arial,12'\n";
+    script << "set output " << quoted(filename) << "\n";
+    for (size_t s = 0; s < series.size(); s++) {
+        script << "$scaling" << s << " << EOD\n";
+        for (const ScalingPoint& point : series[s].points) {
+            const double low = band == ScalingBand::MinMax ? point.speedup_min : point.speedup_low;
+            const double high = band == ScalingBand::MinMax ? point.speedup_max : point.speedup_high;
+            script << point.threads << " " << point.speedup << " " << low << " " << high << " "
+                   << point.efficiency << " ";
+            if (std::isnan(point.karp_flatt)) {
+                script << "NaN\n";
+            } else {
+                script << point.karp_flatt << "\n";
+            }
+        }
+        script << "EOD\n";
+    }
+    script << "set multiplot layout 1,3\n";
+    script << "set grid\n";
+    script << "set key top left\n";
+    script << "set xlabel 'Количество потоков'\n";
+    script << "set xrange [0:" << max_threads << "]\n";
+    script << "set style fill transparent solid 0.2 noborder\n";
+    
+    script << "set title " << quoted(band == ScalingBand::MinMax ? "Ускорение (медиана, минимум и максимум)"
+                                                                  : "Ускорение (медиана, 95% доверительный интервал)")
+           << "\n";
+    script << "set ylabel 'Ускорение'\n";
+    script << "set yrange [0:" << max_threads << "]\n";
+    script << "plot ";
+    for (size_t s = 0; s < series.size(); s++) {
+        const double f = series[s].serial_fraction;
+        script << "$scaling" << s << " using 1:3:4 with filledcurves lc " << s + 1 << " notitle, \\\n     ";
+        script << "$scaling" << s << " using 1:2 with linespoints pt 7 ps 1.5 lw 2 lc " << s + 1
+               << " title " << quoted(series[s].label) << ", \\\n     ";
+        script << "1.0 / (" << f << " + " << 1.0 - f << " / x) with lines dt 2 lw 2 lc " << s + 1
+               << " title sprintf(" << quoted(escaped_percent(series[s].label) + ": Амдал, f = %.3f") << ", "
+               << f << "), \\\n     ";
+    }
+    script << "x with lines lw 1 dt 3 lc rgb 'black' title 'Линейное ускорение'\n";
     
-#ifdef _WIN32
-    int result = system("gnuplot plot_speedup.gp 2>nul");
-#else
-    int result = system("gnuplot plot_speedup.gp 2>/dev/null");
-#endif
-    if (result != 0) {
-        remove("speedup_data.txt");
-        remove("plot_speedup.gp");
-        throw std::runtime_error("Ошибка при выполнении gnuplot. Убедитесь, что gnuplot установлен в системе.");
+    script << "set title 'Параллельная эффективность'\n";
+    script << "set ylabel 'Ускорение / потоки'\n";
+    script << "set yrange [0:*]\n";
+    script << "plot ";
+    for (size_t s = 0; s < series.size(); s++) {
+        script << "$scaling" << s << " using 1:5 with linespoints pt 7 ps 1.5 lw 2 lc " << s + 1
+               << " title " << quoted(series[s].label) << ", \\\n     ";
     }
+    script << "1 with lines lw 1 dt 3 lc rgb 'black' title 'Идеальная'\n";
     
-    remove("speedup_data.txt");
-    remove("plot_speedup.gp");
-}
\ No newline at end of file
+    script << "set title 'Метрика Карпа-Флэтта (последовательная доля)'\n";
+    script << "set ylabel 'e'\n";
+    script << "set autoscale y\n";
+    script << "plot ";
+    for (size_t s = 0; s < series.size(); s++) {
+        script << (s > 0 ? ", \\\n     " : "") << "$scaling" << s
+               << " using 1:6 with linespoints pt 7 ps 1.5 lw 2 lc " << s + 1
+               << " title " << quoted(series[s].label);
+    }
+    script << "\n";
+    script << "unset multiplot\n";
+    script << "unset output\n";
+    return script.str();
+}
+
+void GnuplotVisualizer::plot_scaling(const std::vector<ScalingSeries>& series, const std::string& filename,
+                                     ScalingBand band) {
+    run_script(scaling_script(series, filename, band));
+}
+
+void GnuplotVisualizer::plot_scaling(GnuplotSession& session, const std::vector<ScalingSeries>& series,
+                                     const std::string& filename, ScalingBand band) {
+    session.submit(scaling_script(series, filename, band));
+}
+
+std::string GnuplotVisualizer::interpolation_script(std::span<const double> nodes_x, std::span<const double> nodes_y,
+                                                    std::span<const double> curve_x, std::span<const double> curve_y,
+                                                    const std::string& filename, const CurvePlotOptions& options) {
+    if (nodes_x.size() != nodes_y.size()) {
+        throw std::invalid_argument("Размеры векторов узлов должны совпадать");
+    }
+    if (curve_x.empty()) {
+        throw std::invalid_argument("Кривая не содержит точек");
+    }
+    if (options.width == 0 || options.height == 0) {
+        throw std::invalid_argument("Размер изображения должен быть положительным");
+    }
+    
+    std::vector<double> plot_x;
+    std::vector<double> plot_y;
+    CurveDecimator::decimate(options.decimation, curve_x, curve_y, options.width, plot_x, plot_y);
+    
+    std::ostringstream header;
+    header << "reset\n";
+    header << "set terminal pngcairo size " << options.width << "," << options.height
+           << " enhanced font 'Arial,12'\n";
+    header << "set output " << quoted(filename) << "\n";
+    header << "set title " << quoted(options.title) << "\n";
+    header << "set xlabel 'x'\n";
+    header << "set ylabel 'y'\n";
+    header << "set grid\n";
+    header << "set key top left\n";
+    header << "plot " << binary_source(plot_x.size()) << " with lines lw 2 lc rgb 'blue' title "
+           << quoted("Интерполянт (" + std::to_string(plot_x.size()) + " из " +
+                     std::to_string(curve_x.size()) + " точек)");
+    if (!nodes_x.empty()) {
+        header << ", \\\n     " << binary_source(nodes_x.size())
+               << " with points pt 7 ps 1.5 lc rgb 'red' title 'Узлы'";
+    }
+    header << "\n";
+    
+    std::string script = header.str();
+    append_binary_records(script, plot_x, plot_y);
+    append_binary_records(script, nodes_x, nodes_y);
+    script += "unset output\n";
+    return script;
+}
+
+void GnuplotVisualizer::plot_interpolation(std::span<const double> nodes_x, std::span<const double> nodes_y,
+                                           std::span<const double> curve_x, std::span<const double> curve_y,
+                                           const std::string& filename, const CurvePlotOptions& options) {
+    run_script(interpolation_script(nodes_x, nodes_y, curve_x, curve_y, filename, options));
+}
+
+void GnuplotVisualizer::plot_interpolation(GnuplotSession& session,
+                                           std::span<const double> nodes_x, std::span<const double> nodes_y,
+                                           std::span<const double> curve_x, std::span<const double> curve_y,
+                                           const std::string& filename, const CurvePlotOptions& options) {
+    session.submit(interpolation_script(nodes_x, nodes_y, curve_x, curve_y, filename, options));
+}
@@ -2,13 +2,45 @@
  * @file gnuplot_visualizer.h
  * @brief Класс для визуализации результатов с помощью Gnuplot
  */
+#ifndef GNUPLOT_VISUALIZER_H
+#define GNUPLOT_VISUALIZER_H
+
 #include <vector>
+#include <span>
 #include <string>
-#include <fstream>
+#include "batch_telemetry.h"
+#include "curve_decimator.h"
+#include "gnuplot_session.h"
+#include "scaling_analysis.h"
+
+/**
+ * @brief Параметры графика интерполянта
+ */
+struct CurvePlotOptions {
+    size_t width = 1200;                                     ///< Ширина изображения в пикселях
+    size_t height = 800;                                     ///< Высота изображения в пикселях
+    DecimationMethod decimation = DecimationMethod::MinMax;  ///< Прореживание кривой до ширины
+    std::string title = "Интерполяционный многочлен Ньютона"; ///< Заголовок графика
+};
+
+/**
+ * @brief Полоса разброса ускорения на графике масштабируемости
+ */
+enum class ScalingBand {
+    MinMax,     ///< От самого медленного до самого быстрого прогона
+    Confidence  ///< 95% доверительный интервал медианы
+};
 
 /**
  * @class GnuplotVisualizer
  * @brief Класс для создания графиков с помощью Gnuplot
+ *
+ * Скрипты содержат данные во встроенных блоках ($data << EOD) и передаются
+ * gnuplot через канал, временные файлы в рабочем каталоге не создаются;
+ * кривые интерполянта передаются двоичными записями после команды plot.
+ * Методы без сессии запускают отдельный gnuplot на каждый график; методы
+ * с GnuplotSession используют один процесс на серию графиков и, в
+ * асинхронной сессии, не ждут отрисовки.
  */
 class GnuplotVisualizer {
 public:
@@ -22,14 +54,125 @@ public:
                            const std::vector<double>& speedups,
                            const std::string& filename);
     
+    /**
+     * @brief Строит график ускорения в открытой сессии gnuplot
+     * @param session Сессия gnuplot
+     * @param threads Вектор количества потоков
+     * @param speedups Вектор значений ускорения
+     * @param filename Имя файла для сохранения графика
+     */
+    static void plot_speedup(GnuplotSession& session,
+                             const std::vector<int>& threads,
+                             const std::vector<double>& speedups,
+                             const std::string& filename);
+    
+    /**
+     * @brief Строит график ускорения рядом с загрузкой потоков
+     * @param threads Вектор количества потоков
+     * @param speedups Вектор значений ускорения
+     * @param telemetry Телеметрия пакета, для которого показывается загрузка
+     * @param filename Имя файла для сохранения графика
+     *
+     * Справа для каждого потока показаны доли занятости, запуска и ожидания
+     * на барьере относительно общего времени пакета.
+     */
+    static void plot_speedup_with_utilization(const std::vector<int>& threads,
+                                              const std::vector<double>& speedups,
+                                              const BatchTelemetry& telemetry,
+                                              const std::string& filename);
+    
+    /**
+     * @brief Строит график ускорения и загрузки потоков в открытой сессии gnuplot
+     */
+    static void plot_speedup_with_utilization(GnuplotSession& session,
+                                              const std::vector<int>& threads,
+                                              const std::vector<double>& speedups,
+                                              const BatchTelemetry& telemetry,
+                                              const std::string& filename);
+    
+    /**
+     * @brief Формирует скрипт графика ускорения со встроенными данными
+     * @throws std::invalid_argument если векторы пусты или их размеры различаются
+     */
+    static std::string speedup_script(const std::vector<int>& threads,
+                                      const std::vector<double>& speedups,
+                                      const std::string& filename);
+    
+    /**
+     * @brief Формирует скрипт графика ускорения и загрузки потоков со встроенными данными
+     * @throws std::invalid_argument если векторы пусты, их размеры различаются или телеметрия пуста
+     */
+    static std::string utilization_script(const std::vector<int>& threads,
+                                          const std::vector<double>& speedups,
+                                          const BatchTelemetry& telemetry,
+                                          const std::string& filename);
+    
+    /**
+     * @brief Строит графики масштабируемости по повторным измерениям
+     * @param series Серии конфигураций (см. ScalingAnalysis), накладываемые на одни оси
+     * @param filename Имя файла для сохранения графика
+     * @param band Полоса разброса вокруг медианного ускорения
+     *
+     * Три панели: медианное ускорение с полосой разброса, подобранным законом
+     * Амдала и линейным ускорением; параллельная эффективность; метрика
+     * Карпа-Флэтта. Цвет серии одинаков на всех панелях.
+     */
+    static void plot_scaling(const std::vector<ScalingSeries>& series, const std::string& filename,
+                             ScalingBand band = ScalingBand::Confidence);
+    
+    /**
+     * @brief Строит графики масштабируемости в открытой сессии gnuplot
+     */
+    static void plot_scaling(GnuplotSession& session, const std::vector<ScalingSeries>& series,
+                             const std::string& filename, ScalingBand band = ScalingBand::Confidence);
+    
+    /**
+     * @brief Формирует скрипт графиков масштабируемости со встроенными данными
+     * @throws std::invalid_argument если нет серий или серия не содержит точек
+     */
+    static std::string scaling_script(const std::vector<ScalingSeries>& series, const std::string& filename,
+                                      ScalingBand band = ScalingBand::Confidence);
+    
+    /**
+     * @brief Строит график узлов и интерполянта
+     * @param nodes_x Абсциссы узлов
+     * @param nodes_y Значения в узлах
+     * @param curve_x Точки вычисления интерполянта (неубывающие)
+     * @param curve_y Значения интерполянта
+     * @param filename Имя файла для сохранения графика
+     * @param options Размер, заголовок и способ прореживания
+     *
+     * Кривая из миллионов точек прореживается до ширины изображения
+     * (CurveDecimator) и передается gnuplot в двоичном виде.
+     */
+    static void plot_interpolation(std::span<const double> nodes_x, std::span<const double> nodes_y,
+                                   std::span<const double> curve_x, std::span<const double> curve_y,
+                                   const std::string& filename, const CurvePlotOptions& options = {});
+    
+    /**
+     * @brief Строит график узлов и интерполянта в открытой сессии gnuplot
+     */
+    static void plot_interpolation(GnuplotSession& session,
+                                   std::span<const double> nodes_x, std::span<const double> nodes_y,
+                                   std::span<const double> curve_x, std::span<const double> curve_y,
+                                   const std::string& filename, const CurvePlotOptions& options = {});
+    
+    /**
+     * @brief Формирует скрипт графика интерполянта
+     * @return Скрипт, за командой plot которого следуют двоичные записи (x, y) в формате float64
+     * @throws std::invalid_argument если кривая пуста, размеры векторов различаются,
+     *         x кривой не упорядочены или размер изображения нулевой
+     */
+    static std::string interpolation_script(std::span<const double> nodes_x, std::span<const double> nodes_y,
+                                            std::span<const double> curve_x, std::span<const double> curve_y,
+                                            const std::string& filename, const CurvePlotOptions& options = {});
+    
 private:
     /**
-     * @brief Сохраняет данные в файл
-     * @param x Вектор значений x
-     * @param y Вектор значений y
-     * @param filename Имя файла
+     * @brief Выполняет скрипт в отдельном процессе gnuplot
+     * @throws std::runtime_error если gnuplot не установлен или завершился с ошибкой
      */
-    static void save_data_to_file(const std::vector<double>& x, 
-                                const std::vector<double>& y, 
-                                const std::string& filename);
-};
\ No newline at end of file
+    static void run_script(const std::string& script);
+};
+
+#endif // GNUPLOT_VISUALIZER_H
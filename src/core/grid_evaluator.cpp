@@ -0,0 +1,134 @@
+#include "grid_evaluator.h"
+#include <omp.h>
+#include <algorithm>
+#include <limits>
+#include <vector>
+
+/**
+ * @brief Количество точек в участке при прямом вычислении
+ */
+static const size_t DIRECT_CHUNK_SIZE = 256;
+
+/**
+ * @brief Во сколько раз участок должен превышать затравку, чтобы шагание окупалось
+ */
+static const size_t MIN_STEPS_PER_SEED = 4;
+
+/**
+ * @brief Верхняя граница длины участка (чтобы потокам хватало работы)
+ */
+static const size_t MAX_CHUNK_SIZE = 1 << 16;
+
+namespace {
+
+/**
+ * @brief Оценка усиления ошибки затравки после s шагов: sum_{k<=d} C(s, k) 2^k
+ */
+double forward_error_growth(size_t degree, size_t steps) {
+    double binomial = 1.0;
+    double power = 1.0;
+    double sum = 1.0;
+    for (size_t k = 1; k <= degree && k <= steps; k++) {
+        binomial = binomial * static_cast<double>(steps - k + 1) / static_cast<double>(k);
+        power *= 2.0;
+        sum += binomial * power;
+    }
+    return sum;
+}
+
+/**
+ * @brief Заполняет буфер точками сетки с номерами [first, first + count)
+ */
+void fill_grid_points(double start, double step, size_t first, size_t count, double* points) {
+    for (size_t i = 0; i < count; i++) {
+        points[i] = start + static_cast<double>(first + i) * step;
+    }
+}
+
+} // namespace
+
+size_t GridEvaluator::max_stable_steps(size_t degree, double tolerance) {
+    const double eps = std::numeric_limits<double>::epsilon();
+    size_t low = degree + 1;
+    size_t high = MAX_CHUNK_SIZE;
+    if (forward_error_growth(degree, high) * eps <= tolerance) {
+        return high;
+    }
+    // Оценка монотонно растет с длиной участка - ищем границу бинарным поиском
+    while (low + 1 < high) {
+        size_t middle = low + (high - low) / 2;
+        if (forward_error_growth(degree, middle) * eps <= tolerance) {
+            low = middle;
+        } else {
+            high = middle;
+        }
+    }
+    return low;
+}
+
+bool GridEvaluator::uses_forward_differences(size_t degree, double tolerance) {
+    return degree > 0 && max_stable_steps(degree, tolerance) >= MIN_STEPS_PER_SEED * (degree + 1);
+}
+
+void GridEvaluator::evaluate(EvaluationKernel kernel,
+                             const double* x, const double* coefficients, size_t n,
+                             double start, double step, double* results, size_t count,
+                             double tolerance) {
+    if (n == 0 || count == 0) {
+        return;
+    }
+    const EvaluationKernel resolved = EvaluationKernels::resolve(kernel);
+    const size_t degree = n - 1;
+
+    if (!uses_forward_differences(degree, tolerance)) {
+        const long num_chunks = static_cast<long>((count + DIRECT_CHUNK_SIZE - 1) / DIRECT_CHUNK_SIZE);
+
+        #pragma omp parallel for schedule(static)
+        for (long b = 0; b < num_chunks; b++) {
+            double points[DIRECT_CHUNK_SIZE];
+            const size_t first = static_cast<size_t>(b) * DIRECT_CHUNK_SIZE;
+            const size_t chunk = std::min(DIRECT_CHUNK_SIZE, count - first);
+            fill_grid_points(start, step, first, chunk, points);
+            EvaluationKernels::evaluate(resolved, x, coefficients, n, points, results + first, chunk);
+        }
+        return;
+    }
+
+    const size_t chunk_size = max_stable_steps(degree, tolerance);
+    const long num_chunks = static_cast<long>((count + chunk_size - 1) / chunk_size);
+
+    #pragma omp parallel
+    {
+        std::vector<double> seed_points(degree + 1);
+        std::vector<double> differences(degree + 1);
+
+        #pragma omp for schedule(static)
+        for (long b = 0; b < num_chunks; b++) {
+            const size_t first = static_cast<size_t>(b) * chunk_size;
+            const size_t chunk = std::min(chunk_size, count - first);
+            double* out = results + first;
+
+            // Затравка: d + 1 точных значений и конечные разности в начале участка
+            fill_grid_points(start, step, first, degree + 1, seed_points.data());
+            EvaluationKernels::evaluate(resolved, x, coefficients, n,
+                                        seed_points.data(), differences.data(), degree + 1);
+            std::copy(differences.begin(), differences.begin() + std::min(chunk, degree + 1), out);
+            for (size_t k = 1; k <= degree; k++) {
+                for (size_t i = degree; i >= k; i--) {
+                    differences[i] -= differences[i-1];
+                }
+            }
+
+            // Шагание: после j шагов differences[0] равно значению в точке j
+            double* d = differences.data();
+            for (size_t j = 1; j < chunk; j++) {
+                for (size_t k = 0; k < degree; k++) {
+                    d[k] += d[k+1];
+                }
+                if (j > degree) {
+                    out[j] = d[0];
+                }
+            }
+        }
+    }
+}
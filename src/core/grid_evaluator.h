@@ -0,0 +1,66 @@
+/**
+ * @file grid_evaluator.h
+ * @brief Вычисление полинома Ньютона на равномерной сетке методом конечных разностей
+ */
+
+#ifndef GRID_EVALUATOR_H
+#define GRID_EVALUATOR_H
+
+#include "evaluation_kernels.h"
+#include <cstddef>
+
+/**
+ * @brief Допустимая относительная погрешность шагания по разностям по умолчанию
+ */
+constexpr double DEFAULT_GRID_TOLERANCE = 1e-9;
+
+/**
+ * @class GridEvaluator
+ * @brief Вычисляет полином степени d в точках t_i = start + i * step
+ *
+ * Сетка делится на участки, которые обрабатываются потоками OpenMP
+ * независимо. В начале участка полином точно вычисляется в d + 1 точках
+ * (схема Горнера), по ним строятся конечные разности, а дальше каждая точка
+ * получается d сложениями без умножений. Ошибка начальных разностей растет
+ * при шагании как sum C(s, k) 2^k eps, поэтому длина участка выбирается так,
+ * чтобы эта оценка не превышала допуск. Если при такой длине шагание не
+ * окупает затравку (высокие степени), точки вычисляются напрямую векторным ядром.
+ * Массив точек сетки при этом никогда не создается целиком.
+ */
+class GridEvaluator {
+public:
+    /**
+     * @brief Максимальная длина участка, на которой шагание по разностям укладывается в допуск
+     * @param degree Степень полинома
+     * @param tolerance Допустимая относительная погрешность
+     * @return Длина участка в точках (не меньше degree + 1)
+     */
+    static size_t max_stable_steps(size_t degree, double tolerance);
+    
+    /**
+     * @brief Проверяет, будет ли для данной степени использовано шагание по разностям
+     * @param degree Степень полинома
+     * @param tolerance Допустимая относительная погрешность
+     * @return true, если участок достаточно длинный, чтобы окупить затравку
+     */
+    static bool uses_forward_differences(size_t degree, double tolerance);
+    
+    /**
+     * @brief Вычисляет полином Ньютона на равномерной сетке
+     * @param kernel Ядро для затравочных и прямых вычислений
+     * @param x Узлы интерполяции
+     * @param coefficients Коэффициенты полинома Ньютона
+     * @param n Количество узлов
+     * @param start Первая точка сетки
+     * @param step Шаг сетки
+     * @param results Массив результатов (count элементов)
+     * @param count Количество точек сетки
+     * @param tolerance Допустимая относительная погрешность шагания
+     */
+    static void evaluate(EvaluationKernel kernel,
+                         const double* x, const double* coefficients, size_t n,
+                         double start, double step, double* results, size_t count,
+                         double tolerance = DEFAULT_GRID_TOLERANCE);
+};
+
+#endif // GRID_EVALUATOR_H
@@ -0,0 +1,241 @@
+#include "mapped_binary_file.h"
+#include <algorithm>
+#include <cstring>
+#include <fstream>
+#include <stdexcept>
+
+namespace {
+
+const char BINARY_MAGIC[8] = {'N', 'E', 'W', 'T', 'B', 'I', 'N', '\0'};
+
+/**
+ * @brief Размер массива в файле с выравниванием до следующего массива
+ */
+uint64_t padded_array_bytes(size_t count) {
+    const uint64_t bytes = static_cast<uint64_t>(count) * sizeof(double);
+    return (bytes + BINARY_ARRAY_ALIGNMENT - 1) / BINARY_ARRAY_ALIGNMENT * BINARY_ARRAY_ALIGNMENT;
+}
+
+/**
+ * @brief Заполняет заголовок и смещения arrays подряд идущих массивов
+ * @return Полный размер файла
+ */
+uint64_t make_header(BinaryFileHeader& header, BinaryArrayKind kind, size_t count,
+                     size_t arrays, uint32_t flags) {
+    std::memset(&header, 0, sizeof(header));
+    std::memcpy(header.magic, BINARY_MAGIC, sizeof(header.magic));
+    header.version = BINARY_FORMAT_VERSION;
+    header.kind = static_cast<uint32_t>(kind);
+    header.dtype = static_cast<uint32_t>(BinaryDataType::Float64);
+    header.flags = flags;
+    header.count = count;
+
+    uint64_t* const offsets[] = {&header.x_offset, &header.y_offset, &header.coefficients_offset};
+    uint64_t offset = sizeof(BinaryFileHeader);
+    for (size_t i = 0; i < arrays; i++) {
+        *offsets[i] = offset;
+        offset += padded_array_bytes(count);
+    }
+    return offset;
+}
+
+/**
+ * @brief Записывает заголовок и массивы в файл
+ */
+void write_file(const std::string& path, const BinaryFileHeader& header, uint64_t file_size,
+                std::span<const double> arrays[], size_t array_count) {
+    std::ofstream file(path, std::ios::binary | std::ios::trunc);
+    if (!file.is_open()) {
+        throw std::runtime_error("Не удалось создать файл " + path);
+    }
+    file.write(reinterpret_cast<const char*>(&header), sizeof(header));
+    const char padding[BINARY_ARRAY_ALIGNMENT] = {};
+    for (size_t i = 0; i < array_count; i++) {
+        const uint64_t bytes = arrays[i].size() * sizeof(double);
+        file.write(reinterpret_cast<const char*>(arrays[i].data()), static_cast<std::streamsize>(bytes));
+        file.write(padding, static_cast<std::streamsize>(padded_array_bytes(arrays[i].size()) - bytes));
+    }
+    if (!file || static_cast<uint64_t>(file.tellp()) != file_size) {
+        throw std::runtime_error("Ошибка записи файла " + path);
+    }
+}
+
+} // namespace
+
+void MappedBinaryFile::validate() const {
+    const std::string& filename = mapping.get_path();
+    const size_t size = mapping.get_size();
+    if (size < sizeof(BinaryFileHeader)) {
+        throw std::runtime_error("Некорректный двоичный файл " + filename + ": нет заголовка");
+    }
+    const BinaryFileHeader& header = get_header();
+    if (std::memcmp(header.magic, BINARY_MAGIC, sizeof(header.magic)) != 0) {
+        throw std::runtime_error("Некорректный двоичный файл " + filename + ": неверная сигнатура");
+    }
+    if (header.version != BINARY_FORMAT_VERSION) {
+        throw std::runtime_error("Неподдерживаемая версия двоичного файла " + filename);
+    }
+    if (header.dtype != static_cast<uint32_t>(BinaryDataType::Float64)) {
+        throw std::runtime_error("Неподдерживаемый тип данных в файле " + filename);
+    }
+    if (header.kind < static_cast<uint32_t>(BinaryArrayKind::Table) ||
+        header.kind > static_cast<uint32_t>(BinaryArrayKind::Results)) {
+        throw std::runtime_error("Неизвестное содержимое двоичного файла " + filename);
+    }
+
+    const uint64_t bytes = header.count * sizeof(double);
+    if (header.count > size / sizeof(double)) {
+        throw std::runtime_error("Некорректный двоичный файл " + filename + ": файл обрезан");
+    }
+    const uint64_t offsets[] = {header.x_offset, header.y_offset, header.coefficients_offset};
+    for (uint64_t offset : offsets) {
+        if (offset == 0) {
+            continue;
+        }
+        if (offset % sizeof(double) != 0 || offset < sizeof(BinaryFileHeader) || offset > size - bytes) {
+            throw std::runtime_error("Некорректный двоичный файл " + filename + ": файл обрезан");
+        }
+    }
+    const bool table = header.kind == static_cast<uint32_t>(BinaryArrayKind::Table);
+    if (header.x_offset == 0 || (table && header.y_offset == 0) ||
+        ((header.flags & BINARY_FLAG_COEFFICIENTS) != 0) != (header.coefficients_offset != 0)) {
+        throw std::runtime_error("Некорректный двоичный файл " + filename + ": нет обязательного массива");
+    }
+}
+
+std::span<const double> MappedBinaryFile::array(uint64_t offset) const {
+    if (offset == 0) {
+        return {};
+    }
+    return std::span<const double>(reinterpret_cast<const double*>(mapping.get_data() + offset), get_count());
+}
+
+MappedBinaryFile MappedBinaryFile::open(const std::string& path) {
+    MappedBinaryFile file;
+    file.mapping = MappedFile::open(path);
+    file.validate();
+    return file;
+}
+
+MappedBinaryFile MappedBinaryFile::create(const std::string& path, BinaryArrayKind kind, size_t count) {
+    if (kind == BinaryArrayKind::Table) {
+        throw std::invalid_argument("create создает только файлы точек и результатов, таблицы пишет write_table");
+    }
+    BinaryFileHeader header;
+    const uint64_t file_size = make_header(header, kind, count, 1, 0);
+
+    MappedBinaryFile file;
+    file.mapping = MappedFile::create(path, static_cast<size_t>(file_size));
+    std::memcpy(file.mapping.get_mutable_data(), &header, sizeof(header));
+    return file;
+}
+
+void MappedBinaryFile::write_table(const std::string& path, std::span<const double> x, std::span<const double> y,
+                                   std::span<const double> coefficients) {
+    if (x.size() != y.size()) {
+        throw std::invalid_argument("Размеры векторов x и y должны совпадать");
+    }
+    const bool sorted = std::is_sorted(x.begin(), x.end());
+    if (!coefficients.empty()) {
+        if (coefficients.size() != x.size()) {
+            throw std::invalid_argument("Количество коэффициентов должно совпадать с количеством узлов");
+        }
+        if (!sorted) {
+            throw std::invalid_argument("Готовые коэффициенты допустимы только для отсортированных узлов");
+        }
+    }
+
+    uint32_t flags = sorted ? BINARY_FLAG_SORTED : 0;
+    if (!coefficients.empty()) {
+        flags |= BINARY_FLAG_COEFFICIENTS;
+    }
+    std::span<const double> arrays[] = {x, y, coefficients};
+    const size_t array_count = coefficients.empty() ? 2 : 3;
+    BinaryFileHeader header;
+    const uint64_t file_size = make_header(header, BinaryArrayKind::Table, x.size(), array_count, flags);
+    write_file(path, header, file_size, arrays, array_count);
+}
+
+void MappedBinaryFile::write_array(const std::string& path, BinaryArrayKind kind, std::span<const double> values) {
+    if (kind == BinaryArrayKind::Table) {
+        throw std::invalid_argument("Таблицы узлов записывает write_table");
+    }
+    const uint32_t flags = std::is_sorted(values.begin(), values.end()) ? BINARY_FLAG_SORTED : 0;
+    std::span<const double> arrays[] = {values};
+    BinaryFileHeader header;
+    const uint64_t file_size = make_header(header, kind, values.size(), 1, flags);
+    write_file(path, header, file_size, arrays, 1);
+}
+
+BinaryFileHeader MappedBinaryFile::make_array_header(BinaryArrayKind kind, size_t count, uint32_t flags) {
+    BinaryFileHeader header;
+    make_header(header, kind, count, 1, flags);
+    return header;
+}
+
+void MappedBinaryFile::flush() {
+    mapping.flush();
+}
+
+bool MappedBinaryFile::is_open() const {
+    return mapping.is_open();
+}
+
+const BinaryFileHeader& MappedBinaryFile::get_header() const {
+    if (!mapping.is_open()) {
+        throw std::logic_error("Файл не открыт");
+    }
+    return *reinterpret_cast<const BinaryFileHeader*>(mapping.get_data());
+}
+
+BinaryArrayKind MappedBinaryFile::get_kind() const {
+    return static_cast<BinaryArrayKind>(get_header().kind);
+}
+
+size_t MappedBinaryFile::get_count() const {
+    return static_cast<size_t>(get_header().count);
+}
+
+bool MappedBinaryFile::is_sorted() const {
+    return (get_header().flags & BINARY_FLAG_SORTED) != 0;
+}
+
+bool MappedBinaryFile::has_coefficients() const {
+    return (get_header().flags & BINARY_FLAG_COEFFICIENTS) != 0;
+}
+
+std::span<const double> MappedBinaryFile::get_x() const {
+    if (get_kind() != BinaryArrayKind::Table) {
+        throw std::logic_error("Файл не содержит таблицу узлов");
+    }
+    return array(get_header().x_offset);
+}
+
+std::span<const double> MappedBinaryFile::get_y() const {
+    if (get_kind() != BinaryArrayKind::Table) {
+        throw std::logic_error("Файл не содержит таблицу узлов");
+    }
+    return array(get_header().y_offset);
+}
+
+std::span<const double> MappedBinaryFile::get_coefficients() const {
+    if (get_kind() != BinaryArrayKind::Table) {
+        throw std::logic_error("Файл не содержит таблицу узлов");
+    }
+    return array(get_header().coefficients_offset);
+}
+
+std::span<const double> MappedBinaryFile::get_values() const {
+    if (get_kind() == BinaryArrayKind::Table) {
+        throw std::logic_error("Файл таблицы не содержит массива значений, используйте get_x и get_y");
+    }
+    return array(get_header().x_offset);
+}
+
+std::span<double> MappedBinaryFile::get_mutable_values() {
+    if (!mapping.is_writable()) {
+        throw std::logic_error("Файл открыт только на чтение");
+    }
+    std::span<const double> values = get_values();
+    return std::span<double>(const_cast<double*>(values.data()), values.size());
+}
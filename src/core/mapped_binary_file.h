@@ -0,0 +1,205 @@
+/**
+ * @file mapped_binary_file.h
+ * @brief Двоичный формат таблиц узлов, точек и результатов с отображением файла в память
+ */
+
+#ifndef MAPPED_BINARY_FILE_H
+#define MAPPED_BINARY_FILE_H
+
+#include "mapped_file.h"
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <string>
+
+/**
+ * @brief Содержимое двоичного файла
+ */
+enum class BinaryArrayKind : uint32_t {
+    Table = 1,   ///< Таблица узлов: x, y и, опционально, коэффициенты Ньютона
+    Points = 2,  ///< Точки запроса
+    Results = 3  ///< Результаты интерполяции
+};
+
+/**
+ * @brief Тип элементов массивов
+ */
+enum class BinaryDataType : uint32_t {
+    Float64 = 1  ///< double (единственный тип, читаемый без преобразования)
+};
+
+constexpr uint32_t BINARY_FORMAT_VERSION = 1;          ///< Версия формата
+constexpr uint32_t BINARY_FLAG_SORTED = 0x1;           ///< Значения x неубывающие
+constexpr uint32_t BINARY_FLAG_COEFFICIENTS = 0x2;     ///< Записаны коэффициенты Ньютона
+constexpr size_t BINARY_ARRAY_ALIGNMENT = 64;          ///< Выравнивание массивов от начала файла
+
+/**
+ * @struct BinaryFileHeader
+ * @brief Заголовок файла (64 байта, порядок байтов машины)
+ *
+ * За заголовком следуют массивы, каждый выровнен на 64 байта от начала
+ * файла. Отображение файла выровнено по странице, поэтому массивы в памяти
+ * выровнены так же, как буферы AlignedVector.
+ */
+struct BinaryFileHeader {
+    char magic[8];                 ///< "NEWTBIN" и нулевой байт
+    uint32_t version;              ///< BINARY_FORMAT_VERSION
+    uint32_t kind;                 ///< BinaryArrayKind
+    uint32_t dtype;                ///< BinaryDataType
+    uint32_t flags;                ///< BINARY_FLAG_*
+    uint64_t count;                ///< Количество элементов в каждом массиве
+    uint64_t x_offset;             ///< Смещение x (для точек и результатов - значений)
+    uint64_t y_offset;             ///< Смещение y (0 - массива нет)
+    uint64_t coefficients_offset;  ///< Смещение коэффициентов (0 - массива нет)
+    uint64_t reserved;             ///< Зарезервировано (0)
+};
+
+static_assert(sizeof(BinaryFileHeader) == 64, "Заголовок двоичного файла должен занимать 64 байта");
+
+/**
+ * @class MappedBinaryFile
+ * @brief Файл двоичного формата, отображенный в память
+ *
+ * Массивы возвращаются как std::span прямо на отображенные страницы, поэтому
+ * открытие файла любого размера не копирует и не разбирает данные: страницы
+ * подгружаются при первом обращении. Файл, созданный через create, открыт
+ * на запись, и interpolate_into пишет результаты прямо в него.
+ *
+ * Отображение выполняет MappedFile (на платформах без mmap - чтение в буфер).
+ */
+class MappedBinaryFile {
+private:
+    MappedFile mapping;  ///< Отображение файла
+
+    /**
+     * @brief Проверяет заголовок и границы массивов
+     * @throws std::runtime_error для поврежденного или чужого файла
+     */
+    void validate() const;
+
+    /**
+     * @brief Возвращает массив по смещению из заголовка
+     */
+    std::span<const double> array(uint64_t offset) const;
+
+public:
+    /**
+     * @brief Создает пустой объект без файла
+     */
+    MappedBinaryFile() = default;
+
+    /**
+     * @brief Открывает файл на чтение
+     * @param path Имя файла
+     * @return Отображенный файл
+     * @throws std::runtime_error если файл не открывается или поврежден
+     */
+    static MappedBinaryFile open(const std::string& path);
+
+    /**
+     * @brief Создает файл точек или результатов и открывает его на запись
+     * @param path Имя файла
+     * @param kind Points или Results
+     * @param count Количество значений
+     * @return Отображенный файл; значения заполняются через get_mutable_values
+     * @throws std::invalid_argument для kind == Table
+     * @throws std::runtime_error если файл не создается
+     */
+    static MappedBinaryFile create(const std::string& path, BinaryArrayKind kind, size_t count);
+
+    /**
+     * @brief Записывает таблицу узлов
+     * @param path Имя файла
+     * @param x Значения x
+     * @param y Значения y
+     * @param coefficients Коэффициенты Ньютона для узлов в данном порядке (пусто - не записывать)
+     * @throws std::invalid_argument при несовпадении размеров или коэффициентах для неотсортированных x
+     * @throws std::runtime_error если файл не записывается
+     */
+    static void write_table(const std::string& path, std::span<const double> x, std::span<const double> y,
+                            std::span<const double> coefficients = {});
+
+    /**
+     * @brief Записывает массив точек или результатов
+     * @param path Имя файла
+     * @param kind Points или Results
+     * @param values Значения
+     */
+    static void write_array(const std::string& path, BinaryArrayKind kind, std::span<const double> values);
+
+    /**
+     * @brief Формирует заголовок файла точек или результатов
+     * @param kind Points или Results
+     * @param count Количество значений
+     * @param flags Флаги BINARY_FLAG_*
+     * @return Заголовок; значения начинаются сразу за ним
+     */
+    static BinaryFileHeader make_array_header(BinaryArrayKind kind, size_t count, uint32_t flags = 0);
+
+    /**
+     * @brief Сбрасывает изменения созданного файла на диск
+     */
+    void flush();
+
+    /**
+     * @brief Проверяет, открыт ли файл
+     */
+    bool is_open() const;
+
+    /**
+     * @brief Возвращает заголовок файла
+     */
+    const BinaryFileHeader& get_header() const;
+
+    /**
+     * @brief Возвращает содержимое файла
+     */
+    BinaryArrayKind get_kind() const;
+
+    /**
+     * @brief Возвращает количество элементов в массивах
+     */
+    size_t get_count() const;
+
+    /**
+     * @brief Проверяет флаг отсортированности x
+     */
+    bool is_sorted() const;
+
+    /**
+     * @brief Проверяет наличие коэффициентов Ньютона
+     */
+    bool has_coefficients() const;
+
+    /**
+     * @brief Возвращает x таблицы
+     * @throws std::logic_error если файл не таблица
+     */
+    std::span<const double> get_x() const;
+
+    /**
+     * @brief Возвращает y таблицы
+     * @throws std::logic_error если файл не таблица
+     */
+    std::span<const double> get_y() const;
+
+    /**
+     * @brief Возвращает коэффициенты таблицы (пусто, если не записаны)
+     * @throws std::logic_error если файл не таблица
+     */
+    std::span<const double> get_coefficients() const;
+
+    /**
+     * @brief Возвращает значения файла точек или результатов
+     * @throws std::logic_error если файл - таблица
+     */
+    std::span<const double> get_values() const;
+
+    /**
+     * @brief Возвращает изменяемые значения файла, созданного через create
+     * @throws std::logic_error если файл открыт только на чтение
+     */
+    std::span<double> get_mutable_values();
+};
+
+#endif // MAPPED_BINARY_FILE_H
@@ -0,0 +1,176 @@
+#include "mapped_file.h"
+#include <fstream>
+#include <stdexcept>
+#include <utility>
+
+#if defined(__unix__) || defined(__APPLE__)
+#define MAPPED_FILE_MMAP
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+MappedFile::MappedFile()
+    : data(nullptr), size(0), opened(false), writable(false), descriptor(-1) {}
+
+MappedFile::MappedFile(MappedFile&& other) noexcept
+    : data(std::exchange(other.data, nullptr)), size(std::exchange(other.size, 0)),
+      opened(std::exchange(other.opened, false)), writable(std::exchange(other.writable, false)),
+      descriptor(std::exchange(other.descriptor, -1)), buffer(std::move(other.buffer)),
+      path(std::move(other.path)) {}
+
+MappedFile& MappedFile::operator=(MappedFile&& other) noexcept {
+    if (this != &other) {
+        close();
+        data = std::exchange(other.data, nullptr);
+        size = std::exchange(other.size, 0);
+        opened = std::exchange(other.opened, false);
+        writable = std::exchange(other.writable, false);
+        descriptor = std::exchange(other.descriptor, -1);
+        buffer = std::move(other.buffer);
+        path = std::move(other.path);
+    }
+    return *this;
+}
+
+MappedFile::~MappedFile() {
+    close();
+}
+
+void MappedFile::close() {
+#ifdef MAPPED_FILE_MMAP
+    if (data != nullptr) {
+        munmap(data, size);
+    }
+    if (descriptor >= 0) {
+        ::close(descriptor);
+    }
+#else
+    if (writable && data != nullptr) {
+        try {
+            flush();
+        } catch (const std::exception&) {
+            // Деструктор не бросает исключений; ошибки записи сообщает явный flush
+        }
+    }
+    buffer.clear();
+#endif
+    data = nullptr;
+    size = 0;
+    opened = false;
+    writable = false;
+    descriptor = -1;
+}
+
+MappedFile MappedFile::open(const std::string& path) {
+    MappedFile file;
+    file.path = path;
+#ifdef MAPPED_FILE_MMAP
+    file.descriptor = ::open(path.c_str(), O_RDONLY);
+    if (file.descriptor < 0) {
+        throw std::runtime_error("Не удалось открыть файл " + path);
+    }
+    struct stat info;
+    if (fstat(file.descriptor, &info) != 0) {
+        throw std::runtime_error("Не удалось определить размер файла " + path);
+    }
+    file.size = static_cast<size_t>(info.st_size);
+    if (file.size > 0) {
+        void* mapping = mmap(nullptr, file.size, PROT_READ, MAP_PRIVATE, file.descriptor, 0);
+        if (mapping == MAP_FAILED) {
+            file.size = 0;
+            throw std::runtime_error("Не удалось отобразить файл " + path + " в память");
+        }
+        file.data = static_cast<unsigned char*>(mapping);
+    }
+#else
+    std::ifstream input(path, std::ios::binary | std::ios::ate);
+    if (!input.is_open()) {
+        throw std::runtime_error("Не удалось открыть файл " + path);
+    }
+    file.size = static_cast<size_t>(input.tellg());
+    if (file.size > 0) {
+        file.buffer.resize((file.size + sizeof(double) - 1) / sizeof(double));
+        input.seekg(0);
+        input.read(reinterpret_cast<char*>(file.buffer.data()), static_cast<std::streamsize>(file.size));
+        file.data = reinterpret_cast<unsigned char*>(file.buffer.data());
+    }
+#endif
+    file.opened = true;
+    return file;
+}
+
+MappedFile MappedFile::create(const std::string& path, size_t size) {
+    if (size == 0) {
+        throw std::invalid_argument("Размер создаваемого файла должен быть положительным");
+    }
+    MappedFile file;
+    file.path = path;
+    file.size = size;
+    file.writable = true;
+#ifdef MAPPED_FILE_MMAP
+    file.descriptor = ::open(path.c_str(), O_RDWR | O_CREAT | O_TRUNC, 0644);
+    if (file.descriptor < 0) {
+        throw std::runtime_error("Не удалось создать файл " + path);
+    }
+    if (ftruncate(file.descriptor, static_cast<off_t>(size)) != 0) {
+        throw std::runtime_error("Не удалось выделить место под файл " + path);
+    }
+    void* mapping = mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_SHARED, file.descriptor, 0);
+    if (mapping == MAP_FAILED) {
+        file.size = 0;
+        throw std::runtime_error("Не удалось отобразить файл " + path + " в память");
+    }
+    file.data = static_cast<unsigned char*>(mapping);
+#else
+    file.buffer.assign((size + sizeof(double) - 1) / sizeof(double), 0.0);
+    file.data = reinterpret_cast<unsigned char*>(file.buffer.data());
+#endif
+    file.opened = true;
+    return file;
+}
+
+void MappedFile::flush() {
+    if (!writable || data == nullptr) {
+        return;
+    }
+#ifdef MAPPED_FILE_MMAP
+    if (msync(data, size, MS_SYNC) != 0) {
+        throw std::runtime_error("Не удалось сохранить файл " + path);
+    }
+#else
+    std::ofstream output(path, std::ios::binary | std::ios::trunc);
+    output.write(reinterpret_cast<const char*>(data), static_cast<std::streamsize>(size));
+    if (!output) {
+        throw std::runtime_error("Не удалось сохранить файл " + path);
+    }
+#endif
+}
+
+bool MappedFile::is_open() const {
+    return opened;
+}
+
+bool MappedFile::is_writable() const {
+    return writable;
+}
+
+const unsigned char* MappedFile::get_data() const {
+    return data;
+}
+
+unsigned char* MappedFile::get_mutable_data() {
+    if (!writable) {
+        throw std::logic_error("Файл открыт только на чтение");
+    }
+    return data;
+}
+
+size_t MappedFile::get_size() const {
+    return size;
+}
+
+const std::string& MappedFile::get_path() const {
+    return path;
+}
@@ -0,0 +1,108 @@
+/**
+ * @file mapped_file.h
+ * @brief Отображение файла в память (mmap) с запасным чтением в буфер
+ */
+
+#ifndef MAPPED_FILE_H
+#define MAPPED_FILE_H
+
+#include "aligned_buffer.h"
+#include <cstddef>
+#include <string>
+
+/**
+ * @class MappedFile
+ * @brief Файл, отображенный в память целиком
+ *
+ * Страницы подгружаются при первом обращении, поэтому открытие файла любого
+ * размера не читает его. Отображение выровнено по странице. На платформах
+ * без mmap файл читается в выровненный буфер целиком, а созданный файл
+ * записывается в flush и при закрытии.
+ */
+class MappedFile {
+private:
+    unsigned char* data;           ///< Начало отображения (nullptr для пустого файла)
+    size_t size;                   ///< Размер файла в байтах
+    bool opened;                   ///< Открыт ли файл
+    bool writable;                 ///< Открыт ли файл на запись
+    int descriptor;                ///< Дескриптор файла (-1 без mmap)
+    AlignedVector<double> buffer;  ///< Содержимое файла на платформах без mmap
+    std::string path;              ///< Имя файла
+
+    /**
+     * @brief Снимает отображение и закрывает файл
+     */
+    void close();
+
+public:
+    /**
+     * @brief Создает пустой объект без файла
+     */
+    MappedFile();
+
+    MappedFile(MappedFile&& other) noexcept;
+    MappedFile& operator=(MappedFile&& other) noexcept;
+    MappedFile(const MappedFile&) = delete;
+    MappedFile& operator=(const MappedFile&) = delete;
+
+    /**
+     * @brief Деструктор (снимает отображение)
+     */
+    ~MappedFile();
+
+    /**
+     * @brief Открывает файл на чтение
+     * @param path Имя файла
+     * @return Отображенный файл (пустой файл дает нулевой размер)
+     * @throws std::runtime_error если файл не открывается
+     */
+    static MappedFile open(const std::string& path);
+
+    /**
+     * @brief Создает (или перезаписывает) файл заданного размера и открывает его на запись
+     * @param path Имя файла
+     * @param size Размер файла в байтах (больше 0)
+     * @return Отображенный файл, заполненный нулями
+     * @throws std::runtime_error если файл не создается
+     */
+    static MappedFile create(const std::string& path, size_t size);
+
+    /**
+     * @brief Сбрасывает изменения файла, открытого на запись, на диск
+     * @throws std::runtime_error при ошибке записи
+     */
+    void flush();
+
+    /**
+     * @brief Проверяет, открыт ли файл
+     */
+    bool is_open() const;
+
+    /**
+     * @brief Проверяет, открыт ли файл на запись
+     */
+    bool is_writable() const;
+
+    /**
+     * @brief Возвращает содержимое файла
+     */
+    const unsigned char* get_data() const;
+
+    /**
+     * @brief Возвращает изменяемое содержимое файла
+     * @throws std::logic_error если файл открыт только на чтение
+     */
+    unsigned char* get_mutable_data();
+
+    /**
+     * @brief Возвращает размер файла в байтах
+     */
+    size_t get_size() const;
+
+    /**
+     * @brief Возвращает имя файла
+     */
+    const std::string& get_path() const;
+};
+
+#endif // MAPPED_FILE_H
@@ -0,0 +1,84 @@
+#include "monomial_evaluator.h"
+#include <omp.h>
+#include <stdexcept>
+#include <algorithm>
+
+/**
+ * @brief Количество точек, вычисляемых одновременно (цикл по точкам векторизуется)
+ */
+static const size_t MONOMIAL_BLOCK_SIZE = 64;
+
+MonomialEvaluator::MonomialEvaluator() : center(0.0), inverse_half_width(1.0) {}
+
+MonomialEvaluator::MonomialEvaluator(const double* x, const double* newton_coefficients, size_t n,
+                                     double a, double b) {
+    if (!(b > a)) {
+        throw std::invalid_argument("Интервал должен удовлетворять условию a < b");
+    }
+    center = 0.5 * (a + b);
+    const double half_width = 0.5 * (b - a);
+    inverse_half_width = 1.0 / half_width;
+
+    coefficients.assign(n, 0.0);
+    if (n == 0) {
+        return;
+    }
+
+    // Вложенная схема: q = c_{n-1}; q = h (u - u_i) q + c_i, где t - x_i = h (u - u_i)
+    double* q = coefficients.data();
+    q[0] = newton_coefficients[n-1];
+    for (size_t i = n - 1, m = 1; i-- > 0; m++) {
+        const double u_i = (x[i] - center) * inverse_half_width;
+        q[m] = half_width * q[m-1];
+        for (size_t k = m - 1; k > 0; k--) {
+            q[k] = half_width * (q[k-1] - u_i * q[k]);
+        }
+        q[0] = -half_width * u_i * q[0] + newton_coefficients[i];
+    }
+}
+
+double MonomialEvaluator::evaluate(double point) const {
+    const size_t n = coefficients.size();
+    if (n == 0) {
+        return 0.0;
+    }
+    const double u = (point - center) * inverse_half_width;
+    double p = coefficients[n-1];
+    for (size_t k = n - 1; k-- > 0; ) {
+        p = p * u + coefficients[k];
+    }
+    return p;
+}
+
+void MonomialEvaluator::evaluate(const double* points, double* results, size_t count) const {
+    const size_t n = coefficients.size();
+    const double* a = coefficients.data();
+    const long num_blocks = static_cast<long>((count + MONOMIAL_BLOCK_SIZE - 1) / MONOMIAL_BLOCK_SIZE);
+
+    #pragma omp parallel for schedule(static)
+    for (long block = 0; block < num_blocks; block++) {
+        const size_t first = static_cast<size_t>(block) * MONOMIAL_BLOCK_SIZE;
+        const size_t m = std::min(MONOMIAL_BLOCK_SIZE, count - first);
+        double u[MONOMIAL_BLOCK_SIZE];
+        double p[MONOMIAL_BLOCK_SIZE];
+        for (size_t j = 0; j < m; j++) {
+            u[j] = (points[first + j] - center) * inverse_half_width;
+            p[j] = n > 0 ? a[n-1] : 0.0;
+        }
+        for (size_t k = n > 0 ? n - 1 : 0; k-- > 0; ) {
+            const double ak = a[k];
+            for (size_t j = 0; j < m; j++) {
+                p[j] = p[j] * u[j] + ak;
+            }
+        }
+        std::copy(p, p + m, results + first);
+    }
+}
+
+const AlignedVector<double>& MonomialEvaluator::get_coefficients() const {
+    return coefficients;
+}
+
+size_t MonomialEvaluator::size() const {
+    return coefficients.size();
+}
@@ -0,0 +1,70 @@
+/**
+ * @file monomial_evaluator.h
+ * @brief Полином в мономиальном базисе, полученный из формы Ньютона
+ */
+
+#ifndef MONOMIAL_EVALUATOR_H
+#define MONOMIAL_EVALUATOR_H
+
+#include "aligned_buffer.h"
+#include <cstddef>
+
+/**
+ * @class MonomialEvaluator
+ * @brief Компактный вычислитель p(t) = sum a_k u^k, u = (t - center) / half_width
+ *
+ * Хранит только один массив коэффициентов, поэтому при вычислении схемой
+ * Горнера читается вдвое меньше данных, чем для формы Ньютона (узлы +
+ * коэффициенты), а копирование объекта в каждый поток дешево. Переменная
+ * сдвинута и отмасштабирована на [-1, 1], что улучшает обусловленность
+ * базиса по сравнению с мономами от t.
+ */
+class MonomialEvaluator {
+private:
+    AlignedVector<double> coefficients;  ///< Коэффициенты a_k при u^k
+    double center;                       ///< Центр интервала
+    double inverse_half_width;           ///< 1 / полуширина интервала
+
+public:
+    /**
+     * @brief Конструктор по умолчанию (пустой полином)
+     */
+    MonomialEvaluator();
+
+    /**
+     * @brief Переводит полином Ньютона в мономиальный базис за O(n^2)
+     * @param x Узлы интерполяции
+     * @param newton_coefficients Коэффициенты полинома Ньютона
+     * @param n Количество узлов
+     * @param a Левая граница интервала
+     * @param b Правая граница интервала
+     */
+    MonomialEvaluator(const double* x, const double* newton_coefficients, size_t n, double a, double b);
+
+    /**
+     * @brief Вычисляет полином в точке схемой Горнера
+     * @param point Точка
+     * @return Значение полинома
+     */
+    double evaluate(double point) const;
+
+    /**
+     * @brief Вычисляет полином в наборе точек с использованием OpenMP
+     * @param points Точки
+     * @param results Массив результатов (count элементов)
+     * @param count Количество точек
+     */
+    void evaluate(const double* points, double* results, size_t count) const;
+
+    /**
+     * @brief Возвращает коэффициенты a_k
+     */
+    const AlignedVector<double>& get_coefficients() const;
+
+    /**
+     * @brief Возвращает степень полинома + 1
+     */
+    size_t size() const;
+};
+
+#endif // MONOMIAL_EVALUATOR_H
@@ -0,0 +1,171 @@
+#include "multi_table_interpolator.h"
+#include <omp.h>
+#include <stdexcept>
+#include <cmath>
+#include <algorithm>
+
+/**
+ * @brief Количество таблиц в блоке (узлы и коэффициенты блока помещаются в L2)
+ */
+static const size_t TABLE_BLOCK_SIZE = 256;
+
+MultiTableInterpolator::MultiTableInterpolator() : table_count(0), node_count(0) {}
+
+MultiTableInterpolator::MultiTableInterpolator(const std::vector<std::vector<double>>& x,
+                                               const std::vector<std::vector<double>>& y)
+    : table_count(0), node_count(0) {
+    set_tables(x, y);
+}
+
+void MultiTableInterpolator::set_tables(const std::vector<std::vector<double>>& x,
+                                        const std::vector<std::vector<double>>& y) {
+    if (x.size() != y.size()) {
+        throw std::invalid_argument("Количество таблиц x и y должно совпадать");
+    }
+    if (x.empty()) {
+        throw std::invalid_argument("Необходима как минимум одна таблица");
+    }
+    const size_t n = x[0].size();
+    if (n < 2) {
+        throw std::invalid_argument("Необходимо как минимум 2 точки для интерполяции");
+    }
+    for (size_t t = 0; t < x.size(); t++) {
+        if (x[t].size() != n || y[t].size() != n) {
+            throw std::invalid_argument("Все таблицы должны иметь одинаковое количество узлов");
+        }
+    }
+
+    const size_t tables = x.size();
+    AlignedVector<double> new_x(n * tables);
+    AlignedVector<double> new_y(n * tables);
+    bool duplicate = false;
+    const long num_tables = static_cast<long>(tables);
+
+    #pragma omp parallel
+    {
+        std::vector<size_t> indices(n);
+
+        #pragma omp for schedule(static) reduction(||:duplicate)
+        for (long t = 0; t < num_tables; t++) {
+            const std::vector<double>& xt = x[t];
+            for (size_t i = 0; i < n; i++) {
+                indices[i] = i;
+            }
+            std::sort(indices.begin(), indices.end(), [&](size_t i, size_t j) {
+                return xt[i] < xt[j];
+            });
+            for (size_t i = 0; i < n; i++) {
+                new_x[i * tables + t] = xt[indices[i]];
+                new_y[i * tables + t] = y[t][indices[i]];
+                if (i > 0 && std::abs(new_x[i * tables + t] - new_x[(i - 1) * tables + t]) < 1e-10) {
+                    duplicate = true;
+                }
+            }
+        }
+    }
+    if (duplicate) {
+        throw std::runtime_error("Деление на ноль при вычислении разделенных разностей");
+    }
+
+    table_count = tables;
+    node_count = n;
+    x_nodes.swap(new_x);
+    coefficients.swap(new_y);
+    compute_coefficients();
+}
+
+void MultiTableInterpolator::compute_coefficients() {
+    const size_t n = node_count;
+    const size_t tables = table_count;
+    const long num_blocks = static_cast<long>((tables + TABLE_BLOCK_SIZE - 1) / TABLE_BLOCK_SIZE);
+    double* c = coefficients.data();
+    const double* x = x_nodes.data();
+
+    // Разности на месте по убыванию i: c[i] = (c[i] - c[i-1]) / (x[i] - x[i-j]);
+    // внутренний цикл идет по таблицам блока и векторизуется
+    #pragma omp parallel for schedule(static)
+    for (long b = 0; b < num_blocks; b++) {
+        const size_t first = static_cast<size_t>(b) * TABLE_BLOCK_SIZE;
+        const size_t width = std::min(TABLE_BLOCK_SIZE, tables - first);
+        for (size_t j = 1; j < n; j++) {
+            for (size_t i = n - 1; i >= j; i--) {
+                double* ci = c + i * tables + first;
+                const double* ci_prev = c + (i - 1) * tables + first;
+                const double* xi = x + i * tables + first;
+                const double* xi_left = x + (i - j) * tables + first;
+                #pragma omp simd
+                for (size_t t = 0; t < width; t++) {
+                    ci[t] = (ci[t] - ci_prev[t]) / (xi[t] - xi_left[t]);
+                }
+            }
+        }
+    }
+}
+
+double MultiTableInterpolator::interpolate(size_t table, double point) const {
+    if (table >= table_count) {
+        throw std::out_of_range("Номер таблицы вне диапазона");
+    }
+    const size_t n = node_count;
+    double p = coefficients[(n - 1) * table_count + table];
+    for (size_t i = n - 1; i-- > 0; ) {
+        p = p * (point - x_nodes[i * table_count + table]) + coefficients[i * table_count + table];
+    }
+    return p;
+}
+
+std::vector<double> MultiTableInterpolator::interpolate_multiple(const std::vector<double>& points) const {
+    if (table_count == 0) {
+        throw std::runtime_error("Данные не инициализированы");
+    }
+    const size_t n = node_count;
+    const size_t tables = table_count;
+    std::vector<double> results(points.size() * tables);
+    const long num_blocks = static_cast<long>((tables + TABLE_BLOCK_SIZE - 1) / TABLE_BLOCK_SIZE);
+    const long num_points = static_cast<long>(points.size());
+    const double* x = x_nodes.data();
+    const double* c = coefficients.data();
+
+    // Статическое распределение пар (блок таблиц, точка) оставляет за потоком
+    // последовательные точки одного блока - его узлы остаются в кэше
+    #pragma omp parallel for collapse(2) schedule(static)
+    for (long b = 0; b < num_blocks; b++) {
+        for (long p = 0; p < num_points; p++) {
+            const size_t first = static_cast<size_t>(b) * TABLE_BLOCK_SIZE;
+            const size_t width = std::min(TABLE_BLOCK_SIZE, tables - first);
+            const double t_point = points[p];
+            double* out = results.data() + static_cast<size_t>(p) * tables + first;
+
+            const double* c_last = c + (n - 1) * tables + first;
+            #pragma omp simd
+            for (size_t t = 0; t < width; t++) {
+                out[t] = c_last[t];
+            }
+            for (size_t i = n - 1; i-- > 0; ) {
+                const double* xi = x + i * tables + first;
+                const double* ci = c + i * tables + first;
+                #pragma omp simd
+                for (size_t t = 0; t < width; t++) {
+                    out[t] = out[t] * (t_point - xi[t]) + ci[t];
+                }
+            }
+        }
+    }
+
+    return results;
+}
+
+double MultiTableInterpolator::get_coefficient(size_t table, size_t j) const {
+    if (table >= table_count || j >= node_count) {
+        throw std::out_of_range("Индекс коэффициента вне диапазона");
+    }
+    return coefficients[j * table_count + table];
+}
+
+size_t MultiTableInterpolator::get_table_count() const {
+    return table_count;
+}
+
+size_t MultiTableInterpolator::get_node_count() const {
+    return node_count;
+}
@@ -0,0 +1,93 @@
+/**
+ * @file multi_table_interpolator.h
+ * @brief Интерполяция множества небольших независимых таблиц в формате структуры массивов
+ */
+
+#ifndef MULTI_TABLE_INTERPOLATOR_H
+#define MULTI_TABLE_INTERPOLATOR_H
+
+#include "aligned_buffer.h"
+#include <vector>
+#include <cstddef>
+
+/**
+ * @class MultiTableInterpolator
+ * @brief Полиномы Ньютона для множества таблиц с одинаковым числом узлов
+ *
+ * Узлы и коэффициенты всех таблиц хранятся как структура массивов: строка i
+ * содержит i-й узел (коэффициент) всех таблиц подряд. Благодаря этому и
+ * построение разделенных разностей, и схема Горнера выполняются сразу для
+ * многих таблиц в SIMD-лентах, а одна аллокация заменяет тысячи объектов
+ * NewtonInterpolator.
+ */
+class MultiTableInterpolator {
+private:
+    size_t table_count;                  ///< Количество таблиц
+    size_t node_count;                   ///< Количество узлов в каждой таблице
+    AlignedVector<double> x_nodes;       ///< Узлы, [узел][таблица]
+    AlignedVector<double> coefficients;  ///< Коэффициенты Ньютона, [узел][таблица]
+
+    /**
+     * @brief Строит коэффициенты всех таблиц одним параллельным проходом
+     */
+    void compute_coefficients();
+
+public:
+    /**
+     * @brief Конструктор по умолчанию
+     */
+    MultiTableInterpolator();
+
+    /**
+     * @brief Конструктор с инициализацией данными
+     * @param x Значения x каждой таблицы
+     * @param y Значения y каждой таблицы
+     */
+    MultiTableInterpolator(const std::vector<std::vector<double>>& x,
+                           const std::vector<std::vector<double>>& y);
+
+    /**
+     * @brief Устанавливает таблицы
+     * @param x Значения x каждой таблицы
+     * @param y Значения y каждой таблицы
+     *
+     * Все таблицы должны иметь одинаковое число узлов (не менее 2). Узлы
+     * каждой таблицы сортируются, как в NewtonInterpolator::set_data.
+     */
+    void set_tables(const std::vector<std::vector<double>>& x,
+                    const std::vector<std::vector<double>>& y);
+
+    /**
+     * @brief Выполняет интерполяцию одной таблицы в точке
+     * @param table Номер таблицы
+     * @param point Точка для интерполяции
+     * @return Интерполированное значение
+     */
+    double interpolate(size_t table, double point) const;
+
+    /**
+     * @brief Вычисляет все таблицы во всех точках с использованием OpenMP
+     * @param points Вектор точек
+     * @return Матрица значений, элемент [p * get_table_count() + t] - таблица t в точке p
+     */
+    std::vector<double> interpolate_multiple(const std::vector<double>& points) const;
+
+    /**
+     * @brief Возвращает коэффициент f[x_0..x_j] таблицы
+     * @param table Номер таблицы
+     * @param j Номер коэффициента
+     */
+    double get_coefficient(size_t table, size_t j) const;
+
+    /**
+     * @brief Возвращает количество таблиц
+     */
+    size_t get_table_count() const;
+
+    /**
+     * @brief Возвращает количество узлов в каждой таблице
+     */
+    size_t get_node_count() const;
+};
+
+#endif // MULTI_TABLE_INTERPOLATOR_H
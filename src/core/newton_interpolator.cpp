@@ -4,14 +4,48 @@
 #include <cmath>
 #include <iostream>
 #include <algorithm>
+#include <limits>
 
-NewtonInterpolator::NewtonInterpolator() {}
+/**
+ * @brief Передает движку коэффициенты интерполятора на время обновления
+ *
+ * Буфер возвращается в деструкторе, в том числе если движок бросил исключение.
+ */
+class CoefficientLoan {
+private:
+    DividedDifferenceEngine& engine;
+    AlignedVector<double>& coefficients;
 
-NewtonInterpolator::NewtonInterpolator(const std::vector<double>& x, const std::vector<double>& y) {
+public:
+    CoefficientLoan(DividedDifferenceEngine& engine, AlignedVector<double>& coefficients)
+        : engine(engine), coefficients(coefficients) {
+        engine.swap_coefficients(coefficients);
+    }
+
+    ~CoefficientLoan() {
+        engine.swap_coefficients(coefficients);
+    }
+
+    CoefficientLoan(const CoefficientLoan&) = delete;
+    CoefficientLoan& operator=(const CoefficientLoan&) = delete;
+};
+
+NewtonInterpolator::NewtonInterpolator(InterpolationMethod method)
+    : method(method), window_size(0), updates_since_rebuild(0), evaluation_kernel(EvaluationKernel::Auto),
+      resolved_kernel(EvaluationKernels::detect_best()), autotuner(nullptr), perf_profiler(nullptr), grid_tolerance(DEFAULT_GRID_TOLERANCE) {}
+
+NewtonInterpolator::NewtonInterpolator(const std::vector<double>& x, const std::vector<double>& y,
+                                       InterpolationMethod method)
+    : method(method), window_size(0), updates_since_rebuild(0), evaluation_kernel(EvaluationKernel::Auto),
+      resolved_kernel(EvaluationKernels::detect_best()), autotuner(nullptr), perf_profiler(nullptr), grid_tolerance(DEFAULT_GRID_TOLERANCE) {
     set_data(x, y);
 }
 
 void NewtonInterpolator::set_data(const std::vector<double>& x, const std::vector<double>& y) {
+    set_data(std::span<const double>(x), std::span<const double>(y));
+}
+
+void NewtonInterpolator::set_data(std::span<const double> x, std::span<const double> y) {
     if (x.size() != y.size()) {
         throw std::invalid_argument("Размеры векторов x и y должны совпадать");
     }
@@ -19,44 +53,147 @@ void NewtonInterpolator::set_data(const std::vector<double>& x, const std::vecto
         throw std::invalid_argument("Необходимо как минимум 2 точки для интерполяции");
     }
     
-    std::vector<size_t> indices(x.size());
-    for (size_t i = 0; i < indices.size(); i++) {
-        indices[i] = i;
+    {
+        // Счетчики сортировки закрываются до построения коэффициентов, этапы не пересекаются
+        PhaseTimer::clock::time_point sort_start = PhaseTimer::clock::now();
+        PerfProfiler::Scope sort_counters(perf_profiler, InterpolationPhase::Sort);
+        x_values.resize(x.size());
+        y_values.resize(y.size());
+        
+        if (std::is_sorted(x.begin(), x.end())) {
+            std::copy(x.begin(), x.end(), x_values.begin());
+            std::copy(y.begin(), y.end(), y_values.begin());
+        } else {
+            sort_order.resize(x.size());
+            for (size_t i = 0; i < sort_order.size(); i++) {
+                sort_order[i] = i;
+            }
+            
+            std::sort(sort_order.begin(), sort_order.end(), [&](size_t i, size_t j) {
+                return x[i] < x[j];
+            });
+            
+            for (size_t i = 0; i < sort_order.size(); i++) {
+                x_values[i] = x[sort_order[i]];
+                y_values[i] = y[sort_order[i]];
+            }
+        }
+        timer.record(InterpolationPhase::Sort, sort_start);
     }
     
-    std::sort(indices.begin(), indices.end(), [&](size_t i, size_t j) {
-        return x[i] < x[j];
-    });
-    
-    x_values.resize(x.size());
-    y_values.resize(y.size());
+    compute_divided_differences();
+}
+
+void NewtonInterpolator::set_data(std::span<const double> x, std::span<const double> y,
+                                  std::span<const double> newton_coefficients) {
+    if (newton_coefficients.size() != x.size()) {
+        throw std::invalid_argument("Количество коэффициентов должно совпадать с количеством узлов");
+    }
+    if (!std::is_sorted(x.begin(), x.end())) {
+        throw std::invalid_argument("Готовые коэффициенты допустимы только для отсортированных узлов");
+    }
+    if (method != InterpolationMethod::Newton || differences.get_keep_full_table()) {
+        set_data(x, y);
+        return;
+    }
+    if (x.size() != y.size()) {
+        throw std::invalid_argument("Размеры векторов x и y должны совпадать");
+    }
+    if (x.size() < 2) {
+        throw std::invalid_argument("Необходимо как минимум 2 точки для интерполяции");
+    }
     
-    for (size_t i = 0; i < indices.size(); i++) {
-        x_values[i] = x[indices[i]];
-        y_values[i] = y[indices[i]];
+    PhaseTimer::clock::time_point start = PhaseTimer::clock::now();
+    x_values.assign(x.begin(), x.end());
+    y_values.assign(y.begin(), y.end());
+    {
+        CoefficientLoan loan(differences, coefficients);
+        differences.assign(newton_coefficients.data(), newton_coefficients.size());
+    }
+    updates_since_rebuild = 0;
+    timer.record(InterpolationPhase::Coefficients, start);
+}
+
+void NewtonInterpolator::add_node(double x, double y) {
+    if (method == InterpolationMethod::Piecewise) {
+        throw std::logic_error("Кусочный режим поддерживает только set_data с отсортированной таблицей");
+    }
+    while (window_size > 0 && x_values.size() >= window_size) {
+        drop_oldest_node();
     }
     
-    compute_divided_differences();
+    if (method == InterpolationMethod::Barycentric) {
+        barycentric.append(x, y);
+    } else {
+        if (!differences.has_diagonal()) {
+            compute_divided_differences();  // коэффициенты были загружены без диагонали
+        }
+        CoefficientLoan loan(differences, coefficients);
+        differences.append(x_values.data(), x, y);
+    }
+    x_values.push_back(x);
+    y_values.push_back(y);
 }
 
-void NewtonInterpolator::compute_divided_differences() {
-    int n = static_cast<int>(x_values.size());
-    divided_differences.clear();
-    divided_differences.resize(n, std::vector<double>(n, 0.0));
+void NewtonInterpolator::drop_oldest_node() {
+    if (method == InterpolationMethod::Barycentric) {
+        barycentric.drop_front();
+    } else if (method == InterpolationMethod::Newton) {
+        if (!differences.has_diagonal()) {
+            compute_divided_differences();
+        }
+        CoefficientLoan loan(differences, coefficients);
+        differences.drop_front(x_values.data());
+    }
+    x_values.erase(x_values.begin());
+    y_values.erase(y_values.begin());
+    
+    // Кусочный режим перестраивается один раз после всех удалений (см. set_window_size)
+    if (method != InterpolationMethod::Piecewise && ++updates_since_rebuild >= window_size) {
+        compute_divided_differences();
+    }
+}
 
-    for (int i = 0; i < n; i++) {
-        divided_differences[i][0] = y_values[i];
+void NewtonInterpolator::set_window_size(size_t k) {
+    if (k == 1) {
+        throw std::invalid_argument("Размер окна должен быть 0 или не менее 2");
+    }
+    window_size = k;
+    bool dropped = false;
+    while (k > 0 && x_values.size() > k) {
+        drop_oldest_node();
+        dropped = true;
     }
+    if (dropped && method == InterpolationMethod::Piecewise) {
+        compute_divided_differences();
+    }
+}
 
-    for (int j = 1; j < n; j++) {
-        for (int i = 0; i < n - j; i++) {
-            double denominator = x_values[i+j] - x_values[i];
-            if (std::abs(denominator) < 1e-10) {
-                throw std::runtime_error("Деление на ноль при вычислении разделенных разностей");
-            }
-            divided_differences[i][j] = (divided_differences[i+1][j-1] - divided_differences[i][j-1]) / denominator;
-        }
+size_t NewtonInterpolator::get_window_size() const {
+    return window_size;
+}
+
+void NewtonInterpolator::compute_divided_differences() {
+    updates_since_rebuild = 0;
+    PhaseTimer::clock::time_point start = PhaseTimer::clock::now();
+    PerfProfiler::Scope counters(perf_profiler, InterpolationPhase::Coefficients);
+    if (method == InterpolationMethod::Barycentric) {
+        barycentric.compute(x_values.data(), y_values.data(), x_values.size());
+    } else if (method == InterpolationMethod::Piecewise) {
+        piecewise.compute(x_values.data(), y_values.data(), x_values.size());
+    } else {
+        CoefficientLoan loan(differences, coefficients);
+        differences.compute(x_values.data(), y_values.data(), x_values.size());
     }
+    timer.record(InterpolationPhase::Coefficients, start);
+}
+
+void NewtonInterpolator::set_piecewise_degree(size_t k) {
+    piecewise.set_degree(k);
+}
+
+size_t NewtonInterpolator::get_piecewise_degree() const {
+    return piecewise.get_degree();
 }
 
 double NewtonInterpolator::interpolate(double point) const {
@@ -64,35 +201,250 @@ double NewtonInterpolator::interpolate(double point) const {
         throw std::runtime_error("Данные не инициализированы");
     }
     
-    double result = divided_differences[0][0];
-    double product_term = 1.0;
-    
-    for (size_t i = 1; i < x_values.size(); i++) {
-        product_term *= (point - x_values[i-1]);
-        result += divided_differences[0][i] * product_term;
+    if (method == InterpolationMethod::Barycentric) {
+        return barycentric.evaluate(point);
+    }
+    if (method == InterpolationMethod::Piecewise) {
+        return piecewise.evaluate(point);
     }
     
-    return result;
+    return evaluate_newton(point);
 }
 
 std::vector<double> NewtonInterpolator::interpolate_multiple(const std::vector<double>& points) const {
     std::vector<double> results(points.size());
-    int num_points = static_cast<int>(points.size());
-
-    #pragma omp parallel for schedule(dynamic, 100)
-    for (int i = 0; i < num_points; i++) {
-        try {
-            results[i] = interpolate(points[i]);
-        } catch (const std::exception& e) {
-            results[i] = std::numeric_limits<double>::quiet_NaN();
+    interpolate_into(points, results);
+    return results;
+}
+
+std::vector<double> NewtonInterpolator::interpolate_multiple(const std::vector<double>& points,
+                                                             BatchTelemetry& telemetry) const {
+    std::vector<double> results(points.size());
+    telemetry = BatchTelemetry();
+    if (x_values.empty()) {
+        std::fill(results.begin(), results.end(), std::numeric_limits<double>::quiet_NaN());
+        return results;
+    }
+    
+    TuningConfig config;
+    config.kernel = evaluation_kernel;
+    config.schedule = schedule;
+    if (autotuner != nullptr) {
+        config = autotuner->choose(x_values.size(), points.size());
+    }
+    const EvaluationKernel resolved = EvaluationKernels::resolve(config.kernel);
+    const size_t block = batch_evaluator.get_point_block();
+    const size_t num_blocks = (points.size() + block - 1) / block;
+    
+    PhaseTimer::clock::time_point start = PhaseTimer::clock::now();
+    TelemetryRecorder recorder(ParallelScheduler::team_size(config.schedule));
+    auto body = [&](size_t first_block, size_t last_block) {
+        TelemetryRecorder::clock::time_point chunk_start = TelemetryRecorder::clock::now();
+        const size_t begin = first_block * block;
+        const size_t end = std::min(last_block * block, points.size());
+        evaluate_range(resolved, points.data() + begin, results.data() + begin, end - begin);
+        recorder.record_chunk(ParallelScheduler::current_thread(config.schedule), chunk_start,
+                              TelemetryRecorder::clock::now(), end - begin);
+    };
+    ParallelScheduler::parallel_for(config.schedule, num_blocks, body);
+    telemetry = recorder.finish();
+    timer.record(InterpolationPhase::Evaluation, start, points.size());
+    
+    return results;
+}
+
+InterpolationStatus NewtonInterpolator::interpolate_into(std::span<const double> points,
+                                                         std::span<double> results) const noexcept {
+    if (autotuner != nullptr) {
+        TuningConfig config = autotuner->choose(x_values.size(), points.size());
+        return evaluate_into(points, results, config.kernel, config.schedule);
+    }
+    return evaluate_into(points, results, resolved_kernel, schedule);
+}
+
+InterpolationStatus NewtonInterpolator::interpolate_into(std::span<const double> points,
+                                                         std::span<double> results,
+                                                         const ParallelSchedule& schedule) const {
+    if (perf_profiler != nullptr) {
+        perf_profiler->reserve_threads(ParallelScheduler::team_size(schedule));
+    }
+    return evaluate_into(points, results, resolved_kernel, schedule);
+}
+
+InterpolationStatus NewtonInterpolator::evaluate_into(std::span<const double> points, std::span<double> results,
+                                                      EvaluationKernel kernel,
+                                                      const ParallelSchedule& schedule) const {
+    if (points.size() != results.size()) {
+        return InterpolationStatus::SizeMismatch;
+    }
+    EvaluationKernel resolved = kernel;
+    if (!EvaluationKernels::try_resolve(kernel, resolved)) {
+        return InterpolationStatus::UnsupportedKernel;
+    }
+    if (x_values.empty()) {
+        std::fill(results.begin(), results.end(), std::numeric_limits<double>::quiet_NaN());
+        return InterpolationStatus::NotInitialized;
+    }
+    
+    PhaseTimer::clock::time_point start = PhaseTimer::clock::now();
+    // Все способы идут через один планировщик, как в interpolate_multiple с телеметрией.
+    // Профилировщик измеряет каждую порцию в том же распределении, без отдельной области
+    const size_t block = batch_evaluator.get_point_block();
+    const size_t num_blocks = (points.size() + block - 1) / block;
+    auto body = [&](size_t first_block, size_t last_block) {
+        const size_t begin = first_block * block;
+        const size_t end = std::min(last_block * block, points.size());
+        const size_t thread = perf_profiler != nullptr ? ParallelScheduler::current_thread(schedule) : 0;
+        PerfProfiler::Scope counters(perf_profiler, InterpolationPhase::Evaluation, end - begin, thread);
+        evaluate_range(resolved, points.data() + begin, results.data() + begin, end - begin);
+    };
+    ParallelScheduler::parallel_for(schedule, num_blocks, body);
+    timer.record(InterpolationPhase::Evaluation, start, points.size());
+    
+    return InterpolationStatus::Ok;
+}
+
+void NewtonInterpolator::evaluate_range(EvaluationKernel kernel, const double* points, double* results,
+                                        size_t count) const {
+    if (method == InterpolationMethod::Barycentric) {
+        barycentric.evaluate_block(points, results, count);
+    } else if (method == InterpolationMethod::Piecewise) {
+        piecewise.evaluate_block(points, results, count);
+    } else {
+        batch_evaluator.evaluate_block(kernel, x_values.data(), coefficients.data(),
+                                       x_values.size(), points, results, count);
+    }
+}
+
+std::vector<double> NewtonInterpolator::interpolate_grid(double start, double end, size_t count) const {
+    if (count < 2) {
+        throw std::invalid_argument("Количество точек должно быть не менее 2");
+    }
+    if (x_values.empty()) {
+        throw std::runtime_error("Данные не инициализированы");
+    }
+    
+    std::vector<double> results(count);
+    const double step = (end - start) / (count - 1);
+    PhaseTimer::clock::time_point timer_start = PhaseTimer::clock::now();
+    
+    if (method == InterpolationMethod::Newton) {
+        GridEvaluator::evaluate(evaluation_kernel, x_values.data(), coefficients.data(),
+                                x_values.size(), start, step, results.data(), count, grid_tolerance);
+    } else {
+        int n = static_cast<int>(count);
+        
+        #pragma omp parallel for schedule(static)
+        for (int i = 0; i < n; i++) {
+            results[i] = interpolate(start + i * step);
         }
     }
     
+    timer.record(InterpolationPhase::Evaluation, timer_start, count);
     return results;
 }
 
-size_t NewtonInterpolator::get_node_count() const {
-    return x_values.size();
+void NewtonInterpolator::set_grid_tolerance(double tolerance) {
+    if (!(tolerance > 0.0)) {
+        throw std::invalid_argument("Допуск должен быть положительным");
+    }
+    grid_tolerance = tolerance;
+}
+
+ChebyshevEvaluator NewtonInterpolator::to_chebyshev() const {
+    if (method != InterpolationMethod::Newton) {
+        throw std::logic_error("Перевод в другой базис доступен только в режиме Ньютона");
+    }
+    if (x_values.empty()) {
+        throw std::runtime_error("Данные не инициализированы");
+    }
+    auto range = std::minmax_element(x_values.begin(), x_values.end());
+    return ChebyshevEvaluator(x_values.data(), coefficients.data(), x_values.size(),
+                              *range.first, *range.second);
+}
+
+MonomialEvaluator NewtonInterpolator::to_monomial() const {
+    if (method != InterpolationMethod::Newton) {
+        throw std::logic_error("Перевод в другой базис доступен только в режиме Ньютона");
+    }
+    if (x_values.empty()) {
+        throw std::runtime_error("Данные не инициализированы");
+    }
+    auto range = std::minmax_element(x_values.begin(), x_values.end());
+    return MonomialEvaluator(x_values.data(), coefficients.data(), x_values.size(),
+                             *range.first, *range.second);
+}
+
+void NewtonInterpolator::set_evaluation_kernel(EvaluationKernel kernel) {
+    resolved_kernel = EvaluationKernels::resolve(kernel);
+    evaluation_kernel = kernel;
+}
+
+EvaluationKernel NewtonInterpolator::get_evaluation_kernel() const {
+    return evaluation_kernel;
+}
+
+void NewtonInterpolator::set_parallel_build_threshold(size_t threshold) {
+    differences.set_parallel_threshold(threshold);
+}
+
+InterpolationTimings NewtonInterpolator::get_timings() const {
+    return timer.snapshot();
+}
+
+void NewtonInterpolator::reset_timings() {
+    timer.reset();
+}
+
+void NewtonInterpolator::set_batch_tiling(size_t point_block, size_t node_block) {
+    batch_evaluator.set_tiling(point_block, node_block);
+}
+
+void NewtonInterpolator::set_schedule(const ParallelSchedule& schedule) {
+    if (schedule.policy == SchedulePolicy::WorkStealing && schedule.pool == nullptr) {
+        WorkStealingPool::shared();
+    }
+    this->schedule = schedule;
+    reserve_profiler_threads();
+}
+
+const ParallelSchedule& NewtonInterpolator::get_schedule() const {
+    return schedule;
+}
+
+void NewtonInterpolator::set_autotuner(const Autotuner* tuner) {
+    autotuner = tuner;
+    reserve_profiler_threads();
+}
+
+void NewtonInterpolator::set_perf_profiler(PerfProfiler* profiler) {
+    perf_profiler = profiler;
+    reserve_profiler_threads();
+}
+
+void NewtonInterpolator::reserve_profiler_threads() {
+    if (perf_profiler == nullptr) {
+        return;
+    }
+    size_t team = std::max(static_cast<size_t>(omp_get_max_threads()), ParallelScheduler::team_size(schedule));
+    if (autotuner != nullptr) {
+        for (const TuningModel& model : autotuner->get_models()) {
+            team = std::max(team, ParallelScheduler::team_size(model.config.schedule));
+        }
+    }
+    perf_profiler->reserve_threads(team);
+}
+
+InterpolationMethod NewtonInterpolator::get_method() const {
+    return method;
+}
+
+void NewtonInterpolator::set_keep_full_table(bool keep_table) {
+    differences.set_keep_full_table(keep_table);
+}
+
+double NewtonInterpolator::get_divided_difference(size_t i, size_t j) const {
+    return differences.get_divided_difference(i, j);
 }
 
 std::vector<double> NewtonInterpolator::generate_points(double start, double end, size_t num_points) {
@@ -2,36 +2,116 @@
  * @file newton_interpolator.h
  * @brief Класс для интерполяции функции методом Ньютона
  */
+#ifndef NEWTON_INTERPOLATOR_H
+#define NEWTON_INTERPOLATOR_H
+
 #include <vector>
 #include <string>
+#include <span>
+#include "basic_newton_interpolator.h"
+#include "divided_difference_engine.h"
+#include "evaluation_kernels.h"
+#include "batch_evaluator.h"
+#include "phase_timings.h"
+#include "barycentric_engine.h"
+#include "piecewise_engine.h"
+#include "grid_evaluator.h"
+#include "monomial_evaluator.h"
+#include "chebyshev_evaluator.h"
+#include "autotuner.h"
+#include "perf_counters.h"
+#include "batch_telemetry.h"
+
+/**
+ * @brief Способ представления и вычисления интерполяционного полинома
+ */
+enum class InterpolationMethod {
+    Newton,      ///< Коэффициенты Ньютона и схема Горнера
+    Barycentric, ///< Барицентрическая форма (устойчива при высоких степенях)
+    Piecewise    ///< Локальные полиномы Ньютона степени k на каждом отрезке
+};
+
+/**
+ * @brief Результат вычисления без исключений (interpolate_into)
+ */
+enum class InterpolationStatus {
+    Ok,             ///< Все точки вычислены
+    NotInitialized, ///< Данные не установлены, результаты заполнены NaN
+    SizeMismatch,   ///< Размеры входного и выходного буферов не совпадают, результаты не изменены
+    UnsupportedKernel ///< Процессор не поддерживает выбранное ядро, результаты не изменены
+};
 
 /**
  * @class NewtonInterpolator
  * @brief Класс для выполнения интерполяции методом Ньютона с поддержкой OpenMP
+ *
+ * Реализация BasicNewtonInterpolator<double>: узлы (x_values) и коэффициенты
+ * Ньютона хранятся в базовом классе, DividedDifferenceEngine строит и
+ * обновляет их на месте (см. DividedDifferenceEngine::swap_coefficients).
  */
-class NewtonInterpolator {
+class NewtonInterpolator : public BasicNewtonInterpolator<double> {
 private:
-    std::vector<double> x_values;  ///< Значения x из таблицы
     std::vector<double> y_values;  ///< Значения y из таблицы
-    std::vector<std::vector<double>> divided_differences;  ///< Таблица разделенных разностей
+    std::vector<size_t> sort_order; ///< Перестановка сортировки, переиспользуемая set_data
+    InterpolationMethod method;           ///< Выбранный способ вычисления
+    DividedDifferenceEngine differences;  ///< Построение коэффициентов (и, опционально, вся таблица)
+    BarycentricEngine barycentric;        ///< Барицентрические веса (для InterpolationMethod::Barycentric)
+    PiecewiseEngine piecewise;            ///< Локальные полиномы (для InterpolationMethod::Piecewise)
+    size_t window_size;                   ///< Размер скользящего окна (0 - без ограничения)
+    size_t updates_since_rebuild;         ///< Число удалений узлов с последнего полного пересчета
+    EvaluationKernel evaluation_kernel;   ///< Ядро для interpolate_multiple
+    EvaluationKernel resolved_kernel;     ///< evaluation_kernel, проверенное и разрешенное в set_evaluation_kernel
+    BatchEvaluator batch_evaluator;       ///< Блочное вычисление для interpolate_multiple
+    ParallelSchedule schedule;            ///< Распределение блоков точек по умолчанию
+    const Autotuner* autotuner;           ///< Профиль автонастройки (nullptr - ядро и распределение заданы явно)
+    PerfProfiler* perf_profiler;          ///< Аппаратные счетчики по этапам (nullptr - не измерять)
+    mutable PhaseTimer timer;             ///< Время подготовки и вычисления
+    double grid_tolerance;                ///< Допуск шагания по разностям в interpolate_grid
     
     /**
-     * @brief Вычисляет разделенные разности для интерполяции
+     * @brief Удаляет самый старый узел с пересчетом коэффициентов за O(n)
+     */
+    void drop_oldest_node();
+    
+    /**
+     * @brief Вычисляет разделенные разности (или веса) для интерполяции
      */
     void compute_divided_differences();
     
+    /**
+     * @brief Вычисляет пакет точек с заданными ядром и распределением
+     *
+     * Ядро разрешается без исключений: неподдерживаемое ядро (например, из
+     * профиля другого процессора) сообщается статусом UnsupportedKernel.
+     */
+    InterpolationStatus evaluate_into(std::span<const double> points, std::span<double> results,
+                                      EvaluationKernel kernel, const ParallelSchedule& schedule) const;
+    
+    /**
+     * @brief Выделяет ячейки профилировщика для команд всех распределений интерполятора
+     */
+    void reserve_profiler_threads();
+    
+    /**
+     * @brief Последовательно вычисляет участок пакета выбранным способом
+     */
+    void evaluate_range(EvaluationKernel kernel, const double* points, double* results, size_t count) const;
+    
 public:
     /**
      * @brief Конструктор по умолчанию
+     * @param method Способ вычисления полинома
      */
-    NewtonInterpolator();
+    explicit NewtonInterpolator(InterpolationMethod method = InterpolationMethod::Newton);
     
     /**
      * @brief Конструктор с инициализацией данными
      * @param x Вектор значений x
      * @param y Вектор значений y
+     * @param method Способ вычисления полинома
      */
-    NewtonInterpolator(const std::vector<double>& x, const std::vector<double>& y);
+    NewtonInterpolator(const std::vector<double>& x, const std::vector<double>& y,
+                       InterpolationMethod method = InterpolationMethod::Newton);
     
     /**
      * @brief Устанавливает данные для интерполяции
@@ -40,6 +120,77 @@ public:
      */
     void set_data(const std::vector<double>& x, const std::vector<double>& y);
     
+    /**
+     * @brief Устанавливает данные без лишних выделений памяти
+     * @param x Значения x
+     * @param y Значения y
+     *
+     * Узлы копируются в уже выделенные буферы; при повторном вызове с тем же
+     * числом узлов память не выделяется. Отсортированная таблица копируется
+     * без построения перестановки.
+     */
+    void set_data(std::span<const double> x, std::span<const double> y);
+    
+    /**
+     * @brief Устанавливает отсортированные узлы с готовыми коэффициентами Ньютона
+     * @param x Значения x (неубывающие)
+     * @param y Значения y
+     * @param newton_coefficients Коэффициенты f[x_0..x_j] для узлов в данном порядке
+     *
+     * Таблица разделенных разностей не строится - узлы копируются, а
+     * коэффициенты принимаются как есть (например, из MappedBinaryFile).
+     * В барицентрическом и кусочном режимах, а также при сохранении полной
+     * таблицы коэффициенты игнорируются и данные обрабатываются как в set_data.
+     *
+     * @throws std::invalid_argument если узлы не отсортированы или число коэффициентов не совпадает
+     */
+    void set_data(std::span<const double> x, std::span<const double> y,
+                  std::span<const double> newton_coefficients);
+    
+    /**
+     * @brief Добавляет узел в конец таблицы без полного пересчета
+     * @param x Значение x нового узла
+     * @param y Значение y нового узла
+     *
+     * Полином Ньютона расширяется за O(n) по последней диагонали таблицы
+     * разделенных разностей. Узлы хранятся в порядке поступления, сортировка
+     * не выполняется. В режиме скользящего окна при заполнении окна
+     * удаляется самый старый узел (для узлов из set_data - самый левый).
+     *
+     * @throws std::logic_error в кусочном режиме, которому нужна отсортированная таблица
+     */
+    void add_node(double x, double y);
+    
+    /**
+     * @brief Устанавливает размер скользящего окна
+     * @param k Максимальное число последних узлов (0 - без ограничения)
+     *
+     * Если узлов больше k, самые старые удаляются. После каждых k удалений
+     * коэффициенты полностью пересчитываются, чтобы ограничить накопление
+     * погрешности, - амортизированная стоимость обновления остается O(k).
+     *
+     * @throws std::invalid_argument если k == 1 (интерполяции нужно не менее
+     *         2 узлов); состояние интерполятора при этом не меняется
+     */
+    void set_window_size(size_t k);
+    
+    /**
+     * @brief Возвращает размер скользящего окна
+     * @return Размер окна (0 - без ограничения)
+     */
+    size_t get_window_size() const;
+    
+    /**
+     * @brief Устанавливает степень локальных полиномов кусочного режима
+     * @param k Степень (не менее 1), вступает в силу при следующем set_data
+     */
+    void set_piecewise_degree(size_t k);
+    
+    /**
+     * @brief Возвращает степень локальных полиномов кусочного режима
+     */
+    size_t get_piecewise_degree() const;
+    
     /**
      * @brief Выполняет интерполяцию в заданной точке
      * @param point Точка для интерполяции
@@ -51,14 +202,181 @@ public:
      * @brief Выполняет интерполяцию в нескольких точках с использованием OpenMP
      * @param points Вектор точек для интерполяции
      * @return Вектор интерполированных значений
+     *
+     * Точки разбиваются на блоки, распределяемые между потоками. Каждый блок
+     * вычисляется векторным ядром по блокам узлов (см. BatchEvaluator).
+     * В барицентрическом и кусочном режимах блоки точек распределяются тем же
+     * планировщиком, а ядро не используется; кусочный режим быстрее
+     * обрабатывает точки, упорядоченные по возрастанию.
      */
     std::vector<double> interpolate_multiple(const std::vector<double>& points) const;
     
     /**
-     * @brief Возвращает количество узлов интерполяции
-     * @return Количество узлов
+     * @brief Выполняет интерполяцию в нескольких точках и собирает телеметрию потоков
+     * @param points Вектор точек для интерполяции
+     * @param telemetry Занятость, ожидание, точки и порции каждого потока команды
+     * @return Вектор интерполированных значений
+     *
+     * Используются то же ядро и распределение, что и в interpolate_multiple
+     * (в том числе выбранные профилем автонастройки). Порцией считается
+     * блок точек BatchEvaluator (для пула - диапазон блоков); в барицентрическом
+     * и кусочном режимах блоки распределяются тем же планировщиком.
+     */
+    std::vector<double> interpolate_multiple(const std::vector<double>& points, BatchTelemetry& telemetry) const;
+    
+    /**
+     * @brief Вычисляет полином в точках в заранее выделенный буфер
+     * @param points Точки для интерполяции
+     * @param results Буфер результатов того же размера
+     * @return Статус вычисления
+     *
+     * Не выделяет память и не бросает исключений, поэтому подходит для
+     * многократных вызовов в рабочем цикле. Ошибки сообщаются статусом.
+     */
+    InterpolationStatus interpolate_into(std::span<const double> points, std::span<double> results) const noexcept;
+    
+    /**
+     * @brief Вычисляет полином в точках с заданным распределением работы
+     * @param points Точки для интерполяции
+     * @param results Буфер результатов того же размера
+     * @param schedule Распределение блоков точек для этого вызова
+     * @return Статус вычисления
+     *
+     * Ядро берется из set_evaluation_kernel, профиль автонастройки не
+     * используется. Распределение применяется во всех режимах: блоки точек
+     * барицентрического и кусочного режимов также идут через ParallelScheduler.
+     */
+    InterpolationStatus interpolate_into(std::span<const double> points, std::span<double> results,
+                                         const ParallelSchedule& schedule) const;
+    
+    /**
+     * @brief Выполняет интерполяцию на равномерной сетке
+     * @param start Начало интервала
+     * @param end Конец интервала
+     * @param count Количество точек (не менее 2)
+     * @return Значения в точках start + i * (end - start) / (count - 1)
+     *
+     * В режиме Ньютона точки получаются шаганием по конечным разностям
+     * (d сложений на точку) с периодической параллельной затравкой, см.
+     * GridEvaluator. Вектор точек сетки не создается.
+     */
+    std::vector<double> interpolate_grid(double start, double end, size_t count) const;
+    
+    /**
+     * @brief Устанавливает допуск шагания по разностям для interpolate_grid
+     * @param tolerance Допустимая относительная погрешность (больше допуск - длиннее участки)
+     */
+    void set_grid_tolerance(double tolerance);
+    
+    /**
+     * @brief Переводит полином в ряд Чебышева на [x_min, x_max]
+     * @return Вычислитель, хранящий только коэффициенты ряда
+     * @throws std::logic_error если интерполятор не в режиме Ньютона
+     */
+    ChebyshevEvaluator to_chebyshev() const;
+    
+    /**
+     * @brief Переводит полином в мономиальный базис на [x_min, x_max]
+     * @return Вычислитель, хранящий только мономиальные коэффициенты
+     * @throws std::logic_error если интерполятор не в режиме Ньютона
+     */
+    MonomialEvaluator to_monomial() const;
+    
+    /**
+     * @brief Устанавливает ядро вычисления для interpolate_multiple
+     * @param kernel Ядро (Auto - выбор по CPUID, остальные - принудительно)
+     * @throws std::invalid_argument если процессор не поддерживает ядро
+     */
+    void set_evaluation_kernel(EvaluationKernel kernel);
+    
+    /**
+     * @brief Возвращает выбранное ядро вычисления
+     * @return Ядро (может быть Auto)
+     */
+    EvaluationKernel get_evaluation_kernel() const;
+    
+    /**
+     * @brief Устанавливает порог параллельного построения коэффициентов
+     * @param threshold Столбцы таблицы длиннее порога вычисляются всеми потоками OpenMP
+     */
+    void set_parallel_build_threshold(size_t threshold);
+    
+    /**
+     * @brief Возвращает накопленное время этапов
+     * @return Время сортировки, построения коэффициентов и вычисления
+     */
+    InterpolationTimings get_timings() const;
+    
+    /**
+     * @brief Обнуляет накопленное время этапов
      */
-    size_t get_node_count() const;
+    void reset_timings();
+    
+    /**
+     * @brief Устанавливает размеры блоков для interpolate_multiple
+     * @param point_block Количество точек в блоке
+     * @param node_block Количество узлов в блоке
+     */
+    void set_batch_tiling(size_t point_block, size_t node_block);
+    
+    /**
+     * @brief Устанавливает распределение блоков точек по умолчанию
+     * @param schedule Политика, порция и (для WorkStealing) пул
+     *
+     * Для WorkStealing без явного пула общий пул создается здесь, чтобы
+     * interpolate_into не выделял ресурсы при первом вызове.
+     */
+    void set_schedule(const ParallelSchedule& schedule);
+    
+    /**
+     * @brief Возвращает распределение блоков точек по умолчанию
+     */
+    const ParallelSchedule& get_schedule() const;
+    
+    /**
+     * @brief Подключает профиль автонастройки
+     * @param tuner Профиль (nullptr - отключить); должен жить дольше интерполятора
+     *
+     * Пока профиль подключен, interpolate_multiple и interpolate_into без
+     * явного распределения выбирают ядро, число потоков и порцию по размеру
+     * таблицы и пакета (см. Autotuner::choose).
+     */
+    void set_autotuner(const Autotuner* tuner);
+    
+    /**
+     * @brief Подключает сбор аппаратных счетчиков по этапам
+     * @param profiler Получатель (nullptr - отключить); должен жить дольше интерполятора
+     *
+     * Сортировка и построение коэффициентов измеряются в вызывающем потоке.
+     * Пакет точек вычисляется обычным путем (распределение, пул и профиль
+     * автонастройки сохраняются), а каждая порция измеряется потоком,
+     * который ее выполнил. Ячейки потоков выделяются здесь, в set_schedule и
+     * set_autotuner, поэтому interpolate_into по-прежнему не выделяет память.
+     * Если счетчики недоступны, интервалы не измеряются.
+     */
+    void set_perf_profiler(PerfProfiler* profiler);
+    
+    /**
+     * @brief Возвращает способ вычисления полинома
+     * @return Способ, заданный при конструировании
+     */
+    InterpolationMethod get_method() const;
+    
+    /**
+     * @brief Включает сохранение полной таблицы разделенных разностей
+     * @param keep_table true - хранить упакованную треугольную таблицу (O(n^2) памяти)
+     *
+     * Изменение вступает в силу при следующем вызове set_data.
+     */
+    void set_keep_full_table(bool keep_table);
+    
+    /**
+     * @brief Возвращает разделенную разность f[x_i..x_{i+j}]
+     * @param i Индекс первого узла
+     * @param j Порядок разности
+     * @return Значение разделенной разности (требует set_keep_full_table(true))
+     */
+    double get_divided_difference(size_t i, size_t j) const;
     
     /**
      * @brief Генерирует равномерно распределенные точки на интервале
@@ -68,4 +386,6 @@ public:
      * @return Вектор сгенерированных точек
      */
     static std::vector<double> generate_points(double start, double end, size_t num_points);
-};
\ No newline at end of file
+};
+
+#endif // NEWTON_INTERPOLATOR_H
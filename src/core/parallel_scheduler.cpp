@@ -0,0 +1,79 @@
+#include "parallel_scheduler.h"
+#include <omp.h>
+#include <algorithm>
+
+void ParallelScheduler::run(const ParallelSchedule& schedule, size_t count,
+                            WorkStealingPool::RangeFunction function, void* context) {
+    if (count == 0) {
+        return;
+    }
+    const int chunk = static_cast<int>(std::max<size_t>(schedule.chunk_size, 1));
+    const long num_blocks = static_cast<long>(count);
+    const int threads = schedule.thread_count > 0 ? static_cast<int>(schedule.thread_count)
+                                                  : omp_get_max_threads();
+
+    // Один поток: параллельная область (и запуск команды потоков) не нужна
+    if (schedule.thread_count == 1 || (threads == 1 && schedule.policy != SchedulePolicy::WorkStealing)) {
+        function(context, 0, count);
+        return;
+    }
+
+    switch (schedule.policy) {
+        case SchedulePolicy::Static:
+            #pragma omp parallel for schedule(static, chunk) num_threads(threads)
+            for (long b = 0; b < num_blocks; b++) {
+                function(context, b, b + 1);
+            }
+            break;
+        case SchedulePolicy::Guided:
+            #pragma omp parallel for schedule(guided, chunk) num_threads(threads)
+            for (long b = 0; b < num_blocks; b++) {
+                function(context, b, b + 1);
+            }
+            break;
+        case SchedulePolicy::WorkStealing: {
+            WorkStealingPool& pool = schedule.pool ? *schedule.pool : WorkStealingPool::shared();
+            pool.run(count, schedule.chunk_size, function, context);
+            break;
+        }
+        case SchedulePolicy::Dynamic:
+        default:
+            #pragma omp parallel for schedule(dynamic, chunk) num_threads(threads)
+            for (long b = 0; b < num_blocks; b++) {
+                function(context, b, b + 1);
+            }
+            break;
+    }
+}
+
+size_t ParallelScheduler::team_size(const ParallelSchedule& schedule) {
+    if (schedule.thread_count == 1) {
+        return 1;
+    }
+    if (schedule.policy == SchedulePolicy::WorkStealing) {
+        WorkStealingPool& pool = schedule.pool ? *schedule.pool : WorkStealingPool::shared();
+        return pool.get_thread_count();
+    }
+    return schedule.thread_count > 0 ? schedule.thread_count : static_cast<size_t>(omp_get_max_threads());
+}
+
+size_t ParallelScheduler::current_thread(const ParallelSchedule& schedule) {
+    // Один поток выполняет весь диапазон в вызывающем потоке (см. run)
+    if (schedule.thread_count == 1) {
+        return 0;
+    }
+    if (schedule.policy == SchedulePolicy::WorkStealing) {
+        return WorkStealingPool::current_worker();
+    }
+    return static_cast<size_t>(omp_get_thread_num());
+}
+
+const char* ParallelScheduler::name(SchedulePolicy policy) {
+    switch (policy) {
+        case SchedulePolicy::Static: return "static";
+        case SchedulePolicy::Dynamic: return "dynamic";
+        case SchedulePolicy::Guided: return "guided";
+        case SchedulePolicy::WorkStealing: return "work-stealing";
+    }
+    return "unknown";
+}
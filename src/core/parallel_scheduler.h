@@ -0,0 +1,83 @@
+/**
+ * @file parallel_scheduler.h
+ * @brief Выбор способа распределения блоков работы между потоками
+ */
+
+#ifndef PARALLEL_SCHEDULER_H
+#define PARALLEL_SCHEDULER_H
+
+#include "work_stealing_pool.h"
+#include <cstddef>
+
+/**
+ * @brief Политика распределения блоков между потоками
+ */
+enum class SchedulePolicy {
+    Static,       ///< OpenMP schedule(static, chunk) - равные доли, без накладных расходов
+    Dynamic,      ///< OpenMP schedule(dynamic, chunk) - блоки по запросу
+    Guided,       ///< OpenMP schedule(guided, chunk) - убывающие порции
+    WorkStealing  ///< Постоянный пул с перехватом работы (WorkStealingPool)
+};
+
+/**
+ * @struct ParallelSchedule
+ * @brief Параметры распределения для одного параллельного цикла
+ */
+struct ParallelSchedule {
+    SchedulePolicy policy = SchedulePolicy::Dynamic; ///< Политика распределения
+    size_t chunk_size = 1;                           ///< Порция (для пула - минимальный диапазон) в блоках
+    size_t thread_count = 0;                         ///< Потоки OpenMP (0 - omp_get_max_threads, 1 - без параллельной области)
+    WorkStealingPool* pool = nullptr;                ///< Пул для WorkStealing (nullptr - общий пул)
+};
+
+/**
+ * @class ParallelScheduler
+ * @brief Выполняет цикл по блокам с заданной политикой распределения
+ */
+class ParallelScheduler {
+public:
+    /**
+     * @brief Выполняет тело для всех блоков [0, count)
+     * @param schedule Параметры распределения
+     * @param count Количество блоков
+     * @param function Тело цикла (для политик OpenMP вызывается по одному блоку)
+     * @param context Контекст, передаваемый телу
+     */
+    static void run(const ParallelSchedule& schedule, size_t count,
+                    WorkStealingPool::RangeFunction function, void* context);
+
+    /**
+     * @brief Выполняет функтор body(begin, end) для всех блоков [0, count)
+     * @param schedule Параметры распределения
+     * @param count Количество блоков
+     * @param body Функтор, вызываемый для диапазонов блоков
+     */
+    template <typename Body>
+    static void parallel_for(const ParallelSchedule& schedule, size_t count, Body& body) {
+        run(schedule, count, [](void* ctx, size_t begin, size_t end) {
+            (*static_cast<Body*>(ctx))(begin, end);
+        }, &body);
+    }
+
+    /**
+     * @brief Количество потоков, между которыми run распределит блоки
+     * @param schedule Параметры распределения
+     */
+    static size_t team_size(const ParallelSchedule& schedule);
+
+    /**
+     * @brief Номер текущего потока внутри run (от 0 до team_size - 1)
+     *
+     * Вне этого диапазона номер бывает только при вложенном запуске пула
+     * из рабочего потока другого, большего пула (пул выполняется в вызывающем потоке).
+     * @param schedule Параметры распределения, переданные в run
+     */
+    static size_t current_thread(const ParallelSchedule& schedule);
+
+    /**
+     * @brief Возвращает название политики
+     */
+    static const char* name(SchedulePolicy policy);
+};
+
+#endif // PARALLEL_SCHEDULER_H
@@ -0,0 +1,248 @@
+#include "perf_counters.h"
+#include <algorithm>
+#include <omp.h>
+#include <sstream>
+#include <utility>
+
+#ifdef __linux__
+#include <linux/perf_event.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#include <cstring>
+#endif
+
+double PerfSample::ipc() const {
+    if (!has(PerfCounter::Cycles) || !has(PerfCounter::Instructions) || get(PerfCounter::Cycles) == 0) {
+        return 0.0;
+    }
+    return static_cast<double>(get(PerfCounter::Instructions)) / static_cast<double>(get(PerfCounter::Cycles));
+}
+
+PerfSample& PerfSample::operator+=(const PerfSample& other) {
+    for (size_t i = 0; i < PERF_COUNTER_COUNT; i++) {
+        values[i] += other.values[i];
+    }
+    available_mask |= other.available_mask;
+    return *this;
+}
+
+PerfCounterGroup::PerfCounterGroup() : leader(-1), available_mask(0) {
+    for (size_t i = 0; i < PERF_COUNTER_COUNT; i++) {
+        descriptors[i] = -1;
+    }
+#ifdef __linux__
+    const uint64_t configs[PERF_COUNTER_COUNT] = {
+        PERF_COUNT_HW_CPU_CYCLES, PERF_COUNT_HW_INSTRUCTIONS,
+        PERF_COUNT_HW_CACHE_MISSES, PERF_COUNT_HW_BRANCH_MISSES
+    };
+    for (size_t i = 0; i < PERF_COUNTER_COUNT; i++) {
+        perf_event_attr attr;
+        std::memset(&attr, 0, sizeof(attr));
+        attr.size = sizeof(attr);
+        attr.type = PERF_TYPE_HARDWARE;
+        attr.config = configs[i];
+        attr.exclude_kernel = 1;
+        attr.exclude_hv = 1;
+        attr.read_format = PERF_FORMAT_GROUP;
+        // pid = 0, cpu = -1: только вызывающий поток на любом ядре
+        int fd = static_cast<int>(syscall(SYS_perf_event_open, &attr, 0, -1, leader, 0));
+        if (fd < 0) {
+            continue;
+        }
+        descriptors[i] = fd;
+        available_mask |= 1u << i;
+        if (leader < 0) {
+            leader = fd;
+        }
+    }
+#endif
+}
+
+PerfCounterGroup::~PerfCounterGroup() {
+#ifdef __linux__
+    for (size_t i = 0; i < PERF_COUNTER_COUNT; i++) {
+        if (descriptors[i] >= 0) {
+            close(descriptors[i]);
+        }
+    }
+#endif
+}
+
+bool PerfCounterGroup::is_available() const {
+    return available_mask != 0;
+}
+
+PerfSample PerfCounterGroup::read() const {
+    PerfSample sample;
+#ifdef __linux__
+    if (leader < 0) {
+        return sample;
+    }
+    // Формат PERF_FORMAT_GROUP: количество, затем значения в порядке открытия
+    uint64_t buffer[1 + PERF_COUNTER_COUNT] = {0};
+    if (::read(leader, buffer, sizeof(buffer)) <= 0) {
+        return sample;
+    }
+    size_t position = 0;
+    for (size_t i = 0; i < PERF_COUNTER_COUNT && position < buffer[0]; i++) {
+        if (descriptors[i] >= 0) {
+            sample.values[i] = buffer[1 + position++];
+        }
+    }
+    sample.available_mask = available_mask;
+#endif
+    return sample;
+}
+
+PerfCounterGroup& PerfCounterGroup::for_current_thread() {
+    static thread_local PerfCounterGroup group;
+    return group;
+}
+
+PerfProfiler::Scope::Scope(PerfProfiler* profiler, InterpolationPhase phase, size_t points)
+    : Scope(profiler, phase, points, static_cast<size_t>(omp_get_thread_num())) {}
+
+PerfProfiler::Scope::Scope(PerfProfiler* profiler, InterpolationPhase phase, size_t points, size_t thread)
+    : profiler(profiler), phase(phase), points(points), thread(thread) {
+    if (profiler != nullptr && profiler->sample_source) {
+        start = profiler->sample_source();
+    } else if (profiler != nullptr) {
+        PerfCounterGroup& group = PerfCounterGroup::for_current_thread();
+        if (group.is_available()) {
+            start = group.read();
+        } else {
+            this->profiler = nullptr;
+        }
+    }
+}
+
+PerfProfiler::Scope::~Scope() {
+    if (profiler == nullptr) {
+        return;
+    }
+    PerfSample end = profiler->sample_source ? profiler->sample_source()
+                                             : PerfCounterGroup::for_current_thread().read();
+    PerfSample delta;
+    for (size_t i = 0; i < PERF_COUNTER_COUNT; i++) {
+        delta.values[i] = end.values[i] - start.values[i];
+    }
+    delta.available_mask = end.available_mask;
+    profiler->accumulate(phase, thread, points, delta);
+}
+
+PerfProfiler::PerfProfiler() : dropped_scopes(0) {
+    reserve_threads(static_cast<size_t>(omp_get_max_threads()));
+}
+
+void PerfProfiler::reserve_threads(size_t count) {
+    std::lock_guard<std::mutex> guard(lock);
+    for (std::vector<PerfThreadSample>& cells : samples) {
+        for (size_t thread = cells.size(); thread < count; thread++) {
+            cells.emplace_back();
+            cells.back().thread = thread;
+        }
+    }
+}
+
+size_t PerfProfiler::get_dropped_scopes() const {
+    return dropped_scopes.load(std::memory_order_relaxed);
+}
+
+void PerfProfiler::set_sample_source(std::function<PerfSample()> source) {
+    std::lock_guard<std::mutex> guard(lock);
+    sample_source = std::move(source);
+}
+
+void PerfProfiler::accumulate(InterpolationPhase phase, size_t thread, size_t points,
+                              const PerfSample& delta) noexcept {
+    // Размер ячеек меняется только в reserve_threads, поэтому здесь не нужна блокировка
+    std::vector<PerfThreadSample>& cells = samples[static_cast<size_t>(phase)];
+    if (thread >= cells.size()) {
+        dropped_scopes.fetch_add(1, std::memory_order_relaxed);
+        return;
+    }
+    PerfThreadSample& cell = cells[thread];
+    std::atomic_ref<size_t>(cell.points).fetch_add(points, std::memory_order_relaxed);
+    std::atomic_ref<size_t>(cell.scopes).fetch_add(1, std::memory_order_relaxed);
+    for (size_t i = 0; i < PERF_COUNTER_COUNT; i++) {
+        std::atomic_ref<uint64_t>(cell.sample.values[i]).fetch_add(delta.values[i], std::memory_order_relaxed);
+    }
+    std::atomic_ref<unsigned>(cell.sample.available_mask).fetch_or(delta.available_mask, std::memory_order_relaxed);
+}
+
+bool PerfProfiler::is_available() {
+    return PerfCounterGroup::for_current_thread().is_available();
+}
+
+void PerfProfiler::reset() {
+    std::lock_guard<std::mutex> guard(lock);
+    for (std::vector<PerfThreadSample>& cells : samples) {
+        for (size_t thread = 0; thread < cells.size(); thread++) {
+            cells[thread] = PerfThreadSample();
+            cells[thread].thread = thread;
+        }
+    }
+    dropped_scopes.store(0, std::memory_order_relaxed);
+}
+
+std::vector<PerfThreadSample> PerfProfiler::get_thread_samples(InterpolationPhase phase) const {
+    std::lock_guard<std::mutex> guard(lock);
+    std::vector<PerfThreadSample> result;
+    for (const PerfThreadSample& cell : samples[static_cast<size_t>(phase)]) {
+        if (cell.scopes > 0) {
+            result.push_back(cell);
+        }
+    }
+    return result;
+}
+
+PerfThreadSample PerfProfiler::get_phase_total(InterpolationPhase phase) const {
+    PerfThreadSample total;
+    for (const PerfThreadSample& cell : get_thread_samples(phase)) {
+        total.points += cell.points;
+        total.scopes += cell.scopes;
+        total.sample += cell.sample;
+    }
+    return total;
+}
+
+/**
+ * @brief Выводит строку отчета для одной ячейки
+ */
+static void write_sample_line(std::ostringstream& out, const std::string& label, const PerfThreadSample& cell) {
+    const PerfSample& s = cell.sample;
+    out << label << ": такты " << s.get(PerfCounter::Cycles)
+        << ", инструкции " << s.get(PerfCounter::Instructions)
+        << ", IPC " << s.ipc();
+    if (cell.points > 0) {
+        const double points = static_cast<double>(cell.points);
+        if (s.has(PerfCounter::CacheMisses)) {
+            out << ", промахов кэша на точку " << s.get(PerfCounter::CacheMisses) / points;
+        }
+        if (s.has(PerfCounter::BranchMisses)) {
+            out << ", ошибок предсказания на точку " << s.get(PerfCounter::BranchMisses) / points;
+        }
+    }
+    out << "\n";
+}
+
+std::string PerfProfiler::summary() const {
+    std::ostringstream out;
+    out.precision(4);
+    if (!is_available()) {
+        out << "Аппаратные счетчики недоступны (perf_event_open)\n";
+        return out.str();
+    }
+    const InterpolationPhase phases[] = {InterpolationPhase::Sort, InterpolationPhase::Coefficients,
+                                         InterpolationPhase::Evaluation};
+    const char* names[] = {"Сортировка", "Коэффициенты", "Вычисление"};
+    for (size_t p = 0; p < 3; p++) {
+        write_sample_line(out, names[p], get_phase_total(phases[p]));
+        if (phases[p] == InterpolationPhase::Evaluation) {
+            for (const PerfThreadSample& cell : get_thread_samples(phases[p])) {
+                write_sample_line(out, "  поток " + std::to_string(cell.thread), cell);
+            }
+        }
+    }
+    return out.str();
+}
@@ -0,0 +1,239 @@
+/**
+ * @file perf_counters.h
+ * @brief Аппаратные счетчики производительности (Linux perf_event_open) по этапам и потокам
+ */
+
+#ifndef PERF_COUNTERS_H
+#define PERF_COUNTERS_H
+
+#include "phase_timings.h"
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <mutex>
+#include <string>
+#include <vector>
+
+/**
+ * @brief Аппаратный счетчик
+ */
+enum class PerfCounter {
+    Cycles,        ///< Такты процессора
+    Instructions,  ///< Выполненные инструкции
+    CacheMisses,   ///< Промахи последнего уровня кэша
+    BranchMisses   ///< Ошибки предсказания переходов
+};
+
+/**
+ * @brief Количество поддерживаемых счетчиков
+ */
+const size_t PERF_COUNTER_COUNT = 4;
+
+/**
+ * @struct PerfSample
+ * @brief Значения счетчиков (или их приращения за этап)
+ */
+struct PerfSample {
+    uint64_t values[PERF_COUNTER_COUNT] = {0, 0, 0, 0}; ///< Значения в порядке PerfCounter
+    unsigned available_mask = 0;                        ///< Бит i установлен, если счетчик i открыт
+
+    /**
+     * @brief Проверяет, доступен ли счетчик
+     */
+    bool has(PerfCounter counter) const { return (available_mask >> static_cast<unsigned>(counter)) & 1u; }
+
+    /**
+     * @brief Значение счетчика
+     */
+    uint64_t get(PerfCounter counter) const { return values[static_cast<size_t>(counter)]; }
+
+    /**
+     * @brief Инструкций за такт (0, если такты или инструкции недоступны)
+     */
+    double ipc() const;
+
+    /**
+     * @brief Добавляет приращения другого замера
+     */
+    PerfSample& operator+=(const PerfSample& other);
+};
+
+/**
+ * @class PerfCounterGroup
+ * @brief Группа счетчиков вызывающего потока
+ *
+ * Счетчики открываются одной группой (лидер - такты), чтобы все значения
+ * относились к одному интервалу. Открываются только счетчики пользовательского
+ * режима, поэтому достаточно perf_event_paranoid <= 2. Счетчики, которые ядро
+ * или виртуальная машина не предоставляют, пропускаются; если не открылся
+ * ни один, группа недоступна, а read() возвращает пустой замер.
+ */
+class PerfCounterGroup {
+private:
+    int descriptors[PERF_COUNTER_COUNT];  ///< Дескрипторы (-1 - счетчик не открыт)
+    int leader;                           ///< Дескриптор лидера группы
+    unsigned available_mask;              ///< Открытые счетчики
+
+public:
+    /**
+     * @brief Открывает счетчики для вызывающего потока
+     */
+    PerfCounterGroup();
+
+    /**
+     * @brief Закрывает дескрипторы
+     */
+    ~PerfCounterGroup();
+
+    PerfCounterGroup(const PerfCounterGroup&) = delete;
+    PerfCounterGroup& operator=(const PerfCounterGroup&) = delete;
+
+    /**
+     * @brief Проверяет, открыт ли хотя бы один счетчик
+     */
+    bool is_available() const;
+
+    /**
+     * @brief Читает текущие значения всех открытых счетчиков
+     */
+    PerfSample read() const;
+
+    /**
+     * @brief Группа вызывающего потока (открывается при первом обращении)
+     */
+    static PerfCounterGroup& for_current_thread();
+};
+
+/**
+ * @struct PerfThreadSample
+ * @brief Накопленные счетчики одного потока на одном этапе
+ */
+struct PerfThreadSample {
+    size_t thread = 0;    ///< Номер потока OpenMP (0 - вызывающий поток)
+    size_t points = 0;    ///< Точек, вычисленных потоком
+    size_t scopes = 0;    ///< Количество измеренных интервалов
+    PerfSample sample;    ///< Сумма приращений
+};
+
+/**
+ * @class PerfProfiler
+ * @brief Накопление счетчиков по этапам интерполяции и потокам
+ *
+ * Измеряемый интервал задается объектом Scope: конструктор читает счетчики
+ * потока, деструктор добавляет приращение к ячейке (этап, номер потока в
+ * команде). Если счетчики недоступны, Scope ничего не делает. Вместо
+ * аппаратной группы можно задать собственный источник замеров
+ * (set_sample_source), например для проверки границ этапов.
+ *
+ * Ячейки потоков выделяются заранее (reserve_threads), а приращения
+ * добавляются атомарными операциями без блокировок и выделения памяти,
+ * поэтому Scope допустим в безысключительном пути вычисления. Интервалы
+ * потоков с номером вне выделенных ячеек не учитываются
+ * (см. get_dropped_scopes).
+ */
+class PerfProfiler {
+private:
+    mutable std::mutex lock;                          ///< Защищает размеры ячеек и источник замеров
+    std::vector<PerfThreadSample> samples[3];         ///< Ячейки по этапам, индекс - номер потока
+    std::function<PerfSample()> sample_source;        ///< Источник замеров (пусто - аппаратная группа потока)
+    std::atomic<size_t> dropped_scopes;               ///< Интервалы потоков без выделенной ячейки
+
+    /**
+     * @brief Атомарно добавляет приращение в ячейку потока
+     */
+    void accumulate(InterpolationPhase phase, size_t thread, size_t points, const PerfSample& delta) noexcept;
+
+public:
+    /**
+     * @class Scope
+     * @brief Измеряемый интервал текущего потока
+     */
+    class Scope {
+    private:
+        PerfProfiler* profiler;   ///< Получатель (nullptr - измерение отключено)
+        InterpolationPhase phase; ///< Этап
+        size_t points;            ///< Точек в интервале
+        size_t thread;            ///< Номер потока в команде
+        PerfSample start;         ///< Значения в начале интервала
+
+    public:
+        /**
+         * @brief Начинает интервал потока OpenMP
+         * @param profiler Получатель (nullptr - не измерять)
+         * @param phase Этап
+         * @param points Количество точек, обработанных в интервале
+         */
+        Scope(PerfProfiler* profiler, InterpolationPhase phase, size_t points = 0);
+
+        /**
+         * @brief Начинает интервал потока с заданным номером
+         * @param profiler Получатель (nullptr - не измерять)
+         * @param phase Этап
+         * @param points Количество точек, обработанных в интервале
+         * @param thread Номер потока в команде (например, ParallelScheduler::current_thread)
+         */
+        Scope(PerfProfiler* profiler, InterpolationPhase phase, size_t points, size_t thread);
+
+        /**
+         * @brief Завершает интервал и добавляет приращение
+         */
+        ~Scope();
+
+        Scope(const Scope&) = delete;
+        Scope& operator=(const Scope&) = delete;
+    };
+
+    /**
+     * @brief Конструктор: выделяет ячейки для omp_get_max_threads() потоков
+     */
+    PerfProfiler();
+
+    /**
+     * @brief Проверяет, доступны ли счетчики в вызывающем потоке
+     */
+    static bool is_available();
+
+    /**
+     * @brief Выделяет ячейки для потоков с номерами от 0 до count - 1
+     * @param count Размер команды (ячейки только добавляются)
+     *
+     * Вызывается до измерений, а не одновременно с ними.
+     */
+    void reserve_threads(size_t count);
+
+    /**
+     * @brief Возвращает количество интервалов, пропущенных из-за номера потока вне ячеек
+     */
+    size_t get_dropped_scopes() const;
+
+    /**
+     * @brief Заменяет аппаратные счетчики источником замеров
+     * @param source Функция, возвращающая текущие значения (пустая - аппаратная группа)
+     *
+     * Источник вызывается из всех потоков, измеряющих этапы.
+     */
+    void set_sample_source(std::function<PerfSample()> source);
+
+    /**
+     * @brief Сбрасывает накопленные значения
+     */
+    void reset();
+
+    /**
+     * @brief Возвращает ячейки потоков, участвовавших в этапе
+     */
+    std::vector<PerfThreadSample> get_thread_samples(InterpolationPhase phase) const;
+
+    /**
+     * @brief Возвращает сумму по всем потокам этапа
+     */
+    PerfThreadSample get_phase_total(InterpolationPhase phase) const;
+
+    /**
+     * @brief Формирует текстовый отчет: IPC и промахи на точку по этапам и потокам
+     */
+    std::string summary() const;
+};
+
+#endif // PERF_COUNTERS_H
@@ -0,0 +1,57 @@
+#include "phase_timings.h"
+
+PhaseTimer::PhaseTimer() {
+    reset();
+}
+
+PhaseTimer::PhaseTimer(const PhaseTimer& other) {
+    *this = other;
+}
+
+PhaseTimer& PhaseTimer::operator=(const PhaseTimer& other) {
+    sort_ns = other.sort_ns.load();
+    coefficients_ns = other.coefficients_ns.load();
+    evaluation_ns = other.evaluation_ns.load();
+    setup_calls = other.setup_calls.load();
+    evaluation_calls = other.evaluation_calls.load();
+    evaluated_points = other.evaluated_points.load();
+    return *this;
+}
+
+void PhaseTimer::record(InterpolationPhase phase, clock::time_point start, size_t points) {
+    long long ns = std::chrono::duration_cast<std::chrono::nanoseconds>(clock::now() - start).count();
+    switch (phase) {
+        case InterpolationPhase::Sort:
+            sort_ns += ns;
+            setup_calls++;
+            break;
+        case InterpolationPhase::Coefficients:
+            coefficients_ns += ns;
+            break;
+        case InterpolationPhase::Evaluation:
+            evaluation_ns += ns;
+            evaluation_calls++;
+            evaluated_points += points;
+            break;
+    }
+}
+
+InterpolationTimings PhaseTimer::snapshot() const {
+    InterpolationTimings timings;
+    timings.sort_ms = sort_ns.load() / 1e6;
+    timings.coefficients_ms = coefficients_ns.load() / 1e6;
+    timings.evaluation_ms = evaluation_ns.load() / 1e6;
+    timings.setup_calls = setup_calls.load();
+    timings.evaluation_calls = evaluation_calls.load();
+    timings.evaluated_points = evaluated_points.load();
+    return timings;
+}
+
+void PhaseTimer::reset() {
+    sort_ns = 0;
+    coefficients_ns = 0;
+    evaluation_ns = 0;
+    setup_calls = 0;
+    evaluation_calls = 0;
+    evaluated_points = 0;
+}
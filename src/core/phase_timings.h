@@ -0,0 +1,82 @@
+/**
+ * @file phase_timings.h
+ * @brief Учет времени этапов интерполяции (подготовка и вычисление)
+ */
+
+#ifndef PHASE_TIMINGS_H
+#define PHASE_TIMINGS_H
+
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+
+/**
+ * @struct InterpolationTimings
+ * @brief Снимок накопленного времени этапов интерполяции
+ */
+struct InterpolationTimings {
+    double sort_ms = 0.0;           ///< Сортировка и копирование узлов в set_data
+    double coefficients_ms = 0.0;   ///< Построение коэффициентов
+    double evaluation_ms = 0.0;     ///< Пакетное вычисление (interpolate_multiple)
+    size_t setup_calls = 0;         ///< Количество вызовов set_data
+    size_t evaluation_calls = 0;    ///< Количество вызовов interpolate_multiple
+    size_t evaluated_points = 0;    ///< Всего вычисленных точек
+
+    /**
+     * @brief Суммарное время подготовки (сортировка + коэффициенты)
+     */
+    double setup_ms() const { return sort_ms + coefficients_ms; }
+};
+
+/**
+ * @brief Этап интерполяции
+ */
+enum class InterpolationPhase {
+    Sort,
+    Coefficients,
+    Evaluation
+};
+
+/**
+ * @class PhaseTimer
+ * @brief Потокобезопасный накопитель времени этапов
+ *
+ * Значения хранятся в атомарных счетчиках, поэтому время вычисления можно
+ * учитывать из константных методов, вызываемых одновременно из разных потоков.
+ */
+class PhaseTimer {
+private:
+    std::atomic<long long> sort_ns;
+    std::atomic<long long> coefficients_ns;
+    std::atomic<long long> evaluation_ns;
+    std::atomic<size_t> setup_calls;
+    std::atomic<size_t> evaluation_calls;
+    std::atomic<size_t> evaluated_points;
+
+public:
+    using clock = std::chrono::steady_clock;
+
+    PhaseTimer();
+    PhaseTimer(const PhaseTimer& other);
+    PhaseTimer& operator=(const PhaseTimer& other);
+
+    /**
+     * @brief Добавляет время этапа, прошедшее с момента start
+     * @param phase Этап
+     * @param start Момент начала этапа
+     * @param points Количество обработанных точек (для этапа вычисления)
+     */
+    void record(InterpolationPhase phase, clock::time_point start, size_t points = 0);
+
+    /**
+     * @brief Возвращает снимок накопленных значений
+     */
+    InterpolationTimings snapshot() const;
+
+    /**
+     * @brief Обнуляет все счетчики
+     */
+    void reset();
+};
+
+#endif // PHASE_TIMINGS_H
@@ -0,0 +1,186 @@
+#include "piecewise_engine.h"
+#include <omp.h>
+#include <stdexcept>
+#include <cmath>
+#include <algorithm>
+#include <limits>
+
+/**
+ * @brief Количество точек в блоке при пакетном вычислении
+ */
+static const long PIECEWISE_BLOCK_SIZE = 1024;
+
+/**
+ * @brief Сколько отрезков можно пройти вперед, прежде чем перейти к поиску по индексу
+ */
+static const size_t MAX_FORWARD_STEPS = 8;
+
+PiecewiseEngine::PiecewiseEngine(size_t k)
+    : degree(k), local_degree(0), bucket_origin(0.0), bucket_scale(0.0) {
+    set_degree(k);
+}
+
+void PiecewiseEngine::set_degree(size_t k) {
+    if (k == 0) {
+        throw std::invalid_argument("Степень локальных полиномов должна быть не менее 1");
+    }
+    degree = k;
+}
+
+size_t PiecewiseEngine::get_degree() const {
+    return degree;
+}
+
+void PiecewiseEngine::compute(const double* x, const double* y, size_t n) {
+    if (n < 2) {
+        throw std::invalid_argument("Необходимо как минимум 2 точки для интерполяции");
+    }
+    for (size_t i = 1; i < n; i++) {
+        if (x[i] - x[i-1] < 1e-10) {
+            throw std::runtime_error("Деление на ноль при вычислении разделенных разностей");
+        }
+    }
+
+    const size_t k = std::min(degree, n - 1);
+    const size_t segments = n - 1;
+    local_degree = k;
+    x_nodes.assign(x, x + n);
+    segment_coefficients.resize(segments * (k + 1));
+    segment_centers.resize(segments * k);
+
+    const long num_segments = static_cast<long>(segments);
+    #pragma omp parallel for schedule(static)
+    for (long s = 0; s < num_segments; s++) {
+        // Окно из k + 1 узлов, охватывающее отрезок [x_s, x_{s+1}] и по возможности центрированное
+        long first = s - static_cast<long>((k - 1) / 2);
+        first = std::max(0L, std::min(first, static_cast<long>(n - 1 - k)));
+
+        double* c = &segment_coefficients[s * (k + 1)];
+        const double* xs = x + first;
+        std::copy(y + first, y + first + k + 1, c);
+        for (size_t j = 1; j <= k; j++) {
+            for (size_t i = k; i >= j; i--) {
+                c[i] = (c[i] - c[i-1]) / (xs[i] - xs[i-j]);
+            }
+        }
+        std::copy(xs, xs + k, &segment_centers[s * k]);
+    }
+
+    build_index();
+}
+
+void PiecewiseEngine::build_index() {
+    const size_t n = x_nodes.size();
+    const size_t buckets = n - 1;
+    bucket_origin = x_nodes[0];
+    bucket_scale = buckets / (x_nodes[n-1] - x_nodes[0]);
+
+    // bucket_start[b] - первый отрезок, правый конец которого правее начала корзины b
+    bucket_start.assign(buckets + 1, 0);
+    // Положение узла считается той же формулой, что и в locate, чтобы округление
+    // не относило точку и узел к разным корзинам
+    size_t segment = 0;
+    for (size_t b = 0; b < buckets; b++) {
+        while (segment + 1 < buckets && (x_nodes[segment + 1] - bucket_origin) * bucket_scale <= b) {
+            segment++;
+        }
+        bucket_start[b] = segment;
+    }
+    bucket_start[buckets] = buckets - 1;
+}
+
+void PiecewiseEngine::clear() {
+    x_nodes.clear();
+    segment_coefficients.clear();
+    segment_centers.clear();
+    bucket_start.clear();
+}
+
+size_t PiecewiseEngine::locate(double point) const {
+    const size_t segments = x_nodes.size() - 1;
+    double position = (point - bucket_origin) * bucket_scale;
+    if (!(position > 0.0)) {
+        return 0;
+    }
+    if (position >= static_cast<double>(segments)) {
+        return segments - 1;
+    }
+    size_t b = static_cast<size_t>(position);
+
+    // Отрезки корзины b лежат в [bucket_start[b], bucket_start[b+1]]
+    const double* first = x_nodes.data() + bucket_start[b] + 1;
+    const double* last = x_nodes.data() + bucket_start[b + 1] + 1;
+    const double* right = std::upper_bound(first, last, point);
+    return std::min(static_cast<size_t>(right - x_nodes.data()) - 1, segments - 1);
+}
+
+double PiecewiseEngine::evaluate_segment(size_t segment, double point) const {
+    const size_t k = local_degree;
+    const double* c = &segment_coefficients[segment * (k + 1)];
+    const double* xs = &segment_centers[segment * k];
+    double p = c[k];
+    for (size_t i = k; i-- > 0; ) {
+        p = p * (point - xs[i]) + c[i];
+    }
+    return p;
+}
+
+double PiecewiseEngine::evaluate(double point) const {
+    if (x_nodes.empty()) {
+        return std::numeric_limits<double>::quiet_NaN();
+    }
+    return evaluate_segment(locate(point), point);
+}
+
+void PiecewiseEngine::evaluate(const double* points, double* results, size_t count) const {
+    if (x_nodes.empty()) {
+        std::fill(results, results + count, std::numeric_limits<double>::quiet_NaN());
+        return;
+    }
+    const long num_points = static_cast<long>(count);
+    const long num_blocks = (num_points + PIECEWISE_BLOCK_SIZE - 1) / PIECEWISE_BLOCK_SIZE;
+
+    #pragma omp parallel for schedule(dynamic, 1)
+    for (long b = 0; b < num_blocks; b++) {
+        const long begin = b * PIECEWISE_BLOCK_SIZE;
+        const long end = std::min(begin + PIECEWISE_BLOCK_SIZE, num_points);
+        evaluate_block(points + begin, results + begin, end - begin);
+    }
+}
+
+void PiecewiseEngine::evaluate_block(const double* points, double* results, size_t count) const {
+    if (x_nodes.empty()) {
+        std::fill(results, results + count, std::numeric_limits<double>::quiet_NaN());
+        return;
+    }
+    if (count == 0) {
+        return;
+    }
+    const size_t last_segment = x_nodes.size() - 2;
+    const double* x = x_nodes.data();
+    size_t segment = locate(points[0]);
+    double previous = points[0];
+
+    for (size_t i = 0; i < count; i++) {
+        const double t = points[i];
+        if (t < previous) {
+            segment = locate(t);
+        } else {
+            // Для возрастающих точек отрезок только сдвигается вперед
+            size_t steps = 0;
+            while (segment < last_segment && x[segment + 1] <= t && steps < MAX_FORWARD_STEPS) {
+                segment++;
+                steps++;
+            }
+            if (steps == MAX_FORWARD_STEPS) {
+                segment = locate(t);
+            }
+        }
+        results[i] = evaluate_segment(segment, t);
+        previous = t;
+    }
+}
+
+size_t PiecewiseEngine::segment_count() const {
+    return x_nodes.empty() ? 0 : x_nodes.size() - 1;
+}
@@ -0,0 +1,120 @@
+/**
+ * @file piecewise_engine.h
+ * @brief Кусочная интерполяция локальными полиномами Ньютона
+ */
+
+#ifndef PIECEWISE_ENGINE_H
+#define PIECEWISE_ENGINE_H
+
+#include "aligned_buffer.h"
+#include <cstddef>
+#include <vector>
+
+/**
+ * @brief Степень локальных полиномов по умолчанию
+ */
+constexpr size_t DEFAULT_PIECEWISE_DEGREE = 3;
+
+/**
+ * @class PiecewiseEngine
+ * @brief Интерполяция локальными полиномами Ньютона степени k
+ *
+ * Для каждого отрезка [x_i, x_{i+1}] отсортированной таблицы заранее строится
+ * полином Ньютона по k + 1 ближайшим узлам, охватывающим отрезок. Отрезок для
+ * точки находится через равномерный индекс корзин: корзина хранит первый
+ * отрезок, пересекающий ее, и поиск идет бинарным поиском только внутри
+ * корзины - для почти равномерных сеток это O(1). При вычислении пакета
+ * отсортированных точек отрезок сдвигается вперед без повторного поиска.
+ * Стоимость точки - O(k) независимо от размера таблицы.
+ */
+class PiecewiseEngine {
+private:
+    AlignedVector<double> x_nodes;               ///< Отсортированные узлы
+    AlignedVector<double> segment_coefficients;  ///< Коэффициенты, (k + 1) на отрезок
+    AlignedVector<double> segment_centers;       ///< Узлы локальных полиномов, k на отрезок
+    std::vector<size_t> bucket_start;            ///< Первый отрезок каждой корзины (+ конец)
+    size_t degree;                               ///< Степень k
+    size_t local_degree;                         ///< Фактическая степень (не больше n - 1)
+    double bucket_origin;                        ///< Левая граница индекса корзин
+    double bucket_scale;                         ///< Количество корзин на единицу длины
+
+    /**
+     * @brief Строит индекс корзин по узлам
+     */
+    void build_index();
+
+    /**
+     * @brief Вычисляет локальный полином отрезка в точке
+     */
+    double evaluate_segment(size_t segment, double point) const;
+
+public:
+    /**
+     * @brief Конструктор
+     * @param k Степень локальных полиномов
+     */
+    explicit PiecewiseEngine(size_t k = DEFAULT_PIECEWISE_DEGREE);
+
+    /**
+     * @brief Устанавливает степень локальных полиномов
+     * @param k Степень (не менее 1), вступает в силу при следующем compute
+     */
+    void set_degree(size_t k);
+
+    /**
+     * @brief Возвращает степень локальных полиномов
+     */
+    size_t get_degree() const;
+
+    /**
+     * @brief Строит локальные полиномы по отсортированным узлам
+     * @param x Указатель на значения x (строго возрастающие)
+     * @param y Указатель на значения y
+     * @param n Количество узлов (не менее 2)
+     *
+     * Если узлов не больше k, степень уменьшается до n - 1.
+     */
+    void compute(const double* x, const double* y, size_t n);
+
+    /**
+     * @brief Очищает все буферы
+     */
+    void clear();
+
+    /**
+     * @brief Находит отрезок, содержащий точку
+     * @param point Точка
+     * @return Индекс отрезка (крайний отрезок для точек вне таблицы)
+     */
+    size_t locate(double point) const;
+
+    /**
+     * @brief Вычисляет интерполянт в точке
+     * @param point Точка
+     * @return Значение локального полинома
+     */
+    double evaluate(double point) const;
+
+    /**
+     * @brief Вычисляет интерполянт в наборе точек с использованием OpenMP
+     * @param points Точки (упорядоченные по возрастанию обрабатываются быстрее)
+     * @param results Массив результатов (count элементов)
+     * @param count Количество точек
+     */
+    void evaluate(const double* points, double* results, size_t count) const;
+
+    /**
+     * @brief Последовательно вычисляет интерполянт в наборе точек (без параллельной области)
+     * @param points Точки (упорядоченные по возрастанию обрабатываются быстрее)
+     * @param results Массив результатов (count элементов)
+     * @param count Количество точек
+     */
+    void evaluate_block(const double* points, double* results, size_t count) const;
+
+    /**
+     * @brief Возвращает количество отрезков
+     */
+    size_t segment_count() const;
+};
+
+#endif // PIECEWISE_ENGINE_H
@@ -0,0 +1,112 @@
+#include "scaling_analysis.h"
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <stdexcept>
+
+namespace {
+
+/**
+ * @brief Границы 95% доверительного интервала медианы по порядковым статистикам
+ *
+ * Не предполагает нормальности времен: ранги n/2 -+ 1.96 * sqrt(n) / 2
+ * (биномиальное приближение). При малом числе прогонов интервал
+ * расширяется до минимума и максимума.
+ */
+void median_interval(std::vector<double> samples, double& low, double& high) {
+    std::sort(samples.begin(), samples.end());
+    const double n = static_cast<double>(samples.size());
+    const double spread = 0.98 * std::sqrt(n);
+    const double lower_rank = std::floor(n / 2.0 - spread);
+    const double upper_rank = std::ceil(1.0 + n / 2.0 + spread);
+    const size_t lower = static_cast<size_t>(std::max(1.0, lower_rank));
+    const size_t upper = static_cast<size_t>(std::min(n, upper_rank));
+    low = samples[lower - 1];
+    high = samples[upper - 1];
+}
+
+} // namespace
+
+double ScalingSeries::amdahl_speedup(double threads) const {
+    return 1.0 / (serial_fraction + (1.0 - serial_fraction) / threads);
+}
+
+double ScalingAnalysis::karp_flatt(double speedup, int threads) {
+    if (threads <= 1) {
+        return std::numeric_limits<double>::quiet_NaN();
+    }
+    const double p = static_cast<double>(threads);
+    return (1.0 / speedup - 1.0 / p) / (1.0 - 1.0 / p);
+}
+
+double ScalingAnalysis::fit_amdahl(const std::vector<int>& threads, const std::vector<double>& speedups) {
+    if (threads.size() != speedups.size()) {
+        throw std::invalid_argument("Размеры векторов threads и speedups должны совпадать");
+    }
+    // 1/S - 1/p = f * (1 - 1/p): регрессия через начало координат
+    double numerator = 0.0;
+    double denominator = 0.0;
+    for (size_t i = 0; i < threads.size(); i++) {
+        if (threads[i] <= 1 || speedups[i] <= 0.0) {
+            continue;
+        }
+        const double inverse = 1.0 / static_cast<double>(threads[i]);
+        const double a = 1.0 - inverse;
+        const double b = 1.0 / speedups[i] - inverse;
+        numerator += a * b;
+        denominator += a * a;
+    }
+    if (denominator == 0.0) {
+        return 0.0;
+    }
+    return std::clamp(numerator / denominator, 0.0, 1.0);
+}
+
+ScalingSeries ScalingAnalysis::analyze(const std::string& label, const std::vector<int>& threads,
+                                       const std::vector<std::vector<double>>& samples) {
+    if (threads.empty()) {
+        throw std::invalid_argument("Вектор threads не может быть пустым");
+    }
+    if (threads.size() != samples.size()) {
+        throw std::invalid_argument("Размеры векторов threads и samples должны совпадать");
+    }
+    for (size_t i = 0; i < threads.size(); i++) {
+        if (threads[i] <= 0) {
+            throw std::invalid_argument("Число потоков должно быть положительным");
+        }
+        if (samples[i].empty()) {
+            throw std::invalid_argument("Нет измерений для " + std::to_string(threads[i]) + " потоков");
+        }
+        for (double sample : samples[i]) {
+            if (!(sample > 0.0)) {
+                throw std::invalid_argument("Время измерения должно быть положительным");
+            }
+        }
+    }
+
+    ScalingSeries series;
+    series.label = label;
+    series.points.resize(threads.size());
+    const double base_ms = BenchmarkStats::from_samples(samples[0]).median_ms;
+    // База - первое число потоков: ускорение и эффективность нормируются на него
+    const double base_threads = static_cast<double>(threads[0]);
+    std::vector<double> speedups(threads.size());
+    for (size_t i = 0; i < threads.size(); i++) {
+        ScalingPoint& point = series.points[i];
+        point.threads = threads[i];
+        point.time = BenchmarkStats::from_samples(samples[i]);
+        point.speedup = base_threads * base_ms / point.time.median_ms;
+        point.speedup_min = base_threads * base_ms / point.time.max_ms;
+        point.speedup_max = base_threads * base_ms / point.time.min_ms;
+        double low_ms = 0.0;
+        double high_ms = 0.0;
+        median_interval(samples[i], low_ms, high_ms);
+        point.speedup_low = base_threads * base_ms / high_ms;
+        point.speedup_high = base_threads * base_ms / low_ms;
+        point.efficiency = point.speedup / threads[i];
+        point.karp_flatt = karp_flatt(point.speedup, threads[i]);
+        speedups[i] = point.speedup;
+    }
+    series.serial_fraction = fit_amdahl(threads, speedups);
+    return series;
+}
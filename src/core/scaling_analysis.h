@@ -0,0 +1,107 @@
+/**
+ * @file scaling_analysis.h
+ * @brief Анализ масштабируемости по повторным измерениям: ускорение, эффективность, Карп-Флэтт, Амдал
+ */
+
+#ifndef SCALING_ANALYSIS_H
+#define SCALING_ANALYSIS_H
+
+#include "benchmark.h"
+#include <string>
+#include <vector>
+
+/**
+ * @struct ScalingPoint
+ * @brief Показатели масштабируемости для одного числа потоков
+ *
+ * Ускорения вычисляются относительно медианы времени первого числа потоков
+ * серии (обычно 1 поток; база из p0 потоков считается ускоренной в p0 раз).
+ * Доверительный интервал учитывает разброс прогонов точки, база считается точной.
+ */
+struct ScalingPoint {
+    int threads = 0;             ///< Число потоков
+    BenchmarkStats time;         ///< Статистика времени, мс
+    double speedup = 0.0;        ///< Ускорение по медианам
+    double speedup_min = 0.0;    ///< Ускорение по самому медленному прогону
+    double speedup_max = 0.0;    ///< Ускорение по самому быстрому прогону
+    double speedup_low = 0.0;    ///< Нижняя граница 95% доверительного интервала медианного ускорения
+    double speedup_high = 0.0;   ///< Верхняя граница 95% доверительного интервала медианного ускорения
+    double efficiency = 0.0;     ///< Параллельная эффективность speedup / threads
+    double karp_flatt = 0.0;     ///< Экспериментальная последовательная доля (NaN при одном потоке)
+};
+
+/**
+ * @struct ScalingSeries
+ * @brief Серия измерений одной конфигурации (число узлов, ядро и т.п.)
+ */
+struct ScalingSeries {
+    std::string label;                ///< Подпись серии на графике
+    std::vector<ScalingPoint> points; ///< Показатели по числу потоков
+    double serial_fraction = 0.0;     ///< Последовательная доля закона Амдала (МНК)
+
+    /**
+     * @brief Ускорение по закону Амдала с подобранной долей
+     * @param threads Число потоков
+     */
+    double amdahl_speedup(double threads) const;
+};
+
+/**
+ * @class ScalingAnalysis
+ * @brief Сводит повторные измерения времени в показатели масштабируемости
+ */
+class ScalingAnalysis {
+public:
+    /**
+     * @brief Анализирует серию повторных измерений
+     * @param label Подпись серии
+     * @param threads Числа потоков (первое - база ускорения)
+     * @param samples Времена прогонов для каждого числа потоков, мс
+     * @return Серия с показателями и подобранной долей Амдала
+     * @throws std::invalid_argument если данные пусты, размеры различаются,
+     *         число потоков не положительно или время не положительно
+     */
+    static ScalingSeries analyze(const std::string& label, const std::vector<int>& threads,
+                                 const std::vector<std::vector<double>>& samples);
+
+    /**
+     * @brief Измеряет функцию для каждого числа потоков и анализирует серию
+     * @param label Подпись серии
+     * @param threads Числа потоков
+     * @param benchmark Прогрев и число повторов
+     * @param body Функция, принимающая число потоков
+     */
+    template <typename Body>
+    static ScalingSeries measure(const std::string& label, const std::vector<int>& threads,
+                                 const Benchmark& benchmark, Body&& body) {
+        std::vector<std::vector<double>> samples;
+        samples.reserve(threads.size());
+        for (int count : threads) {
+            samples.push_back(benchmark.sample([&]() { body(count); }));
+        }
+        return analyze(label, threads, samples);
+    }
+
+    /**
+     * @brief Метрика Карпа-Флэтта e = (1/S - 1/p) / (1 - 1/p)
+     * @param speedup Ускорение S
+     * @param threads Число потоков p
+     * @return Последовательная доля или NaN при p <= 1
+     */
+    static double karp_flatt(double speedup, int threads);
+
+    /**
+     * @brief Подбирает последовательную долю закона Амдала методом наименьших квадратов
+     *
+     * Минимизирует сумму квадратов отклонений 1/S от f + (1 - f)/p, что
+     * линейно по f. Результат ограничен отрезком [0, 1].
+     *
+     * @param threads Числа потоков
+     * @param speedups Измеренные ускорения
+     * @return Последовательная доля (0, если нет точек с p > 1)
+     * @throws std::invalid_argument если размеры различаются
+     */
+    static double fit_amdahl(const std::vector<int>& threads, const std::vector<double>& speedups);
+};
+
+#endif // SCALING_ANALYSIS_H
@@ -0,0 +1,164 @@
+#include "stream_io.h"
+#include "text_table_loader.h"
+#include <algorithm>
+#include <cstring>
+#include <stdexcept>
+
+TextStreamReader::TextStreamReader(std::istream& input)
+    : input(input), buffer(TEXT_STREAM_BUFFER), begin(0), end(0), exhausted(false) {}
+
+bool TextStreamReader::refill() {
+    if (exhausted) {
+        return false;
+    }
+    std::memmove(buffer.data(), buffer.data() + begin, end - begin);
+    end -= begin;
+    begin = 0;
+    if (end == buffer.size()) {
+        throw std::runtime_error("Слишком длинная лексема во входном потоке");
+    }
+    input.read(buffer.data() + end, static_cast<std::streamsize>(buffer.size() - end));
+    const size_t received = static_cast<size_t>(input.gcount());
+    end += received;
+    if (!input) {
+        exhausted = true;
+    }
+    return received > 0;
+}
+
+size_t TextStreamReader::read(std::span<double> chunk) {
+    size_t count = 0;
+    while (count < chunk.size()) {
+        while (begin < end && (TextTableLoader::is_separator(buffer[begin]) || buffer[begin] == '\n')) {
+            begin++;
+        }
+        if (begin == end) {
+            if (!refill() && begin == end) {
+                break;
+            }
+            continue;
+        }
+        if (buffer[begin] == '#') {
+            const char* newline = static_cast<const char*>(std::memchr(buffer.data() + begin, '\n', end - begin));
+            if (newline != nullptr) {
+                begin = static_cast<size_t>(newline - buffer.data()) + 1;
+            } else if (!refill()) {
+                begin = end;
+            }
+            continue;
+        }
+
+        // Лексема, упирающаяся в конец буфера, может продолжаться в непрочитанной части
+        size_t token_end = begin;
+        while (token_end < end && !TextTableLoader::is_separator(buffer[token_end]) &&
+               buffer[token_end] != '\n' && buffer[token_end] != '#') {
+            token_end++;
+        }
+        if (token_end == end && !exhausted) {
+            refill();
+            continue;
+        }
+        const char* cursor = buffer.data() + begin;
+        const char* token_limit = buffer.data() + token_end;
+        if (!TextTableLoader::parse_number(cursor, token_limit, chunk[count]) || cursor != token_limit) {
+            throw std::runtime_error("Некорректное число во входном потоке: " +
+                                     std::string(buffer.data() + begin, token_end - begin));
+        }
+        begin = token_end;
+        count++;
+    }
+    return count;
+}
+
+RawStreamReader::RawStreamReader(std::istream& input) : input(input) {}
+
+size_t RawStreamReader::read(std::span<double> chunk) {
+    input.read(reinterpret_cast<char*>(chunk.data()), static_cast<std::streamsize>(chunk.size_bytes()));
+    const size_t bytes = static_cast<size_t>(input.gcount());
+    if (bytes % sizeof(double) != 0) {
+        throw std::runtime_error("Входной поток оборвался посреди значения double");
+    }
+    return bytes / sizeof(double);
+}
+
+BinaryFileStreamReader::BinaryFileStreamReader(const std::string& path)
+    : file(MappedBinaryFile::open(path)), position(0) {
+    if (file.get_kind() == BinaryArrayKind::Table) {
+        throw std::runtime_error("Файл " + path + " содержит таблицу узлов, а не точки");
+    }
+}
+
+size_t BinaryFileStreamReader::read(std::span<double> chunk) {
+    std::span<const double> values = file.get_values();
+    const size_t count = std::min(chunk.size(), values.size() - position);
+    std::copy(values.begin() + position, values.begin() + position + count, chunk.begin());
+    position += count;
+    return count;
+}
+
+TextStreamWriter::TextStreamWriter(std::ostream& output)
+    : output(output), buffer(TEXT_STREAM_BUFFER, '\0'), length(0) {}
+
+void TextStreamWriter::drain() {
+    output.write(buffer.data(), static_cast<std::streamsize>(length));
+    length = 0;
+    if (!output) {
+        throw std::runtime_error("Ошибка записи выходного потока");
+    }
+}
+
+void TextStreamWriter::write(std::span<const double> chunk) {
+    for (double value : chunk) {
+        if (buffer.size() - length < MAX_NUMBER_CHARS + 1) {
+            drain();
+        }
+        char* cursor = TextTableLoader::format_number(buffer.data() + length, value);
+        *cursor++ = '\n';
+        length = static_cast<size_t>(cursor - buffer.data());
+    }
+}
+
+void TextStreamWriter::finish() {
+    drain();
+    output.flush();
+}
+
+RawStreamWriter::RawStreamWriter(std::ostream& output) : output(output) {}
+
+void RawStreamWriter::write(std::span<const double> chunk) {
+    output.write(reinterpret_cast<const char*>(chunk.data()), static_cast<std::streamsize>(chunk.size_bytes()));
+    if (!output) {
+        throw std::runtime_error("Ошибка записи выходного потока");
+    }
+}
+
+void RawStreamWriter::finish() {
+    output.flush();
+}
+
+BinaryFileStreamWriter::BinaryFileStreamWriter(const std::string& path)
+    : output(path, std::ios::binary | std::ios::trunc), path(path), count(0) {
+    if (!output.is_open()) {
+        throw std::runtime_error("Не удалось создать файл " + path);
+    }
+    BinaryFileHeader header = MappedBinaryFile::make_array_header(BinaryArrayKind::Results, 0);
+    output.write(reinterpret_cast<const char*>(&header), sizeof(header));
+}
+
+void BinaryFileStreamWriter::write(std::span<const double> chunk) {
+    output.write(reinterpret_cast<const char*>(chunk.data()), static_cast<std::streamsize>(chunk.size_bytes()));
+    if (!output) {
+        throw std::runtime_error("Ошибка записи файла " + path);
+    }
+    count += chunk.size();
+}
+
+void BinaryFileStreamWriter::finish() {
+    BinaryFileHeader header = MappedBinaryFile::make_array_header(BinaryArrayKind::Results, count);
+    output.seekp(0);
+    output.write(reinterpret_cast<const char*>(&header), sizeof(header));
+    output.flush();
+    if (!output) {
+        throw std::runtime_error("Не удалось записать заголовок файла " + path);
+    }
+}
@@ -0,0 +1,200 @@
+/**
+ * @file stream_io.h
+ * @brief Источники точек и приемники результатов для потокового вычисления
+ */
+
+#ifndef STREAM_IO_H
+#define STREAM_IO_H
+
+#include "mapped_binary_file.h"
+#include <cstddef>
+#include <fstream>
+#include <istream>
+#include <ostream>
+#include <span>
+#include <string>
+#include <vector>
+
+/**
+ * @brief Размер буфера текстового чтения и записи (байт)
+ */
+constexpr size_t TEXT_STREAM_BUFFER = 1 << 20;
+
+/**
+ * @class StreamReader
+ * @brief Источник точек запроса, читаемый порциями
+ */
+class StreamReader {
+public:
+    virtual ~StreamReader() = default;
+
+    /**
+     * @brief Читает следующую порцию точек
+     * @param chunk Буфер порции
+     * @return Количество прочитанных точек (0 - поток исчерпан)
+     */
+    virtual size_t read(std::span<double> chunk) = 0;
+};
+
+/**
+ * @class StreamWriter
+ * @brief Приемник результатов, записываемый порциями
+ */
+class StreamWriter {
+public:
+    virtual ~StreamWriter() = default;
+
+    /**
+     * @brief Записывает порцию результатов
+     * @param chunk Результаты порции
+     */
+    virtual void write(std::span<const double> chunk) = 0;
+
+    /**
+     * @brief Завершает запись после последней порции
+     */
+    virtual void finish() {}
+};
+
+/**
+ * @class TextStreamReader
+ * @brief Числа в текстовом виде (файл или stdin)
+ *
+ * Вход читается блоками по TEXT_STREAM_BUFFER байт и разбирается
+ * TextTableLoader::parse_number (std::from_chars) без iostream-форматирования.
+ * Разделители - как у TextTableLoader (пробелы, табуляции, запятые, точки
+ * с запятой, переводы строк), комментарии после '#' пропускаются.
+ */
+class TextStreamReader : public StreamReader {
+private:
+    std::istream& input;       ///< Входной поток
+    std::vector<char> buffer;  ///< Прочитанный текст
+    size_t begin;              ///< Начало неразобранной части буфера
+    size_t end;                ///< Конец прочитанного текста в буфере
+    bool exhausted;            ///< Входной поток прочитан до конца
+
+    /**
+     * @brief Сдвигает неразобранный текст в начало буфера и дочитывает вход
+     * @return false, если вход исчерпан
+     */
+    bool refill();
+
+public:
+    explicit TextStreamReader(std::istream& input);
+
+    /**
+     * @throws std::runtime_error если во входном потоке встретилось не число
+     */
+    size_t read(std::span<double> chunk) override;
+};
+
+/**
+ * @class RawStreamReader
+ * @brief Сырые значения double в порядке байтов машины (файл или stdin)
+ */
+class RawStreamReader : public StreamReader {
+private:
+    std::istream& input;  ///< Входной поток (двоичный режим)
+
+public:
+    explicit RawStreamReader(std::istream& input);
+
+    /**
+     * @throws std::runtime_error если поток оборвался посреди значения
+     */
+    size_t read(std::span<double> chunk) override;
+};
+
+/**
+ * @class BinaryFileStreamReader
+ * @brief Точки из файла двоичного формата MappedBinaryFile
+ *
+ * Файл отображается в память, порции копируются из отображения: страницы
+ * подгружаются по мере чтения, и в памяти одновременно находится лишь их
+ * небольшая часть.
+ */
+class BinaryFileStreamReader : public StreamReader {
+private:
+    MappedBinaryFile file;  ///< Отображенный файл точек
+    size_t position;        ///< Следующая непрочитанная точка
+
+public:
+    /**
+     * @param path Имя файла точек
+     * @throws std::runtime_error если файл не открывается или содержит таблицу
+     */
+    explicit BinaryFileStreamReader(const std::string& path);
+
+    size_t read(std::span<double> chunk) override;
+};
+
+/**
+ * @class TextStreamWriter
+ * @brief Результаты по одному на строку
+ *
+ * Числа записываются TextTableLoader::format_number (std::to_chars,
+ * кратчайшее точное представление) в буфер TEXT_STREAM_BUFFER байт,
+ * который сбрасывается в поток целиком.
+ */
+class TextStreamWriter : public StreamWriter {
+private:
+    std::ostream& output;  ///< Выходной поток
+    std::string buffer;    ///< Отформатированные числа
+    size_t length;         ///< Занято символов в буфере
+
+    /**
+     * @brief Записывает буфер в поток
+     */
+    void drain();
+
+public:
+    explicit TextStreamWriter(std::ostream& output);
+
+    void write(std::span<const double> chunk) override;
+    void finish() override;
+};
+
+/**
+ * @class RawStreamWriter
+ * @brief Сырые значения double в порядке байтов машины
+ */
+class RawStreamWriter : public StreamWriter {
+private:
+    std::ostream& output;  ///< Выходной поток (двоичный режим)
+
+public:
+    explicit RawStreamWriter(std::ostream& output);
+
+    void write(std::span<const double> chunk) override;
+    void finish() override;
+};
+
+/**
+ * @class BinaryFileStreamWriter
+ * @brief Результаты в файл двоичного формата MappedBinaryFile
+ *
+ * Количество значений заранее неизвестно, поэтому заголовок записывается
+ * в начале и исправляется в finish.
+ */
+class BinaryFileStreamWriter : public StreamWriter {
+private:
+    std::ofstream output;  ///< Файл результатов
+    std::string path;      ///< Имя файла
+    size_t count;          ///< Записано значений
+
+public:
+    /**
+     * @param path Имя файла результатов
+     * @throws std::runtime_error если файл не создается
+     */
+    explicit BinaryFileStreamWriter(const std::string& path);
+
+    void write(std::span<const double> chunk) override;
+
+    /**
+     * @throws std::runtime_error если заголовок не удалось исправить
+     */
+    void finish() override;
+};
+
+#endif // STREAM_IO_H
@@ -0,0 +1,191 @@
+#include "streaming_evaluator.h"
+#include <chrono>
+#include <condition_variable>
+#include <deque>
+#include <exception>
+#include <mutex>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+namespace {
+
+using clock_type = std::chrono::steady_clock;
+
+double elapsed_ms(clock_type::time_point start) {
+    return std::chrono::duration<double, std::milli>(clock_type::now() - start).count();
+}
+
+/**
+ * @brief Буфер конвейера: точки порции и их результаты
+ */
+struct StreamSlot {
+    AlignedVector<double> points;
+    AlignedVector<double> results;
+    size_t count = 0;
+};
+
+/**
+ * @brief Очередь номеров буферов между этапами конвейера
+ *
+ * close() сообщает о конце потока (оставшиеся номера еще выдаются),
+ * abort() останавливает конвейер после ошибки (pop сразу возвращает false).
+ */
+class SlotQueue {
+private:
+    std::mutex mutex;
+    std::condition_variable ready;
+    std::deque<size_t> slots;
+    bool closed = false;
+    bool aborted = false;
+
+public:
+    void push(size_t slot) {
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            slots.push_back(slot);
+        }
+        ready.notify_one();
+    }
+
+    bool pop(size_t& slot) {
+        std::unique_lock<std::mutex> lock(mutex);
+        ready.wait(lock, [this] { return aborted || closed || !slots.empty(); });
+        if (aborted || slots.empty()) {
+            return false;
+        }
+        slot = slots.front();
+        slots.pop_front();
+        return true;
+    }
+
+    void close() {
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            closed = true;
+        }
+        ready.notify_all();
+    }
+
+    void abort() {
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            aborted = true;
+        }
+        ready.notify_all();
+    }
+};
+
+} // namespace
+
+double StreamingStats::points_per_second() const {
+    return wall_ms > 0.0 ? points / (wall_ms / 1000.0) : 0.0;
+}
+
+double StreamingStats::overlap() const {
+    return wall_ms > 0.0 ? (read_ms + compute_ms + write_ms) / wall_ms : 0.0;
+}
+
+StreamingEvaluator::StreamingEvaluator(const NewtonInterpolator& interpolator, size_t chunk_size, size_t buffer_count)
+    : interpolator(interpolator), chunk_size(chunk_size), buffer_count(buffer_count) {
+    if (chunk_size == 0) {
+        throw std::invalid_argument("Размер порции должен быть положительным");
+    }
+    if (buffer_count != 2 && buffer_count != 3) {
+        throw std::invalid_argument("Поддерживается двойная и тройная буферизация (2 или 3 буфера)");
+    }
+}
+
+StreamingStats StreamingEvaluator::run(StreamReader& reader, StreamWriter& writer) const {
+    if (interpolator.get_node_count() == 0) {
+        throw std::logic_error("Данные для интерполяции не установлены");
+    }
+
+    std::vector<StreamSlot> slots(buffer_count);
+    for (StreamSlot& slot : slots) {
+        slot.points.resize(chunk_size);
+        slot.results.resize(chunk_size);
+    }
+    SlotQueue free_slots;
+    SlotQueue filled_slots;
+    SlotQueue computed_slots;
+    for (size_t i = 0; i < buffer_count; i++) {
+        free_slots.push(i);
+    }
+
+    StreamingStats stats;
+    std::exception_ptr reader_error;
+    std::exception_ptr writer_error;
+    auto abort_all = [&]() {
+        free_slots.abort();
+        filled_slots.abort();
+        computed_slots.abort();
+    };
+
+    const clock_type::time_point start = clock_type::now();
+    std::thread read_thread([&]() {
+        try {
+            size_t slot = 0;
+            while (free_slots.pop(slot)) {
+                const clock_type::time_point read_start = clock_type::now();
+                slots[slot].count = reader.read(std::span<double>(slots[slot].points.data(), chunk_size));
+                stats.read_ms += elapsed_ms(read_start);
+                if (slots[slot].count == 0) {
+                    break;
+                }
+                filled_slots.push(slot);
+            }
+            filled_slots.close();
+        } catch (...) {
+            reader_error = std::current_exception();
+            abort_all();
+        }
+    });
+    std::thread write_thread([&]() {
+        try {
+            size_t slot = 0;
+            while (computed_slots.pop(slot)) {
+                const clock_type::time_point write_start = clock_type::now();
+                writer.write(std::span<const double>(slots[slot].results.data(), slots[slot].count));
+                stats.write_ms += elapsed_ms(write_start);
+                free_slots.push(slot);
+            }
+        } catch (...) {
+            writer_error = std::current_exception();
+            abort_all();
+        }
+    });
+
+    size_t slot = 0;
+    while (filled_slots.pop(slot)) {
+        StreamSlot& current = slots[slot];
+        const clock_type::time_point compute_start = clock_type::now();
+        interpolator.interpolate_into(std::span<const double>(current.points.data(), current.count),
+                                      std::span<double>(current.results.data(), current.count));
+        stats.compute_ms += elapsed_ms(compute_start);
+        stats.points += current.count;
+        stats.chunks++;
+        computed_slots.push(slot);
+    }
+    computed_slots.close();
+
+    read_thread.join();
+    write_thread.join();
+    if (reader_error) {
+        std::rethrow_exception(reader_error);
+    }
+    if (writer_error) {
+        std::rethrow_exception(writer_error);
+    }
+    writer.finish();
+    stats.wall_ms = elapsed_ms(start);
+    return stats;
+}
+
+size_t StreamingEvaluator::get_chunk_size() const {
+    return chunk_size;
+}
+
+size_t StreamingEvaluator::get_buffer_count() const {
+    return buffer_count;
+}
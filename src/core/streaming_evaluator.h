@@ -0,0 +1,92 @@
+/**
+ * @file streaming_evaluator.h
+ * @brief Потоковое вычисление с перекрытием чтения, вычисления и записи
+ */
+
+#ifndef STREAMING_EVALUATOR_H
+#define STREAMING_EVALUATOR_H
+
+#include "newton_interpolator.h"
+#include "stream_io.h"
+#include <cstddef>
+
+/**
+ * @brief Размер порции потокового вычисления по умолчанию (точек)
+ */
+constexpr size_t DEFAULT_STREAM_CHUNK = 1 << 16;
+
+/**
+ * @struct StreamingStats
+ * @brief Итоги потокового вычисления
+ */
+struct StreamingStats {
+    size_t points = 0;        ///< Вычислено точек
+    size_t chunks = 0;        ///< Обработано порций
+    double wall_ms = 0.0;     ///< Время конвейера целиком
+    double read_ms = 0.0;     ///< Суммарное время чтения
+    double compute_ms = 0.0;  ///< Суммарное время вычисления
+    double write_ms = 0.0;    ///< Суммарное время записи
+
+    /**
+     * @brief Пропускная способность конвейера, точек в секунду
+     */
+    double points_per_second() const;
+
+    /**
+     * @brief Степень перекрытия этапов: (чтение + вычисление + запись) / общее время
+     *
+     * 1 - этапы выполнялись строго по очереди, до 3 - полностью перекрывались.
+     */
+    double overlap() const;
+};
+
+/**
+ * @class StreamingEvaluator
+ * @brief Вычисляет поток точек произвольной длины в ограниченной памяти
+ *
+ * Конвейер из трех этапов на кольце из buffer_count буферов: отдельный поток
+ * читает порцию k+1, вызывающий поток вычисляет порцию k параллельным путем
+ * interpolate_into (OpenMP, планировщик или профиль автонастройки
+ * интерполятора), отдельный поток пишет порцию k-1. Память ограничена
+ * buffer_count * chunk_size точек и результатов независимо от длины потока.
+ * При двух буферах чтение и запись делят один свободный буфер.
+ */
+class StreamingEvaluator {
+private:
+    const NewtonInterpolator& interpolator;  ///< Интерполятор с установленными данными
+    size_t chunk_size;                       ///< Точек в порции
+    size_t buffer_count;                     ///< Буферов в кольце (2 или 3)
+
+public:
+    /**
+     * @brief Конструктор
+     * @param interpolator Интерполятор (должен жить дольше вычислителя)
+     * @param chunk_size Точек в порции
+     * @param buffer_count Буферов в кольце: 2 - двойная, 3 - тройная буферизация
+     * @throws std::invalid_argument если chunk_size равен 0 или buffer_count не 2 и не 3
+     */
+    explicit StreamingEvaluator(const NewtonInterpolator& interpolator,
+                                size_t chunk_size = DEFAULT_STREAM_CHUNK, size_t buffer_count = 3);
+
+    /**
+     * @brief Вычисляет весь поток
+     * @param reader Источник точек
+     * @param writer Приемник результатов (в порядке точек)
+     * @return Итоги и время этапов
+     * @throws std::logic_error если данные интерполятора не установлены
+     * @throws Исключение источника или приемника (конвейер останавливается)
+     */
+    StreamingStats run(StreamReader& reader, StreamWriter& writer) const;
+
+    /**
+     * @brief Возвращает размер порции
+     */
+    size_t get_chunk_size() const;
+
+    /**
+     * @brief Возвращает количество буферов
+     */
+    size_t get_buffer_count() const;
+};
+
+#endif // STREAMING_EVALUATOR_H
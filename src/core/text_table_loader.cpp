@@ -0,0 +1,165 @@
+#include "text_table_loader.h"
+#include "mapped_file.h"
+#include <algorithm>
+#include <charconv>
+#include <cstring>
+#include <omp.h>
+#include <stdexcept>
+
+namespace {
+
+/**
+ * @brief Результат разбора участка текста
+ */
+struct ParsedChunk {
+    std::vector<std::vector<double>> columns;  ///< Столбцы участка
+    size_t lines = 0;                          ///< Строк в участке
+    size_t error_line = 0;                     ///< Номер строки с ошибкой внутри участка (с 1, 0 - без ошибок)
+};
+
+/**
+ * @brief Разбирает участок, начинающийся с начала строки
+ * @param allow_header Пропустить первую строку, в которой не разбирается первое же поле
+ *                     (участок в начале текста); короткие строки и мусор в следующих
+ *                     полях остаются ошибками
+ */
+void parse_chunk(const char* begin, const char* end, size_t column_count, bool allow_header, ParsedChunk& chunk) {
+    chunk.columns.assign(column_count, std::vector<double>());
+    double values[16];
+    std::vector<double> wide_values(column_count > 16 ? column_count : 0);
+    double* row = column_count > 16 ? wide_values.data() : values;
+    bool header_allowed = allow_header;
+
+    const char* line = begin;
+    while (line < end) {
+        const char* newline = static_cast<const char*>(std::memchr(line, '\n', end - line));
+        const char* line_end = newline != nullptr ? newline : end;
+        chunk.lines++;
+
+        const char* cursor = line;
+        size_t parsed = 0;
+        bool blank = false;
+        bool text_first = false;
+        while (parsed < column_count) {
+            while (cursor < line_end && TextTableLoader::is_separator(*cursor)) {
+                cursor++;
+            }
+            if (cursor == line_end || *cursor == '#') {
+                blank = parsed == 0;
+                break;
+            }
+            if (!TextTableLoader::parse_number(cursor, line_end, row[parsed])) {
+                text_first = parsed == 0;
+                break;
+            }
+            parsed++;
+        }
+
+        if (parsed == column_count) {
+            for (size_t c = 0; c < column_count; c++) {
+                chunk.columns[c].push_back(row[c]);
+            }
+            header_allowed = false;
+        } else if (!blank) {
+            if (!header_allowed || !text_first) {
+                chunk.error_line = chunk.lines;
+                return;
+            }
+            header_allowed = false;
+        }
+        line = line_end + 1;
+    }
+}
+
+} // namespace
+
+TextTableLoader::TextTableLoader(size_t thread_count, size_t parallel_threshold)
+    : thread_count(thread_count), parallel_threshold(parallel_threshold) {}
+
+bool TextTableLoader::is_separator(char c) {
+    return c == ' ' || c == '\t' || c == ',' || c == ';' || c == '\r';
+}
+
+bool TextTableLoader::parse_number(const char*& cursor, const char* end, double& value) {
+    const char* start = cursor;
+    if (start < end && *start == '+') {
+        start++;
+    }
+    std::from_chars_result result = std::from_chars(start, end, value);
+    if (result.ec != std::errc() || (result.ptr < end && !is_separator(*result.ptr) &&
+                                     *result.ptr != '#' && *result.ptr != '\n')) {
+        return false;
+    }
+    cursor = result.ptr;
+    return true;
+}
+
+char* TextTableLoader::format_number(char* cursor, double value) {
+    return std::to_chars(cursor, cursor + MAX_NUMBER_CHARS, value).ptr;
+}
+
+std::vector<std::vector<double>> TextTableLoader::parse_columns(std::string_view text, size_t column_count,
+                                                                const std::string& source) const {
+    if (column_count == 0) {
+        throw std::invalid_argument("Количество столбцов должно быть положительным");
+    }
+
+    size_t threads = thread_count > 0 ? thread_count : static_cast<size_t>(omp_get_max_threads());
+    if (text.size() < parallel_threshold) {
+        threads = 1;
+    }
+
+    // Границы участков сдвигаются вперед до начала следующей строки
+    const char* const begin = text.data();
+    const char* const end = begin + text.size();
+    std::vector<const char*> bounds(threads + 1, end);
+    bounds[0] = begin;
+    for (size_t t = 1; t < threads; t++) {
+        const char* bound = std::max(begin + text.size() * t / threads, bounds[t - 1]);
+        const char* newline = static_cast<const char*>(std::memchr(bound, '\n', end - bound));
+        bounds[t] = newline != nullptr ? newline + 1 : end;
+    }
+
+    std::vector<ParsedChunk> chunks(threads);
+    #pragma omp parallel for schedule(static, 1) num_threads(static_cast<int>(threads))
+    for (long t = 0; t < static_cast<long>(threads); t++) {
+        parse_chunk(bounds[t], bounds[t + 1], column_count, t == 0, chunks[t]);
+    }
+
+    std::vector<size_t> offsets(threads + 1, 0);
+    size_t line_base = 0;
+    for (size_t t = 0; t < threads; t++) {
+        if (chunks[t].error_line != 0) {
+            throw std::runtime_error("Ошибка разбора " + source + ", строка " +
+                                     std::to_string(line_base + chunks[t].error_line) + ": ожидалось " +
+                                     std::to_string(column_count) + " чисел");
+        }
+        line_base += chunks[t].lines;
+        offsets[t + 1] = offsets[t] + chunks[t].columns[0].size();
+    }
+
+    std::vector<std::vector<double>> columns(column_count, std::vector<double>(offsets[threads]));
+    #pragma omp parallel for schedule(static, 1) num_threads(static_cast<int>(threads))
+    for (long t = 0; t < static_cast<long>(threads); t++) {
+        for (size_t c = 0; c < column_count; c++) {
+            std::copy(chunks[t].columns[c].begin(), chunks[t].columns[c].end(), columns[c].begin() + offsets[t]);
+        }
+    }
+    return columns;
+}
+
+std::vector<std::vector<double>> TextTableLoader::load_columns(const std::string& path, size_t column_count) const {
+    MappedFile file = MappedFile::open(path);
+    std::string_view text(reinterpret_cast<const char*>(file.get_data()), file.get_size());
+    return parse_columns(text, column_count, path);
+}
+
+void TextTableLoader::load_table(const std::string& path, std::vector<double>& x, std::vector<double>& y) const {
+    std::vector<std::vector<double>> columns = load_columns(path, 2);
+    x = std::move(columns[0]);
+    y = std::move(columns[1]);
+}
+
+std::vector<double> TextTableLoader::load_points(const std::string& path) const {
+    return std::move(load_columns(path, 1)[0]);
+}
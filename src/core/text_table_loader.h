@@ -0,0 +1,111 @@
+/**
+ * @file text_table_loader.h
+ * @brief Параллельный разбор текстовых таблиц узлов и файлов точек
+ */
+
+#ifndef TEXT_TABLE_LOADER_H
+#define TEXT_TABLE_LOADER_H
+
+#include <cstddef>
+#include <string>
+#include <string_view>
+#include <vector>
+
+/**
+ * @brief Размер файла, начиная с которого разбор делится между потоками (байт)
+ */
+constexpr size_t DEFAULT_TEXT_PARALLEL_THRESHOLD = 1 << 20;
+
+/**
+ * @brief Наибольшая длина числа, записываемого format_number
+ */
+constexpr size_t MAX_NUMBER_CHARS = 32;
+
+/**
+ * @class TextTableLoader
+ * @brief Загружает столбцы чисел из CSV или текста с пробелами
+ *
+ * Файл отображается в память (MappedFile) и делится на участки по границам
+ * строк, каждый участок разбирается своим потоком OpenMP через
+ * std::from_chars без iostream и без копирования текста. Затем участки
+ * склеиваются в непрерывные столбцы, которые передаются в
+ * NewtonInterpolator::set_data или interpolate_into как есть.
+ *
+ * Формат строки: числа, разделенные пробелами, табуляциями, запятыми или
+ * точками с запятой. Пустые строки и комментарии после '#' пропускаются,
+ * столбцы сверх нужных игнорируются. Первая строка файла, в которой уже
+ * первое поле не является числом, считается заголовком и пропускается;
+ * строка с числом в начале, но с мусором или нехваткой чисел дальше - ошибка.
+ */
+class TextTableLoader {
+private:
+    size_t thread_count;        ///< Потоков разбора (0 - omp_get_max_threads)
+    size_t parallel_threshold;  ///< Текст короче порога разбирается одним потоком
+
+public:
+    /**
+     * @brief Конструктор
+     * @param thread_count Потоков разбора (0 - по числу потоков OpenMP)
+     * @param parallel_threshold Минимальный размер текста для параллельного разбора, байт
+     */
+    explicit TextTableLoader(size_t thread_count = 0, size_t parallel_threshold = DEFAULT_TEXT_PARALLEL_THRESHOLD);
+
+    /**
+     * @brief Разбирает текст в памяти
+     * @param text Текст таблицы
+     * @param column_count Количество читаемых столбцов (больше 0)
+     * @param source Имя источника для сообщений об ошибках
+     * @return Столбцы одинаковой длины
+     * @throws std::runtime_error если в строке меньше column_count чисел или число некорректно
+     */
+    std::vector<std::vector<double>> parse_columns(std::string_view text, size_t column_count,
+                                                   const std::string& source = "текст") const;
+
+    /**
+     * @brief Загружает столбцы из файла
+     * @param path Имя файла
+     * @param column_count Количество читаемых столбцов
+     * @return Столбцы одинаковой длины
+     * @throws std::runtime_error если файл не открывается или содержит ошибку
+     */
+    std::vector<std::vector<double>> load_columns(const std::string& path, size_t column_count) const;
+
+    /**
+     * @brief Загружает таблицу узлов (первые два столбца - x и y)
+     * @param path Имя файла
+     * @param x Значения x
+     * @param y Значения y
+     */
+    void load_table(const std::string& path, std::vector<double>& x, std::vector<double>& y) const;
+
+    /**
+     * @brief Загружает точки запроса (первый столбец)
+     * @param path Имя файла
+     * @return Точки в порядке файла
+     */
+    std::vector<double> load_points(const std::string& path) const;
+
+    /**
+     * @brief Разбирает одно число
+     * @param cursor Начало числа (сдвигается за число при успехе)
+     * @param end Конец текста
+     * @param value Результат
+     * @return true, если число разобрано и за ним следует разделитель, '#' или конец текста
+     */
+    static bool parse_number(const char*& cursor, const char* end, double& value);
+
+    /**
+     * @brief Записывает число кратчайшим представлением, точно восстанавливающим double
+     * @param cursor Начало буфера (не меньше MAX_NUMBER_CHARS свободных символов)
+     * @param value Значение
+     * @return Указатель за последним записанным символом
+     */
+    static char* format_number(char* cursor, double value);
+
+    /**
+     * @brief Проверяет, является ли символ разделителем чисел в строке
+     */
+    static bool is_separator(char c);
+};
+
+#endif // TEXT_TABLE_LOADER_H
@@ -0,0 +1,64 @@
+#include "text_table_writer.h"
+#include "text_table_loader.h"
+#include <algorithm>
+#include <fstream>
+#include <omp.h>
+#include <stdexcept>
+
+void TextTableWriter::write_columns(const std::string& path, const std::vector<std::span<const double>>& columns,
+                                    char separator) {
+    if (columns.empty()) {
+        throw std::invalid_argument("Нет столбцов для записи");
+    }
+    const size_t rows = columns[0].size();
+    for (const std::span<const double>& column : columns) {
+        if (column.size() != rows) {
+            throw std::invalid_argument("Длины столбцов должны совпадать");
+        }
+    }
+
+    std::ofstream file(path, std::ios::binary | std::ios::trunc);
+    if (!file.is_open()) {
+        throw std::runtime_error("Не удалось создать файл " + path);
+    }
+
+    const size_t threads = static_cast<size_t>(omp_get_max_threads());
+    const size_t row_chars = columns.size() * (MAX_NUMBER_CHARS + 1);
+    std::vector<std::string> buffers(threads);
+    std::vector<size_t> lengths(threads);
+    for (size_t batch = 0; batch < rows; batch += TEXT_WRITE_BATCH_ROWS) {
+        const size_t batch_rows = std::min(TEXT_WRITE_BATCH_ROWS, rows - batch);
+        #pragma omp parallel for schedule(static, 1) num_threads(static_cast<int>(threads))
+        for (long t = 0; t < static_cast<long>(threads); t++) {
+            const size_t first = batch + batch_rows * t / threads;
+            const size_t last = batch + batch_rows * (t + 1) / threads;
+            std::string& buffer = buffers[t];
+            buffer.resize((last - first) * row_chars);
+            char* cursor = buffer.data();
+            for (size_t i = first; i < last; i++) {
+                for (size_t c = 0; c < columns.size(); c++) {
+                    if (c > 0) {
+                        *cursor++ = separator;
+                    }
+                    cursor = TextTableLoader::format_number(cursor, columns[c][i]);
+                }
+                *cursor++ = '\n';
+            }
+            lengths[t] = static_cast<size_t>(cursor - buffer.data());
+        }
+        for (size_t t = 0; t < threads; t++) {
+            file.write(buffers[t].data(), static_cast<std::streamsize>(lengths[t]));
+        }
+    }
+    if (!file) {
+        throw std::runtime_error("Ошибка записи файла " + path);
+    }
+}
+
+void TextTableWriter::write_table(const std::string& path, std::span<const double> x, std::span<const double> y) {
+    write_columns(path, {x, y});
+}
+
+void TextTableWriter::write_points(const std::string& path, std::span<const double> values) {
+    write_columns(path, {values});
+}
@@ -0,0 +1,52 @@
+/**
+ * @file text_table_writer.h
+ * @brief Параллельная запись столбцов чисел в текстовый файл
+ */
+
+#ifndef TEXT_TABLE_WRITER_H
+#define TEXT_TABLE_WRITER_H
+
+#include <cstddef>
+#include <span>
+#include <string>
+#include <vector>
+
+/**
+ * @brief Строк, форматируемых за один проход перед записью в файл
+ */
+constexpr size_t TEXT_WRITE_BATCH_ROWS = 1 << 20;
+
+/**
+ * @class TextTableWriter
+ * @brief Записывает столбцы в формате, который читает TextTableLoader
+ *
+ * Строки форматируются через std::to_chars (кратчайшее представление,
+ * точно восстанавливающее double) в большие буферы потоков OpenMP, затем
+ * буферы записываются в файл по порядку. Проходы по TEXT_WRITE_BATCH_ROWS
+ * строк ограничивают память при записи таблиц любой длины.
+ */
+class TextTableWriter {
+public:
+    /**
+     * @brief Записывает столбцы одинаковой длины
+     * @param path Имя файла
+     * @param columns Столбцы
+     * @param separator Разделитель чисел в строке
+     * @throws std::invalid_argument если столбцов нет или длины различаются
+     * @throws std::runtime_error если файл не записывается
+     */
+    static void write_columns(const std::string& path, const std::vector<std::span<const double>>& columns,
+                              char separator = ' ');
+
+    /**
+     * @brief Записывает таблицу узлов в два столбца
+     */
+    static void write_table(const std::string& path, std::span<const double> x, std::span<const double> y);
+
+    /**
+     * @brief Записывает точки или результаты по одному на строку
+     */
+    static void write_points(const std::string& path, std::span<const double> values);
+};
+
+#endif // TEXT_TABLE_WRITER_H
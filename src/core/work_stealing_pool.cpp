@@ -0,0 +1,202 @@
+#include "work_stealing_pool.h"
+#include <algorithm>
+
+/**
+ * @brief Признак того, что текущий поток выполняет цикл пула
+ */
+static thread_local bool inside_pool = false;
+
+/**
+ * @brief Номер текущего потока в пуле
+ */
+static thread_local size_t worker_index = 0;
+
+WorkStealingPool::WorkStealingPool(size_t thread_count)
+    : thread_count(thread_count), generation(0), active_workers(0), stopping(false),
+      function(nullptr), context(nullptr), grain(1), remaining(0), steals(0), runs(0) {
+    if (this->thread_count == 0) {
+        this->thread_count = std::max(1u, std::thread::hardware_concurrency());
+    }
+    queues.reset(new WorkerQueue[this->thread_count]);
+    threads.reserve(this->thread_count - 1);
+    for (size_t id = 1; id < this->thread_count; id++) {
+        threads.emplace_back(&WorkStealingPool::worker_loop, this, id);
+    }
+}
+
+WorkStealingPool::~WorkStealingPool() {
+    {
+        std::lock_guard<std::mutex> guard(state_lock);
+        stopping = true;
+    }
+    start_signal.notify_all();
+    for (std::thread& thread : threads) {
+        thread.join();
+    }
+}
+
+void WorkStealingPool::run(size_t count, size_t grain, RangeFunction function, void* context) {
+    if (count == 0) {
+        return;
+    }
+    runs.fetch_add(1, std::memory_order_relaxed);
+    if (threads.empty() || inside_pool) {
+        function(context, 0, count);
+        return;
+    }
+
+    std::lock_guard<std::mutex> run_guard(run_lock);
+    this->grain = std::max<size_t>(grain, 1);
+    error = nullptr;
+
+    // Начальное разбиение: по одному непрерывному диапазону на поток
+    const size_t per_thread = count / thread_count;
+    const size_t extra = count % thread_count;
+    size_t begin = 0;
+    for (size_t id = 0; id < thread_count; id++) {
+        const size_t length = per_thread + (id < extra ? 1 : 0);
+        WorkerQueue& queue = queues[id];
+        queue.head = 0;
+        queue.count = 0;
+        if (length > 0) {
+            queue.ranges[0] = Range{begin, begin + length};
+            queue.count = 1;
+        }
+        begin += length;
+    }
+    remaining.store(count, std::memory_order_relaxed);
+
+    {
+        std::lock_guard<std::mutex> guard(state_lock);
+        this->function = function;
+        this->context = context;
+        active_workers = threads.size();
+        generation++;
+    }
+    start_signal.notify_all();
+
+    inside_pool = true;
+    execute(0);
+    inside_pool = false;
+
+    {
+        std::unique_lock<std::mutex> guard(state_lock);
+        done_signal.wait(guard, [this]() { return active_workers == 0; });
+    }
+    if (error) {
+        std::rethrow_exception(error);
+    }
+}
+
+void WorkStealingPool::worker_loop(size_t id) {
+    inside_pool = true;
+    worker_index = id;
+    size_t seen = 0;
+    while (true) {
+        {
+            std::unique_lock<std::mutex> guard(state_lock);
+            start_signal.wait(guard, [&]() { return stopping || generation != seen; });
+            if (stopping) {
+                return;
+            }
+            seen = generation;
+        }
+
+        execute(id);
+
+        {
+            std::lock_guard<std::mutex> guard(state_lock);
+            if (--active_workers == 0) {
+                done_signal.notify_one();
+            }
+        }
+    }
+}
+
+void WorkStealingPool::execute(size_t id) {
+    Range range;
+    while (remaining.load(std::memory_order_acquire) > 0) {
+        if (!pop_local(id, range) && !steal(id, range)) {
+            std::this_thread::yield();
+            continue;
+        }
+
+        // Ленивое деление: правая половина откладывается и доступна для перехвата
+        while (range.end - range.begin > grain) {
+            const size_t middle = range.begin + (range.end - range.begin) / 2;
+            if (!push_local(id, Range{middle, range.end})) {
+                break;
+            }
+            range.end = middle;
+        }
+
+        try {
+            function(context, range.begin, range.end);
+        } catch (...) {
+            std::lock_guard<std::mutex> guard(error_lock);
+            if (!error) {
+                error = std::current_exception();
+            }
+        }
+        remaining.fetch_sub(range.end - range.begin, std::memory_order_acq_rel);
+    }
+}
+
+bool WorkStealingPool::push_local(size_t id, Range range) {
+    WorkerQueue& queue = queues[id];
+    std::lock_guard<std::mutex> guard(queue.lock);
+    if (queue.count == WorkerQueue::CAPACITY) {
+        return false;
+    }
+    queue.ranges[(queue.head + queue.count) % WorkerQueue::CAPACITY] = range;
+    queue.count++;
+    return true;
+}
+
+bool WorkStealingPool::pop_local(size_t id, Range& range) {
+    WorkerQueue& queue = queues[id];
+    std::lock_guard<std::mutex> guard(queue.lock);
+    if (queue.count == 0) {
+        return false;
+    }
+    queue.count--;
+    range = queue.ranges[(queue.head + queue.count) % WorkerQueue::CAPACITY];
+    return true;
+}
+
+bool WorkStealingPool::steal(size_t id, Range& range) {
+    for (size_t offset = 1; offset < thread_count; offset++) {
+        WorkerQueue& victim = queues[(id + offset) % thread_count];
+        std::lock_guard<std::mutex> guard(victim.lock);
+        if (victim.count == 0) {
+            continue;
+        }
+        range = victim.ranges[victim.head];
+        victim.head = (victim.head + 1) % WorkerQueue::CAPACITY;
+        victim.count--;
+        steals.fetch_add(1, std::memory_order_relaxed);
+        return true;
+    }
+    return false;
+}
+
+size_t WorkStealingPool::get_thread_count() const {
+    return thread_count;
+}
+
+size_t WorkStealingPool::get_steal_count() const {
+    return steals.load(std::memory_order_relaxed);
+}
+
+size_t WorkStealingPool::get_run_count() const {
+    return runs.load(std::memory_order_relaxed);
+}
+
+size_t WorkStealingPool::current_worker() {
+    return worker_index;
+}
+
+WorkStealingPool& WorkStealingPool::shared() {
+    static WorkStealingPool pool;
+    return pool;
+}
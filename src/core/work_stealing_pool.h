@@ -0,0 +1,155 @@
+/**
+ * @file work_stealing_pool.h
+ * @brief Постоянный пул потоков с перехватом работы (work stealing)
+ */
+
+#ifndef WORK_STEALING_POOL_H
+#define WORK_STEALING_POOL_H
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <exception>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+/**
+ * @class WorkStealingPool
+ * @brief Пул потоков для параллельных циклов по диапазону индексов
+ *
+ * Потоки создаются один раз и переиспользуются между вызовами, поэтому пул
+ * можно разделять между несколькими интерполяторами. Диапазон делится поровну
+ * между очередями потоков; поток берет диапазон с конца своей очереди и
+ * делит его пополам, пока он больше зерна, откладывая правую половину.
+ * Освободившийся поток перехватывает самый крупный (старый) диапазон из
+ * начала чужой очереди. Вызывающий поток работает как поток 0.
+ *
+ * Одновременно выполняется один цикл; вложенный вызов из потока пула
+ * выполняется последовательно в вызывающем потоке.
+ */
+class WorkStealingPool {
+public:
+    /**
+     * @brief Тело цикла: обрабатывает индексы [begin, end)
+     */
+    using RangeFunction = void (*)(void* context, size_t begin, size_t end);
+
+private:
+    /**
+     * @brief Полуинтервал индексов
+     */
+    struct Range {
+        size_t begin;
+        size_t end;
+    };
+
+    /**
+     * @brief Кольцевая очередь диапазонов одного потока
+     *
+     * Глубина ограничена: каждое деление вдвое уменьшает диапазон, поэтому
+     * в очереди одновременно не больше log2(count) отложенных половин.
+     */
+    struct alignas(64) WorkerQueue {
+        static const size_t CAPACITY = 128;
+        std::mutex lock;
+        Range ranges[CAPACITY];
+        size_t head = 0;
+        size_t count = 0;
+    };
+
+    std::vector<std::thread> threads;           ///< Потоки 1..N-1 (поток 0 - вызывающий)
+    std::unique_ptr<WorkerQueue[]> queues;      ///< Очереди всех потоков
+    size_t thread_count;                        ///< Количество потоков с учетом вызывающего
+
+    std::mutex run_lock;                        ///< Сериализует циклы от разных вызывающих
+    std::mutex state_lock;                      ///< Защищает поколение и счетчик активных потоков
+    std::condition_variable start_signal;       ///< Сигнал начала цикла
+    std::condition_variable done_signal;        ///< Сигнал завершения всех потоков
+    size_t generation;                          ///< Номер текущего цикла
+    size_t active_workers;                      ///< Потоки, еще не завершившие цикл
+    bool stopping;                              ///< Признак остановки пула
+
+    RangeFunction function;                     ///< Тело текущего цикла
+    void* context;                              ///< Контекст тела цикла
+    size_t grain;                               ///< Минимальный размер диапазона
+    std::atomic<size_t> remaining;              ///< Необработанные индексы
+    std::atomic<size_t> steals;                 ///< Всего перехваченных диапазонов
+    std::atomic<size_t> runs;                   ///< Всего непустых циклов run
+    std::exception_ptr error;                   ///< Первое исключение из тела цикла
+    std::mutex error_lock;                      ///< Защищает error
+
+    void worker_loop(size_t id);
+    void execute(size_t id);
+    bool push_local(size_t id, Range range);
+    bool pop_local(size_t id, Range& range);
+    bool steal(size_t id, Range& range);
+
+public:
+    /**
+     * @brief Конструктор
+     * @param thread_count Количество потоков (0 - по числу аппаратных потоков)
+     */
+    explicit WorkStealingPool(size_t thread_count = 0);
+
+    /**
+     * @brief Останавливает и присоединяет потоки
+     */
+    ~WorkStealingPool();
+
+    WorkStealingPool(const WorkStealingPool&) = delete;
+    WorkStealingPool& operator=(const WorkStealingPool&) = delete;
+
+    /**
+     * @brief Выполняет тело для всех индексов [0, count)
+     * @param count Количество индексов
+     * @param grain Минимальный размер диапазона (0 трактуется как 1)
+     * @param function Тело цикла
+     * @param context Контекст, передаваемый телу
+     *
+     * Исключение из тела цикла перебрасывается вызывающему после завершения
+     * всех потоков.
+     */
+    void run(size_t count, size_t grain, RangeFunction function, void* context);
+
+    /**
+     * @brief Выполняет функтор body(begin, end) для всех индексов [0, count)
+     * @param count Количество индексов
+     * @param grain Минимальный размер диапазона
+     * @param body Функтор, вызываемый для поддиапазонов
+     */
+    template <typename Body>
+    void parallel_for(size_t count, size_t grain, Body& body) {
+        run(count, grain, [](void* ctx, size_t begin, size_t end) {
+            (*static_cast<Body*>(ctx))(begin, end);
+        }, &body);
+    }
+
+    /**
+     * @brief Возвращает количество потоков с учетом вызывающего
+     */
+    size_t get_thread_count() const;
+
+    /**
+     * @brief Возвращает количество перехваченных диапазонов за все время
+     */
+    size_t get_steal_count() const;
+
+    /**
+     * @brief Возвращает количество непустых циклов run за все время
+     */
+    size_t get_run_count() const;
+
+    /**
+     * @brief Номер потока пула, выполняющего текущий цикл (0 - вызывающий или вне пула)
+     */
+    static size_t current_worker();
+
+    /**
+     * @brief Общий пул процесса (создается при первом обращении)
+     */
+    static WorkStealingPool& shared();
+};
+
+#endif // WORK_STEALING_POOL_H
@@ -1,4 +1,5 @@
 #include <iostream>
+#include <memory>
 #include <vector>
 #include <chrono>
 #include <cmath>
@@ -6,9 +7,12 @@
 #include <iomanip>
 #include <limits>
 #include <algorithm>
+#include <cstdlib>
+#include <string>
 #include <omp.h>
 #include "core/newton_interpolator.h"
 #include "core/gnuplot_visualizer.h"
+#include "core/accuracy_verifier.h"
 
 /**
  * @brief Генерирует случайные точки для интерполяции
@@ -63,12 +67,13 @@ double calculate_absolute_error(double original_y, double interpolated_y) {
  */
 double measure_execution_time(NewtonInterpolator& interpolator, 
                             const std::vector<double>& points, 
+                            std::vector<double>& results,
                             int num_threads) {
     omp_set_num_threads(num_threads);
     
     auto start = std::chrono::high_resolution_clock::now();
     
-    std::vector<double> results = interpolator.interpolate_multiple(points);
+    interpolator.interpolate_into(points, results);
     
     auto end = std::chrono::high_resolution_clock::now();
     std::chrono::duration<double, std::milli> duration = end - start;
@@ -76,11 +81,71 @@ double measure_execution_time(NewtonInterpolator& interpolator,
     return duration.count();
 }
 
-int main() {
+/**
+ * @brief Дополняет строку UTF-8 пробелами до ширины в символах
+ */
+std::string pad_right(const std::string& text, size_t width) {
+    size_t characters = 0;
+    for (unsigned char c : text) {
+        if ((c & 0xC0) != 0x80) {
+            characters++;
+        }
+    }
+    return text + std::string(width > characters ? width - characters : 0, ' ');
+}
+
+/**
+ * @brief Режим проверки точности (main --verify [количество точек])
+ *
+ * Для каждой эталонной функции выводит ошибки всех режимов вычисления.
+ * Возвращает 1, если какое-либо ядро Горнера (форма Ньютона, путь Points)
+ * ухудшает точность скалярного (см. AccuracyVerifier::matches_baseline).
+ * Сетка, Чебышев, мономы, барицентрическая и кусочная формы только
+ * выводятся и на код возврата не влияют.
+ */
+int run_verification(size_t count) {
+    std::vector<VerificationMode> modes = AccuracyVerifier::default_modes();
+    std::cout << "Проверка точности на " << count << " точках, потоков: " << omp_get_max_threads() << std::endl;
+    bool kernels_match = true;
+    for (const ReferenceProblem& problem : AccuracyVerifier::standard_problems()) {
+        double start = omp_get_wtime();
+        std::vector<AccuracyReport> reports = AccuracyVerifier::verify(problem, modes, count);
+        double elapsed_ms = 1000.0 * (omp_get_wtime() - start);
+        
+        std::cout << "\n" << reports.front().problem << " (" << elapsed_ms << " мс)" << std::endl;
+        std::cout << pad_right("Режим", 20) << pad_right("  Макс. ошибка", 14) << pad_right("           СКО", 14)
+                << pad_right("      Относит.", 14) << pad_right("       От базы", 14) << std::endl;
+        for (size_t m = 0; m < reports.size(); m++) {
+            const AccuracyReport& report = reports[m];
+            bool kernel = modes[m].method == InterpolationMethod::Newton && modes[m].path == VerificationPath::Points;
+            bool mismatch = kernel && !AccuracyVerifier::matches_baseline(report, reports.front());
+            kernels_match = kernels_match && !mismatch;
+            std::cout << pad_right(report.mode, 20) << std::scientific << std::setprecision(3)
+                    << std::setw(14) << report.max_error << std::setw(14) << report.rms_error
+                    << std::setw(14) << report.relative_error << std::setw(14) << report.baseline_deviation
+                    << (mismatch ? "  ОТЛИЧАЕТСЯ" : "") << std::defaultfloat << std::endl;
+        }
+    }
+    std::cout << (kernels_match ? "\nВсе ядра совпадают со скалярным" : "\nЕсть ядра, отличающиеся от скалярного")
+            << std::endl;
+    return kernels_match ? 0 : 1;
+}
+
+int main(int argc, char** argv) {
 #ifdef _WIN32
     system("chcp 65001 > nul");
 #endif
     
+    if (argc > 1 && std::string(argv[1]) == "--verify") {
+        size_t count = argc > 2 ? static_cast<size_t>(std::strtoull(argv[2], nullptr, 10)) : 2000000;
+        try {
+            return run_verification(count);
+        } catch (const std::exception& e) {
+            std::cerr << "Ошибка: " << e.what() << std::endl;
+            return 1;
+        }
+    }
+    
     const double start_range = 0.0;
     const double end_range = 10.0;
     const double min_y = -10.0;
@@ -88,6 +153,50 @@ int main() {
     size_t num_nodes = 25;
     std::cout << "Тестирование интерполяции по " << num_nodes << " случайным точкам" << std::endl;
 
+    // Профиль автонастройки хранится только по явно заданному пути,
+    // иначе настройка выполняется в памяти и рабочий каталог не засоряется
+    std::string profile_path;
+    for (int i = 1; i + 1 < argc; i++) {
+        if (std::string(argv[i]) == "--autotune-profile") {
+            profile_path = argv[++i];
+        }
+    }
+
+    Autotuner tuner;
+    bool profile_loaded = false;
+    if (!profile_path.empty()) {
+        try {
+            tuner.load(profile_path);
+            profile_loaded = true;
+            std::cout << "Профиль автонастройки загружен: " << profile_path << std::endl;
+        } catch (const std::exception&) {
+            // Профиля нет или он поврежден - настраиваем заново
+        }
+    }
+    if (!profile_loaded) {
+        tuner.tune(num_nodes);
+        if (!profile_path.empty()) {
+            try {
+                tuner.save(profile_path);
+                std::cout << "Профиль автонастройки сохранен: " << profile_path << std::endl;
+            } catch (const std::exception& e) {
+                std::cerr << "Предупреждение: " << e.what() << std::endl;
+            }
+        }
+    }
+
+    // Один процесс gnuplot на все графики, отрисовка не задерживает измерения
+    std::unique_ptr<GnuplotSession> plots;
+    try {
+        plots = std::make_unique<GnuplotSession>(true);
+    } catch (const std::exception& e) {
+        std::cerr << "Предупреждение: " << e.what() << ", графики строиться не будут" << std::endl;
+    }
+
+    // Повторные измерения для медиан и доверительных интервалов ускорения
+    const Benchmark benchmark(1, 7);
+    std::vector<ScalingSeries> all_scaling;
+
     for (int i = 0; i < 5; i++) {
         std::cout << "Итерация " << i+1 << ":" << std::endl;
         std::vector<double> x_nodes = generate_random_points(start_range, end_range, num_nodes);
@@ -101,31 +210,67 @@ int main() {
             
             std::vector<double> interp_points = NewtonInterpolator::generate_points(start_range, end_range, num_interp_points);
             
+            std::vector<double> interp_results(interp_points.size());
             std::vector<double> speedups;
-            double single_thread_time = 0.0;
             
-            for (int threads : thread_counts) {
-                double time = measure_execution_time(interpolator, interp_points, threads);
-                
-                if (threads == 1) {
-                    single_thread_time = time;
-                }
+            ScalingSeries scaling = ScalingAnalysis::measure(
+                "Итерация " + std::to_string(i+1), thread_counts, benchmark, [&](int threads) {
+                    omp_set_num_threads(threads);
+                    interpolator.interpolate_into(interp_points, interp_results);
+                });
+            for (const ScalingPoint& point : scaling.points) {
+                speedups.push_back(point.speedup);
                 
-                double speedup = single_thread_time / time;
-                speedups.push_back(speedup);
-                
-                std::cout << "Потоки: " << threads << ", время: " << time 
-                        << " мс, ускорение: " << speedup << std::endl;
+                std::cout << "Потоки: " << point.threads << ", время (медиана): " << point.time.median_ms
+                        << " мс, ускорение: " << point.speedup << " [" << point.speedup_low << ", "
+                        << point.speedup_high << "], эффективность: " << point.efficiency << std::endl;
             }
+            std::cout << "Последовательная доля по закону Амдала: " << scaling.serial_fraction << std::endl;
+            all_scaling.push_back(scaling);
+            
+            InterpolationTimings timings = interpolator.get_timings();
+            std::cout << "Подготовка: " << timings.setup_ms() << " мс (сортировка " << timings.sort_ms
+                    << " мс, коэффициенты " << timings.coefficients_ms << " мс), вычисление: "
+                    << timings.evaluation_ms << " мс на " << timings.evaluated_points << " точек" << std::endl;
+            
+            TuningConfig tuned = tuner.choose(num_nodes, num_interp_points);
+            interpolator.set_autotuner(&tuner);
+            double tuned_time = measure_execution_time(interpolator, interp_points, interp_results, omp_get_num_procs());
+            interpolator.set_autotuner(nullptr);
+            std::cout << "Автонастройка: ядро " << EvaluationKernels::name(tuned.kernel)
+                    << ", потоки " << tuned.schedule.thread_count << ", порция " << tuned.schedule.chunk_size
+                    << ", время: " << tuned_time << " мс" << std::endl;
+            
+            PerfProfiler profiler;
+            interpolator.set_perf_profiler(&profiler);
+            interpolator.set_data(x_nodes, y_nodes);
+            interpolator.interpolate_into(interp_points, interp_results);
+            interpolator.set_perf_profiler(nullptr);
+            std::cout << profiler.summary();
+            
+            BatchTelemetry telemetry;
+            omp_set_num_threads(thread_counts.back());
+            interpolator.interpolate_multiple(interp_points, telemetry);
+            std::cout << "Телеметрия (" << telemetry.threads.size() << " потоков): дисбаланс "
+                    << telemetry.imbalance() << ", пакет " << telemetry.wall_ms << " мс" << std::endl;
             
             std::string speedup_plot = "speedup_test_" + std::to_string(i+1) + ".png";
-            try {
-                GnuplotVisualizer::plot_speedup(thread_counts, speedups, speedup_plot);
-                std::cout << "График сохранен: " << speedup_plot << std::endl;
-            } catch (const std::exception& e) {
-                std::cerr << "Предупреждение: не удалось создать график " << speedup_plot 
-                        << ": " << e.what() << std::endl;
-                std::cerr << "Продолжаем выполнение без графика..." << std::endl;
+            std::string utilization_plot = "speedup_utilization_test_" + std::to_string(i+1) + ".png";
+            std::string interpolation_plot = "interpolation_test_" + std::to_string(i+1) + ".png";
+            if (plots) {
+                try {
+                    GnuplotVisualizer::plot_speedup(*plots, thread_counts, speedups, speedup_plot);
+                    GnuplotVisualizer::plot_speedup_with_utilization(*plots, thread_counts, speedups,
+                                                                     telemetry, utilization_plot);
+                    GnuplotVisualizer::plot_interpolation(*plots, x_nodes, y_nodes, interp_points,
+                                                          interp_results, interpolation_plot);
+                    std::cout << "Графики отправлены в gnuplot: " << speedup_plot << ", "
+                            << utilization_plot << ", " << interpolation_plot << std::endl;
+                } catch (const std::exception& e) {
+                    std::cerr << "Предупреждение: не удалось создать график " << speedup_plot 
+                            << ": " << e.what() << std::endl;
+                    std::cerr << "Продолжаем выполнение без графика..." << std::endl;
+                }
             }
             
             std::cout << "\nПроверка интерполяции в 5 случайных точках из исходных узлов:" << std::endl;
@@ -163,6 +308,15 @@ int main() {
             return 1;
         }
     }
+    if (plots) {
+        try {
+            GnuplotVisualizer::plot_scaling(*plots, all_scaling, "scaling_analysis.png");
+            plots->close();
+            std::cout << "Графики сохранены" << std::endl;
+        } catch (const std::exception& e) {
+            std::cerr << "Предупреждение: не удалось создать графики: " << e.what() << std::endl;
+        }
+    }
     std::cout << "\nТестирование завершено." << std::endl;
     return 0;
 }
\ No newline at end of file
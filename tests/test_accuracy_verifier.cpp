@@ -0,0 +1,203 @@
+/**
+ * @file test_accuracy_verifier.cpp
+ * @brief Модульные тесты для проверки точности по эталонным функциям
+ */
+
+#include "test_accuracy_verifier.h"
+#include "test_utils.h"
+#include "../src/core/accuracy_verifier.h"
+#include <cmath>
+#include <omp.h>
+#include <stdexcept>
+
+/**
+ * @brief Тест: Полином степени 5 восстанавливается всеми ядрами
+ * AAA: Arrange - полином по 8 узлам, Act - проверяем режимы, Assert - ошибки на уровне округления
+ */
+void test_verifier_polynomial_exact() {
+    test_group("Полином степени 5 восстанавливается всеми ядрами");
+
+    // Arrange
+    ReferenceProblem problem;
+    problem.function = ReferenceFunction::Polynomial;
+    problem.start = -2.0;
+    problem.end = 2.0;
+    problem.nodes = 8;
+    std::vector<VerificationMode> modes = AccuracyVerifier::default_modes();
+
+    // Act
+    std::vector<AccuracyReport> reports = AccuracyVerifier::verify(problem, modes, 100001);
+
+    // Assert
+    assert_true(reports.size() == modes.size(), "Отчет на каждый режим");
+    assert_true(reports[0].mode == modes[0].name && reports[0].points == 100001, "Порядок и число точек");
+    assert_true(reports[0].baseline_deviation == 0.0, "База не отличается от себя");
+    bool exact = true;
+    for (size_t m = 0; m < reports.size(); m++) {
+        if (modes[m].method == InterpolationMethod::Newton) {
+            exact = exact && reports[m].relative_error < 1e-12 &&
+                    AccuracyVerifier::matches_baseline(reports[m], reports[0]);
+        }
+    }
+    assert_true(exact, "Все пути формы Ньютона точны и совпадают с базой");
+}
+
+/**
+ * @brief Тест: Узлы Чебышева подавляют эффект Рунге
+ * AAA: Arrange - функция Рунге на 21 узле, Act - проверяем равномерные и чебышевские узлы, Assert - сравниваем ошибки
+ */
+void test_verifier_runge_nodes() {
+    test_group("Узлы Чебышева подавляют эффект Рунге");
+
+    // Arrange
+    ReferenceProblem uniform;
+    uniform.function = ReferenceFunction::Runge;
+    uniform.start = -1.0;
+    uniform.end = 1.0;
+    uniform.nodes = 21;
+    ReferenceProblem chebyshev = uniform;
+    chebyshev.chebyshev_nodes = true;
+    std::vector<VerificationMode> modes = {{"Ньютон", InterpolationMethod::Newton,
+                                            EvaluationKernel::Scalar, VerificationPath::Points}};
+
+    // Act
+    AccuracyReport uniform_report = AccuracyVerifier::verify(uniform, modes, 20001)[0];
+    AccuracyReport chebyshev_report = AccuracyVerifier::verify(chebyshev, modes, 20001)[0];
+
+    // Assert
+    assert_true(uniform_report.max_error > 1.0, "Равномерные узлы: ошибка у краев больше 1");
+    assert_true(chebyshev_report.max_error < 0.1, "Узлы Чебышева: ошибка мала");
+    assert_true(chebyshev_report.rms_error <= chebyshev_report.max_error, "СКО не больше максимума");
+}
+
+/**
+ * @brief Тест: Проверочная сетка не содержит концов отрезка
+ * AAA: Arrange - exp по 2 узлам, Act - проверяем точки и сетку на 2 точках, Assert - ошибки в серединах половин
+ */
+void test_verifier_grid_skips_nodes() {
+    test_group("Проверочная сетка сдвинута на полшага от узлов");
+
+    // Arrange
+    ReferenceProblem problem;
+    problem.function = ReferenceFunction::Exponential;
+    problem.start = 0.0;
+    problem.end = 1.0;
+    problem.nodes = 2;
+    std::vector<VerificationMode> modes = {
+        {"Ньютон", InterpolationMethod::Newton, EvaluationKernel::Scalar, VerificationPath::Points},
+        {"Сетка", InterpolationMethod::Newton, EvaluationKernel::Scalar, VerificationPath::Grid}};
+    const double chord = std::exp(1.0) - 1.0;
+    const double expected_max = std::abs(std::exp(0.75) - (1.0 + chord * 0.75));
+    const double expected_low = std::abs(std::exp(0.25) - (1.0 + chord * 0.25));
+
+    // Act
+    std::vector<AccuracyReport> reports = AccuracyVerifier::verify(problem, modes, 2);
+
+    // Assert
+    assert_double_equal(reports[0].max_error, expected_max, 1e-12, "Максимум в точке 3/4, а не в узле");
+    assert_double_equal(reports[0].rms_error,
+                        std::sqrt(0.5 * (expected_max * expected_max + expected_low * expected_low)), 1e-12,
+                        "СКО по точкам 1/4 и 3/4 без нулевых ошибок в узлах");
+    assert_double_equal(reports[1].max_error, reports[0].max_error, 1e-12, "Сетка вычисляется в тех же точках");
+}
+
+/**
+ * @brief Тест: Редукции не зависят от числа потоков
+ * AAA: Arrange - sin с шумом, Act - проверяем в 1 и 4 потоках, Assert - сравниваем ошибки
+ */
+void test_verifier_thread_independent() {
+    test_group("Редукции ошибок не зависят от числа потоков");
+
+    // Arrange
+    ReferenceProblem problem = AccuracyVerifier::standard_problems()[4];
+    std::vector<VerificationMode> modes = {{"Ньютон", InterpolationMethod::Newton,
+                                            EvaluationKernel::Scalar, VerificationPath::Points}};
+    int saved_threads = omp_get_max_threads();
+
+    // Act
+    omp_set_num_threads(1);
+    AccuracyReport serial = AccuracyVerifier::verify(problem, modes, 50001)[0];
+    omp_set_num_threads(4);
+    AccuracyReport parallel = AccuracyVerifier::verify(problem, modes, 50001)[0];
+    omp_set_num_threads(saved_threads);
+
+    // Assert
+    assert_true(parallel.max_error == serial.max_error, "Максимум совпадает точно");
+    assert_double_equal(parallel.rms_error, serial.rms_error, 1e-12 * serial.rms_error, "СКО совпадает");
+    assert_true(serial.max_error > 0.0, "Шум в узлах дает ненулевую ошибку");
+}
+
+/**
+ * @brief Тест: Узлы эталонной задачи
+ * AAA: Arrange - задачи с узлами Чебышева и шумом, Act - строим узлы, Assert - проверяем концы и шум
+ */
+void test_verifier_make_nodes() {
+    test_group("Узлы эталонной задачи");
+
+    // Arrange
+    ReferenceProblem problem;
+    problem.function = ReferenceFunction::Exponential;
+    problem.start = -1.0;
+    problem.end = 3.0;
+    problem.nodes = 9;
+    problem.chebyshev_nodes = true;
+    ReferenceProblem noisy = problem;
+    noisy.noise = 0.5;
+    std::vector<double> x, y, noisy_x, noisy_y, repeat_x, repeat_y;
+
+    // Act
+    AccuracyVerifier::make_nodes(problem, x, y);
+    AccuracyVerifier::make_nodes(noisy, noisy_x, noisy_y);
+    AccuracyVerifier::make_nodes(noisy, repeat_x, repeat_y);
+
+    // Assert
+    assert_true(x.front() == -1.0 && x.back() == 3.0, "Концы отрезка входят в узлы Чебышева");
+    assert_double_equal(x[4], 1.0, 1e-12, "Средний узел в центре отрезка");
+    assert_double_equal(y[8], std::exp(3.0), 1e-12, "Значения без шума совпадают с функцией");
+    assert_true(noisy_y[8] != y[8], "Шум изменяет значения");
+    assert_vector_equal(noisy_y, repeat_y, 1e-15, "Шум воспроизводим при том же зерне");
+}
+
+/**
+ * @brief Тест: Сравнение с базой и некорректные входные данные
+ * AAA: Arrange - готовим отчеты и задачи, Act & Assert - проверяем порог и исключения
+ */
+void test_verifier_tolerance_and_errors() {
+    test_group("Порог сравнения с базой и некорректные данные");
+
+    // Arrange
+    AccuracyReport baseline;
+    baseline.relative_error = 1e-3;
+    AccuracyReport close;
+    close.baseline_deviation = 5e-7;
+    AccuracyReport far;
+    far.baseline_deviation = 5e-6;
+    AccuracyReport exact_baseline;
+    ReferenceProblem problem;
+    ReferenceProblem empty = problem;
+    empty.end = empty.start;
+    std::vector<VerificationMode> modes = AccuracyVerifier::default_modes();
+
+    // Act & Assert
+    assert_true(AccuracyVerifier::matches_baseline(close, baseline), "Отличие меньше 0.1% ошибки базы допустимо");
+    assert_true(!AccuracyVerifier::matches_baseline(far, baseline), "Отличие больше 0.1% ошибки базы недопустимо");
+    assert_true(!AccuracyVerifier::matches_baseline(close, exact_baseline), "Для точной базы действует порог 1e-9");
+    assert_true(modes[0].kernel == EvaluationKernel::Scalar, "Базовый режим - скалярное ядро");
+    assert_throws<std::invalid_argument>([&]() { AccuracyVerifier::verify(problem, {}, 100); }, "Нет режимов");
+    assert_throws<std::invalid_argument>([&]() { AccuracyVerifier::verify(problem, modes, 1); }, "Одна точка");
+    assert_throws<std::invalid_argument>([&]() { AccuracyVerifier::verify(empty, modes, 100); }, "Пустой отрезок");
+}
+
+/**
+ * @brief Запуск всех тестов для AccuracyVerifier
+ */
+void run_accuracy_verifier_tests() {
+    std::cout << "\n=== Тесты AccuracyVerifier ===\n";
+
+    test_verifier_polynomial_exact();
+    test_verifier_runge_nodes();
+    test_verifier_grid_skips_nodes();
+    test_verifier_thread_independent();
+    test_verifier_make_nodes();
+    test_verifier_tolerance_and_errors();
+}
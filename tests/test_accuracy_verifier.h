@@ -0,0 +1,14 @@
+/**
+ * @file test_accuracy_verifier.h
+ * @brief Объявления тестов для AccuracyVerifier
+ */
+
+#ifndef TEST_ACCURACY_VERIFIER_H
+#define TEST_ACCURACY_VERIFIER_H
+
+/**
+ * @brief Запуск всех тестов для AccuracyVerifier
+ */
+void run_accuracy_verifier_tests();
+
+#endif // TEST_ACCURACY_VERIFIER_H
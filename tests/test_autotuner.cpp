@@ -0,0 +1,195 @@
+/**
+ * @file test_autotuner.cpp
+ * @brief Модульные тесты для автонастройки пакетного вычисления
+ */
+
+#include "test_autotuner.h"
+#include "test_utils.h"
+#include "../src/core/autotuner.h"
+#include "../src/core/newton_interpolator.h"
+#include <cmath>
+#include <cstdio>
+#include <fstream>
+#include <omp.h>
+#include <stdexcept>
+
+/**
+ * @brief Тест: Модель стоимости выбирает последовательный режим на малых пакетах
+ * AAA: Arrange - записываем профиль с двумя моделями, Act - загружаем и выбираем, Assert - проверяем порог
+ */
+void test_autotuner_cost_model_cutoff() {
+    test_group("Модель стоимости и порог параллельного режима");
+    
+    // Arrange - параллельный вариант дороже на 0.1 мс, но вчетверо быстрее на шаг
+    const std::string path = "test_autotune_profile.txt";
+    {
+        std::ofstream file(path);
+        file << "# newton-autotune 1\n";
+        file << "scalar dynamic 1 1 0.0 1.0\n";
+        file << "scalar static 4 8 0.1 0.25\n";
+    }
+    Autotuner tuner;
+    
+    // Act
+    tuner.load(path);
+    TuningConfig small = tuner.choose(25, 1000);
+    TuningConfig large = tuner.choose(25, 100000);
+    size_t cutoff = tuner.get_parallel_cutoff(25);
+    std::remove(path.c_str());
+    
+    // Assert - равенство стоимостей при 25 * m * 0.75e-6 = 0.1, m ~ 5333
+    assert_true(tuner.get_models().size() == 2, "Загружены обе модели");
+    assert_true(small.schedule.thread_count == 1, "Малый пакет вычисляется последовательно");
+    assert_true(large.schedule.thread_count == 8 && large.schedule.policy == SchedulePolicy::Static &&
+                large.schedule.chunk_size == 4, "Большой пакет вычисляется параллельно");
+    assert_true(cutoff == 8192, "Порог параллельного режима - первая степень двойки после 5333");
+}
+
+/**
+ * @brief Тест: Измерение, сохранение и загрузка профиля
+ * AAA: Arrange - разрешаем 2 потока, Act - измеряем и сохраняем профиль, Assert - сравниваем выбор
+ */
+void test_autotuner_tune_save_load() {
+    test_group("Измерение, сохранение и загрузка профиля");
+    
+    // Arrange
+    const std::string path = "test_autotune_roundtrip.txt";
+    int saved_threads = omp_get_max_threads();
+    omp_set_num_threads(2);
+    Autotuner tuner(2);
+    
+    // Act
+    tuner.tune(25, {256, 2048});
+    omp_set_num_threads(saved_threads);
+    tuner.save(path);
+    Autotuner loaded;
+    loaded.load(path);
+    std::remove(path.c_str());
+    
+    // Assert - последовательный вариант и 3 порции для 2 потоков
+    assert_true(tuner.is_tuned() && tuner.get_models().size() == 4, "Измерены 4 конфигурации");
+    assert_true(tuner.get_models()[0].config.schedule.thread_count == 1, "Первая конфигурация последовательная");
+    assert_true(EvaluationKernels::is_supported(tuner.get_models()[0].config.kernel) &&
+                tuner.get_models()[0].config.kernel != EvaluationKernel::Auto,
+                "Выбрано конкретное поддерживаемое ядро");
+    TuningConfig original = tuner.choose(25, 10000);
+    TuningConfig restored = loaded.choose(25, 10000);
+    assert_true(original.kernel == restored.kernel &&
+                original.schedule.thread_count == restored.schedule.thread_count &&
+                original.schedule.chunk_size == restored.schedule.chunk_size,
+                "Загруженный профиль дает тот же выбор");
+}
+
+/**
+ * @brief Тест: Интерполятор с профилем дает те же значения
+ * AAA: Arrange - готовим интерполятор и профиль, Act - вычисляем с профилем, Assert - сравниваем
+ */
+void test_autotuner_interpolator_results() {
+    test_group("Интерполятор с профилем автонастройки");
+    
+    // Arrange
+    std::vector<double> x;
+    std::vector<double> y;
+    for (int i = 0; i < 25; i++) {
+        x.push_back(0.4 * i);
+        y.push_back(std::sin(0.4 * i));
+    }
+    NewtonInterpolator interpolator(x, y);
+    std::vector<double> points = NewtonInterpolator::generate_points(0.0, 9.6, 3000);
+    std::vector<double> expected = interpolator.interpolate_multiple(points);
+    Autotuner tuner(1);
+    tuner.tune(25, {128, 1024});
+    
+    // Act
+    interpolator.set_autotuner(&tuner);
+    std::vector<double> results = interpolator.interpolate_multiple(points);
+    
+    // Assert
+    assert_vector_equal(results, expected, 1e-9, "Значения совпадают с вычислением без профиля");
+}
+
+/**
+ * @brief Тест: Обработка некорректного профиля
+ * AAA: Arrange - готовим файлы, Act - загружаем и измеряем, Assert - ожидаем исключения
+ */
+void test_autotuner_invalid_input() {
+    test_group("Обработка некорректного профиля");
+    
+    // Arrange
+    const std::string path = "test_autotune_broken.txt";
+    {
+        std::ofstream file(path);
+        file << "# newton-autotune 1\nscalar dynamic one 1 0.0 1.0\n";
+    }
+    Autotuner tuner;
+    
+    // Act & Assert
+    assert_throws<std::runtime_error>(
+        [&]() { tuner.load("missing_autotune_profile.txt"); },
+        "Отсутствующий файл вызывает исключение"
+    );
+    assert_throws<std::runtime_error>(
+        [&]() { tuner.load(path); },
+        "Поврежденная строка вызывает исключение"
+    );
+    assert_throws<std::invalid_argument>(
+        [&]() { tuner.tune(25, {1000}); },
+        "Один размер пакета вызывает исключение"
+    );
+    std::remove(path.c_str());
+    assert_true(!tuner.is_tuned() && tuner.choose(25, 100).kernel == EvaluationKernel::Auto,
+                "Без профиля выбирается конфигурация по умолчанию");
+}
+
+/**
+ * @brief Тест: Ядра профиля разрешаются при загрузке
+ * AAA: Arrange - профиль с ядром auto и, если есть, неподдерживаемым ядром, Act - загружаем и вычисляем,
+ *      Assert - в профиле только конкретные ядра, interpolate_into возвращает Ok
+ */
+void test_autotuner_profile_resolves_kernels() {
+    test_group("Ядра профиля разрешаются при загрузке");
+    
+    // Arrange
+    const std::string path = "test_autotune_kernels.txt";
+    {
+        std::ofstream file(path);
+        file << "# newton-autotune 1\n";
+        file << "auto " << ParallelScheduler::name(SchedulePolicy::Static) << " 64 1 0.01 1.0\n";
+        for (EvaluationKernel kernel : {EvaluationKernel::SSE2, EvaluationKernel::AVX2, EvaluationKernel::AVX512}) {
+            if (!EvaluationKernels::is_supported(kernel)) {
+                file << EvaluationKernels::name(kernel) << " " << ParallelScheduler::name(SchedulePolicy::Static)
+                     << " 64 1 0.0 0.5\n";
+            }
+        }
+    }
+    NewtonInterpolator interpolator({0.0, 1.0, 2.0}, {1.0, 3.0, 2.0});
+    std::vector<double> points = {0.5, 1.5};
+    std::vector<double> results(points.size());
+    Autotuner tuner;
+    
+    // Act
+    tuner.load(path);
+    std::remove(path.c_str());
+    interpolator.set_autotuner(&tuner);
+    InterpolationStatus status = interpolator.interpolate_into(points, results);
+    
+    // Assert
+    assert_true(tuner.get_models().size() == 1 &&
+                tuner.get_models()[0].config.kernel == EvaluationKernels::detect_best(),
+                "auto заменено лучшим ядром, неподдерживаемые ядра пропущены");
+    assert_true(status == InterpolationStatus::Ok, "interpolate_into с профилем возвращает Ok");
+    assert_double_equal(results[1], interpolator.interpolate(1.5), 1e-12, "Значения вычислены");
+}
+
+/**
+ * @brief Запуск всех тестов для Autotuner
+ */
+void run_autotuner_tests() {
+    std::cout << "\n=== Тесты Autotuner ===\n";
+    
+    test_autotuner_cost_model_cutoff();
+    test_autotuner_tune_save_load();
+    test_autotuner_interpolator_results();
+    test_autotuner_invalid_input();
+    test_autotuner_profile_resolves_kernels();
+}
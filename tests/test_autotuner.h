@@ -0,0 +1,14 @@
+/**
+ * @file test_autotuner.h
+ * @brief Объявления тестов для Autotuner
+ */
+
+#ifndef TEST_AUTOTUNER_H
+#define TEST_AUTOTUNER_H
+
+/**
+ * @brief Запуск всех тестов для Autotuner
+ */
+void run_autotuner_tests();
+
+#endif // TEST_AUTOTUNER_H
@@ -0,0 +1,192 @@
+/**
+ * @file test_barycentric_engine.cpp
+ * @brief Модульные тесты для класса BarycentricEngine и барицентрического режима интерполятора
+ */
+
+#include "test_barycentric_engine.h"
+#include "test_utils.h"
+#include "../src/core/barycentric_engine.h"
+#include "../src/core/newton_interpolator.h"
+#include <cmath>
+#include <limits>
+#include <stdexcept>
+
+/**
+ * @brief Тест: Барицентрическая форма совпадает с формой Ньютона
+ * AAA: Arrange - готовим два интерполятора по одним узлам, Act - вычисляем, Assert - сравниваем
+ */
+void test_barycentric_matches_newton() {
+    test_group("Барицентрическая форма совпадает с формой Ньютона");
+    
+    // Arrange
+    std::vector<double> x = {0.0, 0.5, 1.2, 2.0, 2.5, 3.7};
+    std::vector<double> y = {1.0, -1.0, 0.5, 2.0, 3.0, -0.5};
+    NewtonInterpolator newton(x, y);
+    NewtonInterpolator barycentric(x, y, InterpolationMethod::Barycentric);
+    std::vector<double> points = NewtonInterpolator::generate_points(-0.5, 4.0, 31);
+    
+    // Act
+    std::vector<double> expected = newton.interpolate_multiple(points);
+    std::vector<double> actual = barycentric.interpolate_multiple(points);
+    
+    // Assert
+    assert_true(barycentric.get_method() == InterpolationMethod::Barycentric, 
+                "Способ вычисления задается при конструировании");
+    assert_vector_equal(actual, expected, 1e-9, "Значения совпадают во всех точках");
+}
+
+/**
+ * @brief Тест: Точное попадание в узел
+ * AAA: Arrange - готовим интерполятор, Act - вычисляем в узлах, Assert - проверяем исходные значения
+ */
+void test_barycentric_at_nodes() {
+    test_group("Барицентрическая интерполяция в узлах");
+    
+    // Arrange
+    std::vector<double> x = {0.0, 1.0, 2.0, 3.0};
+    std::vector<double> y = {2.0, 0.0, 5.0, -1.0};
+    NewtonInterpolator interpolator(x, y, InterpolationMethod::Barycentric);
+    
+    // Act
+    std::vector<double> results = interpolator.interpolate_multiple(x);
+    
+    // Assert
+    assert_vector_equal(results, y, 1e-12, "В узлах возвращаются исходные значения");
+}
+
+/**
+ * @brief Тест: NaN и бесконечность в точке не подменяются значением в узле
+ * AAA: Arrange - готовим веса, Act - вычисляем в NaN, бесконечности и узле, Assert - проверяем результат
+ */
+void test_barycentric_non_finite_point() {
+    test_group("NaN в точке не подменяется значением в узле");
+    
+    // Arrange
+    std::vector<double> x = {0.0, 1.0, 2.0, 3.0};
+    std::vector<double> y = {2.0, 0.0, 5.0, -1.0};
+    BarycentricEngine engine;
+    engine.compute(x.data(), y.data(), x.size());
+    
+    // Act
+    double at_nan = engine.evaluate(std::nan(""));
+    double at_infinity = engine.evaluate(std::numeric_limits<double>::infinity());
+    double at_node = engine.evaluate(2.0);
+    
+    // Assert
+    assert_true(std::isnan(at_nan), "NaN в точке дает NaN");
+    assert_true(!std::isfinite(at_infinity), "Бесконечность в точке не дает значение узла");
+    assert_true(at_node == 5.0, "В узле возвращается исходное значение");
+}
+
+/**
+ * @brief Тест: Устойчивость при высокой степени (функция Рунге на узлах Чебышева)
+ * AAA: Arrange - готовим 121 узел Чебышева, Act - вычисляем вне узлов, Assert - проверяем максимальную ошибку
+ */
+void test_barycentric_high_degree() {
+    test_group("Барицентрическая интерполяция высокой степени");
+    
+    // Arrange
+    const int n = 121;
+    std::vector<double> x;
+    std::vector<double> y;
+    for (int i = 0; i < n; i++) {
+        double xi = std::cos(M_PI * (2.0 * i + 1.0) / (2.0 * n));
+        x.push_back(xi);
+        y.push_back(1.0 / (1.0 + 25.0 * xi * xi));
+    }
+    NewtonInterpolator interpolator(x, y, InterpolationMethod::Barycentric);
+    std::vector<double> points = NewtonInterpolator::generate_points(-1.0, 1.0, 1001);
+    
+    // Act
+    std::vector<double> results = interpolator.interpolate_multiple(points);
+    
+    // Assert
+    double max_error = 0.0;
+    for (size_t i = 0; i < points.size(); i++) {
+        double expected = 1.0 / (1.0 + 25.0 * points[i] * points[i]);
+        max_error = std::max(max_error, std::abs(results[i] - expected));
+    }
+    assert_true(max_error < 1e-6, 
+                "Максимальная ошибка для функции Рунге меньше 1e-6");
+}
+
+/**
+ * @brief Тест: Инкрементальное добавление и скользящее окно в барицентрическом режиме
+ * AAA: Arrange - задаем окно, Act - подаем поток узлов, Assert - сравниваем с полным пересчетом
+ */
+void test_barycentric_streaming() {
+    test_group("Скользящее окно в барицентрическом режиме");
+    
+    // Arrange
+    NewtonInterpolator streaming(InterpolationMethod::Barycentric);
+    streaming.set_window_size(6);
+    std::vector<double> x;
+    std::vector<double> y;
+    
+    // Act
+    for (int i = 0; i < 15; i++) {
+        x.push_back(0.4 * i);
+        y.push_back(std::cos(0.4 * i));
+        streaming.add_node(x.back(), y.back());
+    }
+    
+    // Assert
+    NewtonInterpolator reference(std::vector<double>(x.end() - 6, x.end()),
+                                 std::vector<double>(y.end() - 6, y.end()),
+                                 InterpolationMethod::Barycentric);
+    std::vector<double> points = NewtonInterpolator::generate_points(x[x.size() - 6], x.back(), 11);
+    assert_vector_equal(streaming.interpolate_multiple(points), reference.interpolate_multiple(points), 1e-9,
+                        "Окно совпадает с интерполятором по последним узлам");
+}
+
+/**
+ * @brief Тест: Множитель весов следует за размахом при добавлении узлов
+ * AAA: Arrange - 300 узлов Чебышева на [0, 399], Act - добавляем по одному в пустой интерполятор,
+ *      Assert - результаты конечны и совпадают с функцией и с set_data
+ */
+void test_barycentric_append_rescales() {
+    test_group("Добавление сотен узлов с пересчетом множителя весов");
+    
+    // Arrange - с множителем C = 1 веса таких узлов переполнялись бы уже к сотому узлу
+    const size_t n = 300;
+    std::vector<double> x;
+    std::vector<double> y;
+    for (size_t k = 0; k < n; k++) {
+        x.push_back(199.5 - 199.5 * std::cos(M_PI * static_cast<double>(k) / (n - 1)));
+        y.push_back(std::sin(x.back() / 8.0));
+    }
+    NewtonInterpolator streaming(InterpolationMethod::Barycentric);
+    NewtonInterpolator reference(x, y, InterpolationMethod::Barycentric);
+    std::vector<double> points = {0.25, 10.5, 199.5, 398.75};
+    
+    // Act
+    for (size_t k = 0; k < n; k++) {
+        streaming.add_node(x[k], y[k]);
+    }
+    std::vector<double> results = streaming.interpolate_multiple(points);
+    
+    // Assert
+    bool finite = true;
+    double max_error = 0.0;
+    for (size_t i = 0; i < points.size(); i++) {
+        finite = finite && std::isfinite(results[i]);
+        max_error = std::max(max_error, std::abs(results[i] - std::sin(points[i] / 8.0)));
+    }
+    assert_true(finite, "Результаты конечны");
+    assert_true(max_error < 1e-10, "Совпадает с функцией в пределах 1e-10");
+    assert_vector_equal(results, reference.interpolate_multiple(points), 1e-10, "Совпадает с set_data");
+}
+
+/**
+ * @brief Запуск всех тестов для BarycentricEngine
+ */
+void run_barycentric_engine_tests() {
+    std::cout << "\n=== Тесты BarycentricEngine ===\n";
+    
+    test_barycentric_matches_newton();
+    test_barycentric_at_nodes();
+    test_barycentric_non_finite_point();
+    test_barycentric_high_degree();
+    test_barycentric_streaming();
+    test_barycentric_append_rescales();
+}
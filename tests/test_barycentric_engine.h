@@ -0,0 +1,14 @@
+/**
+ * @file test_barycentric_engine.h
+ * @brief Объявления тестов для BarycentricEngine
+ */
+
+#ifndef TEST_BARYCENTRIC_ENGINE_H
+#define TEST_BARYCENTRIC_ENGINE_H
+
+/**
+ * @brief Запуск всех тестов для BarycentricEngine
+ */
+void run_barycentric_engine_tests();
+
+#endif // TEST_BARYCENTRIC_ENGINE_H
@@ -0,0 +1,183 @@
+/**
+ * @file test_basic_newton_interpolator.cpp
+ * @brief Модульные тесты для интерполятора с выбираемой точностью
+ */
+
+#include "test_basic_newton_interpolator.h"
+#include "test_utils.h"
+#include "../src/core/basic_newton_interpolator.h"
+#include "../src/core/newton_interpolator.h"
+#include <cmath>
+#include <stdexcept>
+#include <type_traits>
+
+/**
+ * @brief Тест: Все точности совпадают с NewtonInterpolator для таблицы малой степени
+ * AAA: Arrange - готовим 6 узлов sin(x), Act - вычисляем в четырех вариантах, Assert - сравниваем с double
+ */
+void test_precision_variants_match_double() {
+    test_group("Варианты точности совпадают с double");
+    
+    // Arrange
+    std::vector<double> x = {0.0, 0.5, 1.0, 1.5, 2.0, 2.5};
+    std::vector<double> y;
+    for (double xi : x) {
+        y.push_back(std::sin(xi));
+    }
+    std::vector<double> points = NewtonInterpolator::generate_points(0.0, 2.5, 131);
+    std::vector<double> expected = NewtonInterpolator(x, y).interpolate_multiple(points);
+    std::vector<float> xf(x.begin(), x.end());
+    std::vector<float> yf(y.begin(), y.end());
+    std::vector<float> pf(points.begin(), points.end());
+    std::vector<long double> xl(x.begin(), x.end());
+    std::vector<long double> yl(y.begin(), y.end());
+    std::vector<long double> pl(points.begin(), points.end());
+    
+    // Act
+    std::vector<double> as_double = BasicNewtonInterpolator<double>(x, y).interpolate_multiple(points);
+    std::vector<float> as_float = NewtonInterpolatorF(xf, yf).interpolate_multiple(pf);
+    std::vector<long double> as_long = NewtonInterpolatorLD(xl, yl).interpolate_multiple(pl);
+    std::vector<double> as_mixed = MixedNewtonInterpolator(x, y).interpolate_multiple(points);
+    
+    // Assert
+    assert_vector_equal(as_double, expected, 1e-12, "double совпадает с NewtonInterpolator");
+    assert_vector_equal(std::vector<double>(as_float.begin(), as_float.end()), expected, 1e-5,
+                        "float совпадает в пределах точности float");
+    assert_vector_equal(std::vector<double>(as_long.begin(), as_long.end()), expected, 1e-12,
+                        "long double совпадает с double");
+    assert_vector_equal(as_mixed, expected, 1e-5, "Смешанный режим совпадает в пределах округления таблицы");
+}
+
+/**
+ * @brief Тест: Смешанный режим проходит через хранимые узлы
+ * AAA: Arrange - готовим таблицу, Act - вычисляем в округленных до float узлах, Assert - проверяем y
+ */
+void test_mixed_precision_passes_through_nodes() {
+    test_group("Смешанный режим проходит через узлы");
+    
+    // Arrange
+    std::vector<double> x = {0.1, 0.7, 1.3, 2.9};
+    std::vector<double> y = {1.0, -2.0, 0.5, 3.0};
+    MixedNewtonInterpolator interpolator(x, y);
+    
+    // Act
+    double at_node = interpolator.interpolate(static_cast<float>(0.7));
+    
+    // Assert - отклонение определяется округлением коэффициентов до float
+    assert_double_equal(at_node, -2.0, 1e-5, "Значение в узле 0.7");
+    assert_true(interpolator.get_node_count() == 4, "Количество узлов равно 4");
+}
+
+/**
+ * @brief Тест: Расширенная точность на таблице высокой степени
+ * AAA: Arrange - готовим 25 узлов, Act - вычисляем в long double, Assert - сверяем с double
+ */
+void test_long_double_high_degree() {
+    test_group("long double на таблице из 25 узлов");
+    
+    // Arrange
+    std::vector<long double> x;
+    std::vector<long double> y;
+    std::vector<double> xd;
+    std::vector<double> yd;
+    for (int i = 0; i < 25; i++) {
+        xd.push_back(0.2 * i);
+        yd.push_back(std::cos(0.2 * i));
+        x.push_back(xd.back());
+        y.push_back(yd.back());
+    }
+    NewtonInterpolatorLD interpolator(x, y);
+    NewtonInterpolator reference(xd, yd);
+    
+    // Act
+    long double value = interpolator.interpolate(2.05L);
+    
+    // Assert
+    assert_double_equal(static_cast<double>(value), reference.interpolate(2.05), 1e-9,
+                        "long double совпадает с double в середине таблицы");
+    assert_double_equal(static_cast<double>(value), std::cos(2.05), 1e-9, "Значение близко к cos(2.05)");
+}
+
+/**
+ * @brief Тест: Обработка некорректных данных
+ * AAA: Arrange - готовим ошибочные наборы, Act - устанавливаем данные, Assert - ожидаем исключения
+ */
+void test_precision_invalid_input() {
+    test_group("Обработка некорректных данных");
+    
+    // Arrange
+    NewtonInterpolatorF interpolator;
+    std::vector<float> x = {1.0f, 1.0f};
+    std::vector<float> y = {0.0f, 1.0f};
+    
+    // Act & Assert
+    assert_throws<std::runtime_error>(
+        [&]() { interpolator.set_data(x, y); },
+        "Повторяющийся узел вызывает исключение"
+    );
+    assert_throws<std::runtime_error>(
+        [&]() { interpolator.interpolate(0.5f); },
+        "Интерполяция без данных вызывает исключение"
+    );
+    assert_throws<std::invalid_argument>(
+        [&]() { interpolator.set_data({1.0f}, {1.0f}); },
+        "Одна точка вызывает исключение"
+    );
+}
+
+/**
+ * @brief Тест: NewtonInterpolator - реализация BasicNewtonInterpolator<double>
+ * AAA: Arrange - строим таблицу, Act - добавляем узел и сужаем окно, Assert - сверяем узлы и коэффициенты базового класса
+ */
+void test_newton_interpolator_shares_double_storage() {
+    test_group("NewtonInterpolator хранит узлы и коэффициенты в BasicNewtonInterpolator<double>");
+    
+    // Arrange
+    std::vector<double> x = {0.0, 0.5, 1.0, 1.5, 2.0, 2.5};
+    std::vector<double> y;
+    for (double xi : x) {
+        y.push_back(std::sin(xi));
+    }
+    NewtonInterpolator newton(x, y);
+    const BasicNewtonInterpolator<double>& base = newton;
+    
+    // Act
+    newton.add_node(3.0, std::sin(3.0));
+    x.push_back(3.0);
+    y.push_back(std::sin(3.0));
+    BasicNewtonInterpolator<double> appended(x, y);
+    bool coefficients_after_add = base.get_node_count() == 7;
+    for (size_t i = 0; coefficients_after_add && i < 7; i++) {
+        coefficients_after_add = std::abs(base.get_coefficients()[i] - appended.get_coefficients()[i]) < 1e-12;
+    }
+    newton.set_window_size(4);
+    BasicNewtonInterpolator<double> window(std::vector<double>(x.end() - 4, x.end()),
+                                           std::vector<double>(y.end() - 4, y.end()));
+    bool coefficients_after_window = base.get_node_count() == 4;
+    for (size_t i = 0; coefficients_after_window && i < 4; i++) {
+        coefficients_after_window = std::abs(base.get_coefficients()[i] - window.get_coefficients()[i]) < 1e-12;
+    }
+    
+    // Assert
+    assert_true(std::is_base_of<BasicNewtonInterpolator<double>, NewtonInterpolator>::value,
+                "NewtonInterpolator наследует BasicNewtonInterpolator<double>");
+    assert_true(coefficients_after_add, "add_node обновляет коэффициенты базового класса");
+    assert_true(coefficients_after_window, "Скользящее окно обновляет коэффициенты базового класса");
+    assert_double_equal(base.interpolate(2.25), newton.interpolate(2.25), 1e-15,
+                        "Вычисление в точке общее с базовым классом");
+    assert_double_equal(newton.interpolate(2.25), window.interpolate(2.25), 1e-12,
+                        "Значение совпадает с таблицей из последних узлов");
+}
+
+/**
+ * @brief Запуск всех тестов для BasicNewtonInterpolator
+ */
+void run_basic_newton_interpolator_tests() {
+    std::cout << "\n=== Тесты BasicNewtonInterpolator ===\n";
+    
+    test_precision_variants_match_double();
+    test_mixed_precision_passes_through_nodes();
+    test_long_double_high_degree();
+    test_precision_invalid_input();
+    test_newton_interpolator_shares_double_storage();
+}
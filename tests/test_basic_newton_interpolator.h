@@ -0,0 +1,14 @@
+/**
+ * @file test_basic_newton_interpolator.h
+ * @brief Объявления тестов для BasicNewtonInterpolator
+ */
+
+#ifndef TEST_BASIC_NEWTON_INTERPOLATOR_H
+#define TEST_BASIC_NEWTON_INTERPOLATOR_H
+
+/**
+ * @brief Запуск всех тестов для BasicNewtonInterpolator
+ */
+void run_basic_newton_interpolator_tests();
+
+#endif // TEST_BASIC_NEWTON_INTERPOLATOR_H
@@ -0,0 +1,82 @@
+/**
+ * @file test_batch_evaluator.cpp
+ * @brief Модульные тесты для класса BatchEvaluator
+ */
+
+#include "test_batch_evaluator.h"
+#include "test_utils.h"
+#include "../src/core/batch_evaluator.h"
+#include "../src/core/newton_interpolator.h"
+#include <cmath>
+#include <stdexcept>
+
+/**
+ * @brief Тест: Блочное вычисление совпадает с прямым при мелких плитках
+ * AAA: Arrange - готовим таблицу и плитки некратного размера, Act - вычисляем по плиткам, Assert - сравниваем с прямым вычислением
+ */
+void test_batch_tiles_match_direct() {
+    test_group("Блочное вычисление с переносом частичных сумм");
+    
+    // Arrange
+    std::vector<double> x;
+    std::vector<double> y;
+    for (int i = 0; i < 14; i++) {
+        x.push_back(0.3 * i);
+        y.push_back(std::exp(-0.3 * i));
+    }
+    NewtonInterpolator interpolator(x, y);
+    const double* c = interpolator.get_coefficients().data();
+    std::vector<double> points = NewtonInterpolator::generate_points(0.0, 3.9, 53);
+    std::vector<double> expected(points.size());
+    EvaluationKernels::evaluate(EvaluationKernel::Scalar, x.data(), c, x.size(),
+                                points.data(), expected.data(), points.size());
+    BatchEvaluator evaluator(5, 3);
+    std::vector<double> results(points.size());
+    
+    // Act
+    evaluator.evaluate(EvaluationKernel::Auto, x.data(), c, x.size(),
+                       points.data(), results.data(), points.size());
+    
+    // Assert
+    assert_vector_equal(results, expected, 1e-9, 
+                        "Плитки 5 точек x 3 узла дают тот же результат, что и прямое вычисление");
+}
+
+/**
+ * @brief Тест: Размеры блоков интерполятора
+ * AAA: Arrange - готовим интерполятор, Act - меняем размеры блоков, Assert - проверяем результат и валидацию
+ */
+void test_batch_interpolator_tiling() {
+    test_group("Размеры блоков в NewtonInterpolator");
+    
+    // Arrange
+    std::vector<double> x = {0.0, 1.0, 2.0, 3.0, 4.0};
+    std::vector<double> y = {0.0, 1.0, 8.0, 27.0, 64.0};
+    NewtonInterpolator interpolator(x, y);
+    std::vector<double> points = NewtonInterpolator::generate_points(0.0, 4.0, 21);
+    std::vector<double> expected;
+    for (double p : points) {
+        expected.push_back(p * p * p);
+    }
+    
+    // Act
+    interpolator.set_batch_tiling(4, 2);
+    
+    // Assert
+    assert_vector_equal(interpolator.interpolate_multiple(points), expected, 1e-9,
+                        "interpolate_multiple с мелкими блоками точно воспроизводит x^3");
+    assert_throws<std::invalid_argument>(
+        [&]() { interpolator.set_batch_tiling(0, 16); },
+        "Нулевой размер блока выбрасывает исключение"
+    );
+}
+
+/**
+ * @brief Запуск всех тестов для BatchEvaluator
+ */
+void run_batch_evaluator_tests() {
+    std::cout << "\n=== Тесты BatchEvaluator ===\n";
+    
+    test_batch_tiles_match_direct();
+    test_batch_interpolator_tiling();
+}
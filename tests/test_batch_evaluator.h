@@ -0,0 +1,14 @@
+/**
+ * @file test_batch_evaluator.h
+ * @brief Объявления тестов для BatchEvaluator
+ */
+
+#ifndef TEST_BATCH_EVALUATOR_H
+#define TEST_BATCH_EVALUATOR_H
+
+/**
+ * @brief Запуск всех тестов для BatchEvaluator
+ */
+void run_batch_evaluator_tests();
+
+#endif // TEST_BATCH_EVALUATOR_H
@@ -0,0 +1,177 @@
+/**
+ * @file test_batch_telemetry.cpp
+ * @brief Модульные тесты для телеметрии потоков пакетного вычисления
+ */
+
+#include "test_batch_telemetry.h"
+#include "test_utils.h"
+#include "../src/core/batch_telemetry.h"
+#include "../src/core/newton_interpolator.h"
+#include <chrono>
+#include <cmath>
+
+/**
+ * @brief Тест: Учет порций потоками
+ * AAA: Arrange - задаем порции с известными интервалами, Act - завершаем пакет, Assert - проверяем ячейки
+ */
+void test_telemetry_recorder_accounting() {
+    test_group("Учет порций потоками");
+    
+    // Arrange
+    using clock = TelemetryRecorder::clock;
+    TelemetryRecorder recorder(3);
+    const clock::time_point base = clock::now();
+    
+    // Act
+    recorder.record_chunk(0, base, base + std::chrono::milliseconds(2), 100);
+    recorder.record_chunk(0, base + std::chrono::milliseconds(3), base + std::chrono::milliseconds(4), 50);
+    recorder.record_chunk(7, base, base + std::chrono::milliseconds(1), 10);
+    BatchTelemetry telemetry = recorder.finish();
+    
+    // Assert
+    assert_true(telemetry.threads.size() == 3, "Ячейка на каждый поток команды");
+    assert_double_equal(telemetry.threads[0].busy_ms, 3.0, 1e-9, "Занятость - сумма длительностей порций");
+    assert_true(telemetry.threads[0].points == 150 && telemetry.threads[0].chunks == 2,
+                "Точки и порции суммируются");
+    assert_true(telemetry.threads[2].chunks == 0 && telemetry.dropped_chunks == 1,
+                "Номер вне команды не попадает в чужую ячейку, а учитывается отдельно");
+    assert_true(telemetry.threads[1].chunks == 0 &&
+                telemetry.threads[1].wait_ms == telemetry.wall_ms,
+                "Поток без порций ожидает весь пакет");
+}
+
+/**
+ * @brief Тест: Загрузка и дисбаланс
+ * AAA: Arrange - задаем телеметрию вручную, Act - вычисляем показатели, Assert - проверяем значения
+ */
+void test_telemetry_utilization_and_imbalance() {
+    test_group("Загрузка и дисбаланс");
+    
+    // Arrange
+    BatchTelemetry telemetry;
+    telemetry.wall_ms = 10.0;
+    telemetry.threads.resize(2);
+    telemetry.threads[0].busy_ms = 9.0;
+    telemetry.threads[1].busy_ms = 3.0;
+    BatchTelemetry empty;
+    
+    // Act
+    double utilization = telemetry.utilization(0);
+    double imbalance = telemetry.imbalance();
+    
+    // Assert
+    assert_double_equal(utilization, 0.9, 1e-12, "Загрузка - доля занятости во времени пакета");
+    assert_double_equal(imbalance, 1.5, 1e-12, "Дисбаланс - максимум к среднему");
+    assert_double_equal(telemetry.total_busy_ms(), 12.0, 1e-12, "Суммарная занятость");
+    assert_double_equal(telemetry.utilization(5), 0.0, 1e-12, "Поток вне команды - нулевая загрузка");
+    assert_double_equal(empty.imbalance(), 1.0, 1e-12, "Пустая телеметрия сбалансирована");
+}
+
+/**
+ * @brief Тест: Телеметрия интерполятора при всех политиках и методах
+ * AAA: Arrange - готовим интерполяторы и пул, Act - вычисляем с телеметрией, Assert - сверяем результаты и счетчики
+ */
+void test_interpolator_telemetry() {
+    test_group("Телеметрия интерполятора при всех политиках и методах");
+    
+    // Arrange
+    std::vector<double> x;
+    std::vector<double> y;
+    for (int i = 0; i < 25; i++) {
+        x.push_back(0.4 * i);
+        y.push_back(std::sin(0.4 * i));
+    }
+    std::vector<double> points = NewtonInterpolator::generate_points(0.0, 9.6, 5000);
+    WorkStealingPool pool(4);
+    const SchedulePolicy policies[] = {SchedulePolicy::Static, SchedulePolicy::Dynamic,
+                                       SchedulePolicy::Guided, SchedulePolicy::WorkStealing};
+    const InterpolationMethod methods[] = {InterpolationMethod::Newton, InterpolationMethod::Barycentric,
+                                           InterpolationMethod::Piecewise};
+    
+    // Act & Assert
+    for (InterpolationMethod method : methods) {
+        NewtonInterpolator interpolator(x, y, method);
+        std::vector<double> expected = interpolator.interpolate_multiple(points);
+        for (SchedulePolicy policy : policies) {
+            ParallelSchedule schedule;
+            schedule.policy = policy;
+            schedule.chunk_size = 2;
+            schedule.thread_count = 4;
+            schedule.pool = &pool;
+            interpolator.set_schedule(schedule);
+            BatchTelemetry telemetry;
+            std::vector<double> results = interpolator.interpolate_multiple(points, telemetry);
+            
+            size_t covered = 0;
+            size_t chunks = 0;
+            for (const ThreadTelemetry& thread : telemetry.threads) {
+                covered += thread.points;
+                chunks += thread.chunks;
+            }
+            const std::string label = std::string(ParallelScheduler::name(policy)) + ", метод " +
+                                      std::to_string(static_cast<int>(method));
+            assert_vector_equal(results, expected, 1e-12, "Результат совпадает: " + label);
+            assert_true(telemetry.threads.size() == 4 && covered == points.size() && chunks > 0,
+                        "Порции потоков покрывают пакет: " + label);
+        }
+    }
+    
+    NewtonInterpolator empty;
+    BatchTelemetry telemetry;
+    std::vector<double> results = empty.interpolate_multiple(points, telemetry);
+    assert_true(std::isnan(results[0]) && telemetry.threads.empty(),
+                "Без данных - NaN и пустая телеметрия");
+}
+
+/**
+ * @brief Тест: Однопоточный пакет внутри рабочего потока пула
+ * AAA: Arrange - пул из 4 потоков и однопоточное расписание, Act - пакет из каждого рабочего потока,
+ *      Assert - все точки в единственной ячейке, ничего не отброшено
+ */
+void test_telemetry_single_thread_inside_pool() {
+    test_group("Однопоточный пакет внутри пула");
+    
+    // Arrange
+    WorkStealingPool pool(4);
+    NewtonInterpolator interpolator({0.0, 1.0, 2.0, 3.0}, {1.0, 2.0, 5.0, 10.0});
+    ParallelSchedule schedule;
+    schedule.policy = SchedulePolicy::WorkStealing;
+    schedule.thread_count = 1;
+    interpolator.set_schedule(schedule);
+    std::vector<double> points(64);
+    for (size_t i = 0; i < points.size(); i++) {
+        points[i] = 3.0 * i / points.size();
+    }
+    std::vector<BatchTelemetry> telemetry(4);
+    
+    // Act
+    ParallelSchedule outer;
+    outer.policy = SchedulePolicy::WorkStealing;
+    outer.pool = &pool;
+    auto body = [&](size_t begin, size_t end) {
+        for (size_t i = begin; i < end; i++) {
+            interpolator.interpolate_multiple(points, telemetry[i]);
+        }
+    };
+    ParallelScheduler::parallel_for(outer, telemetry.size(), body);
+    
+    // Assert
+    bool attributed = true;
+    for (const BatchTelemetry& t : telemetry) {
+        attributed = attributed && t.threads.size() == 1 && t.threads[0].points == points.size() &&
+                     t.dropped_chunks == 0;
+    }
+    assert_true(attributed, "Порции однопоточного пакета учтены в ячейке 0 из любого рабочего потока");
+}
+
+/**
+ * @brief Запуск всех тестов для BatchTelemetry и TelemetryRecorder
+ */
+void run_batch_telemetry_tests() {
+    std::cout << "\n=== Тесты BatchTelemetry и TelemetryRecorder ===\n";
+    
+    test_telemetry_recorder_accounting();
+    test_telemetry_utilization_and_imbalance();
+    test_interpolator_telemetry();
+    test_telemetry_single_thread_inside_pool();
+}
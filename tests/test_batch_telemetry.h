@@ -0,0 +1,14 @@
+/**
+ * @file test_batch_telemetry.h
+ * @brief Объявления тестов для BatchTelemetry и TelemetryRecorder
+ */
+
+#ifndef TEST_BATCH_TELEMETRY_H
+#define TEST_BATCH_TELEMETRY_H
+
+/**
+ * @brief Запуск всех тестов для BatchTelemetry и TelemetryRecorder
+ */
+void run_batch_telemetry_tests();
+
+#endif // TEST_BATCH_TELEMETRY_H
@@ -0,0 +1,112 @@
+/**
+ * @file test_benchmark.cpp
+ * @brief Модульные тесты для статистики измерений и отчета бенчмарка
+ */
+
+#include "test_benchmark.h"
+#include "test_utils.h"
+#include "../src/core/benchmark.h"
+#include "../src/core/benchmark_report.h"
+#include <cmath>
+#include <stdexcept>
+
+/**
+ * @brief Тест: Статистика по известной выборке
+ * AAA: Arrange - готовим 20 значений 1..20, Act - считаем статистику, Assert - сверяем
+ */
+void test_benchmark_stats_known_samples() {
+    test_group("Статистика по известной выборке");
+    
+    // Arrange - порядок значений не должен влиять на результат
+    std::vector<double> samples;
+    for (int i = 20; i >= 1; i--) {
+        samples.push_back(i);
+    }
+    
+    // Act
+    BenchmarkStats stats = BenchmarkStats::from_samples(samples);
+    
+    // Assert
+    assert_true(stats.runs == 20, "Учтены все 20 измерений");
+    assert_double_equal(stats.min_ms, 1.0, 1e-12, "Минимум равен 1");
+    assert_double_equal(stats.max_ms, 20.0, 1e-12, "Максимум равен 20");
+    assert_double_equal(stats.median_ms, 10.5, 1e-12, "Медиана четной выборки - среднее двух средних");
+    assert_double_equal(stats.p95_ms, 19.0, 1e-12, "95-й перцентиль по ближайшему рангу - 19-е значение");
+    assert_double_equal(stats.mean_ms, 10.5, 1e-12, "Среднее равно 10.5");
+    assert_double_equal(stats.stddev_ms, std::sqrt(35.0), 1e-12, "Выборочное отклонение равно sqrt(35)");
+    assert_throws<std::invalid_argument>(
+        [&]() { BenchmarkStats::from_samples({}); },
+        "Пустая выборка вызывает исключение"
+    );
+}
+
+/**
+ * @brief Тест: Прогрев и повторы
+ * AAA: Arrange - создаем Benchmark(2, 5), Act - измеряем счетчик, Assert - проверяем число вызовов
+ */
+void test_benchmark_warmup_and_runs() {
+    test_group("Прогрев и повторы");
+    
+    // Arrange
+    Benchmark benchmark(2, 5);
+    int calls = 0;
+    
+    // Act
+    BenchmarkStats stats = benchmark.measure([&]() { calls++; });
+    
+    // Assert
+    assert_true(calls == 7, "Функция вызвана 2 + 5 раз");
+    assert_true(stats.runs == 5, "В статистику попали только измеряемые прогоны");
+    assert_throws<std::invalid_argument>(
+        [&]() { Benchmark invalid(1, 0); },
+        "Ноль измеряемых прогонов вызывает исключение"
+    );
+}
+
+/**
+ * @brief Тест: Формат CSV и JSON
+ * AAA: Arrange - готовим запись, Act - формируем отчеты, Assert - проверяем поля
+ */
+void test_benchmark_report_formats() {
+    test_group("Формат CSV и JSON");
+    
+    // Arrange
+    BenchmarkReport report(42);
+    BenchmarkRecord record;
+    record.mode = "newton";
+    record.phase = "evaluate";
+    record.kernel = "avx2";
+    record.schedule = "work-stealing";
+    record.nodes = 25;
+    record.batch = 1000;
+    record.threads = 4;
+    record.stats = BenchmarkStats::from_samples({2.0, 2.0, 2.0});
+    report.add(record);
+    
+    // Act
+    std::string csv = report.to_csv();
+    std::string json = report.to_json();
+    
+    // Assert
+    assert_true(csv.find("mode,phase,kernel,schedule,nodes,batch,threads,runs,") == 0, "CSV начинается с заголовка");
+    assert_true(csv.find("newton,evaluate,avx2,work-stealing,25,1000,4,3,2,2,2,2,0,2,500000") != std::string::npos,
+                "Строка CSV содержит параметры, статистику и пропускную способность");
+    assert_true(json.find("\"kernel\": \"avx2\", \"schedule\": \"work-stealing\"") != std::string::npos,
+                "JSON содержит ядро и политику распределения");
+    assert_true(json.find("\"seed\": 42") != std::string::npos, "JSON содержит зерно");
+    assert_true(json.find("\"median_ms\": 2") != std::string::npos &&
+                json.find("\"points_per_second\": 500000") != std::string::npos,
+                "JSON содержит медиану и пропускную способность");
+    assert_double_equal(record.points_per_second(), 5e5, 1e-6, "1000 точек за 2 мс - 500000 точек в секунду");
+}
+
+/**
+ * @brief Запуск всех тестов для Benchmark и BenchmarkReport
+ */
+void run_benchmark_tests() {
+    std::cout << "\n=== Тесты Benchmark и BenchmarkReport ===\n";
+    
+    test_benchmark_stats_known_samples();
+    test_benchmark_warmup_and_runs();
+    test_benchmark_report_formats();
+}
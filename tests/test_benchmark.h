@@ -0,0 +1,14 @@
+/**
+ * @file test_benchmark.h
+ * @brief Объявления тестов для Benchmark и BenchmarkReport
+ */
+
+#ifndef TEST_BENCHMARK_H
+#define TEST_BENCHMARK_H
+
+/**
+ * @brief Запуск всех тестов для Benchmark и BenchmarkReport
+ */
+void run_benchmark_tests();
+
+#endif // TEST_BENCHMARK_H
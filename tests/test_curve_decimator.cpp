@@ -0,0 +1,169 @@
+/**
+ * @file test_curve_decimator.cpp
+ * @brief Модульные тесты для прореживания кривых перед построением
+ */
+
+#include "test_curve_decimator.h"
+#include "test_utils.h"
+#include "../src/core/curve_decimator.h"
+#include <algorithm>
+#include <cmath>
+#include <omp.h>
+#include <stdexcept>
+
+namespace {
+
+/**
+ * @brief Быстро осциллирующая кривая с выбросом в середине
+ */
+void make_curve(size_t n, std::vector<double>& x, std::vector<double>& y) {
+    x.resize(n);
+    y.resize(n);
+    for (size_t i = 0; i < n; i++) {
+        x[i] = static_cast<double>(i) / static_cast<double>(n - 1);
+        y[i] = std::sin(200.0 * x[i]);
+    }
+    y[n / 2] = 10.0;
+}
+
+} // namespace
+
+/**
+ * @brief Тест: MinMax сохраняет экстремумы и концы кривой
+ * AAA: Arrange - строим кривую с выбросом, Act - прореживаем до 100 столбцов, Assert - проверяем точки
+ */
+void test_min_max_keeps_extremes() {
+    test_group("MinMax сохраняет экстремумы и концы кривой");
+
+    // Arrange
+    std::vector<double> x;
+    std::vector<double> y;
+    make_curve(100000, x, y);
+    std::vector<double> out_x;
+    std::vector<double> out_y;
+
+    // Act
+    CurveDecimator::min_max(x, y, 100, out_x, out_y);
+
+    // Assert
+    assert_true(out_x.size() <= 400 && out_x.size() == out_y.size(), "Не более 4 точек на столбец");
+    assert_true(std::is_sorted(out_x.begin(), out_x.end()), "Порядок точек сохранен");
+    assert_true(out_x.front() == x.front() && out_x.back() == x.back(), "Первая и последняя точки сохранены");
+    assert_double_equal(*std::max_element(out_y.begin(), out_y.end()), 10.0, 1e-12, "Выброс сохранен");
+    assert_double_equal(*std::min_element(out_y.begin(), out_y.end()),
+                        *std::min_element(y.begin(), y.end()), 1e-12, "Глобальный минимум сохранен");
+}
+
+/**
+ * @brief Тест: Результат MinMax не зависит от числа потоков
+ * AAA: Arrange - строим кривую, Act - прореживаем в 1 и 4 потоках, Assert - сравниваем
+ */
+void test_min_max_thread_independent() {
+    test_group("Результат MinMax не зависит от числа потоков");
+
+    // Arrange
+    std::vector<double> x;
+    std::vector<double> y;
+    make_curve(50001, x, y);
+    std::vector<double> serial_x, serial_y, parallel_x, parallel_y;
+    int saved_threads = omp_get_max_threads();
+
+    // Act
+    omp_set_num_threads(1);
+    CurveDecimator::min_max(x, y, 333, serial_x, serial_y);
+    omp_set_num_threads(4);
+    CurveDecimator::min_max(x, y, 333, parallel_x, parallel_y);
+    omp_set_num_threads(saved_threads);
+
+    // Assert
+    assert_vector_equal(parallel_x, serial_x, 1e-12, "x совпадают");
+    assert_vector_equal(parallel_y, serial_y, 1e-12, "y совпадают");
+}
+
+/**
+ * @brief Тест: LTTB оставляет заданное число точек
+ * AAA: Arrange - строим кривую, Act - прореживаем до 500 точек, Assert - проверяем размер и концы
+ */
+void test_lttb_threshold() {
+    test_group("LTTB оставляет заданное число точек");
+
+    // Arrange
+    std::vector<double> x;
+    std::vector<double> y;
+    make_curve(100000, x, y);
+    std::vector<double> out_x;
+    std::vector<double> out_y;
+
+    // Act
+    CurveDecimator::lttb(x, y, 500, out_x, out_y);
+
+    // Assert
+    assert_true(out_x.size() == 500 && out_y.size() == 500, "Ровно threshold точек");
+    assert_true(std::adjacent_find(out_x.begin(), out_x.end(), std::greater_equal<double>()) == out_x.end(),
+                "x строго возрастают");
+    assert_true(out_x.front() == x.front() && out_x.back() == x.back(), "Первая и последняя точки сохранены");
+    assert_double_equal(*std::max_element(out_y.begin(), out_y.end()), 10.0, 1e-12, "Выброс выбран");
+}
+
+/**
+ * @brief Тест: Короткие кривые не прореживаются
+ * AAA: Arrange - кривая из 10 точек, Act - прореживаем всеми способами, Assert - результат равен входу
+ */
+void test_short_curve_copied() {
+    test_group("Короткие кривые не прореживаются");
+
+    // Arrange
+    std::vector<double> x;
+    std::vector<double> y;
+    make_curve(10, x, y);
+    std::vector<double> min_max_x, min_max_y, lttb_x, lttb_y, none_x, none_y;
+
+    // Act
+    CurveDecimator::decimate(DecimationMethod::MinMax, x, y, 100, min_max_x, min_max_y);
+    CurveDecimator::decimate(DecimationMethod::Lttb, x, y, 100, lttb_x, lttb_y);
+    CurveDecimator::decimate(DecimationMethod::None, x, y, 2, none_x, none_y);
+
+    // Assert
+    assert_vector_equal(min_max_y, y, 1e-12, "MinMax возвращает все точки");
+    assert_vector_equal(lttb_y, y, 1e-12, "LTTB возвращает все точки");
+    assert_vector_equal(none_x, x, 1e-12, "None не прореживает");
+}
+
+/**
+ * @brief Тест: Некорректные входные данные
+ * AAA: Arrange - готовим некорректные данные, Act & Assert - проверяем исключения
+ */
+void test_decimator_invalid_input() {
+    test_group("Некорректные входные данные прореживания");
+
+    // Arrange
+    std::vector<double> x = {0.0, 1.0, 2.0, 3.0};
+    std::vector<double> y = {0.0, 1.0, 0.0, 1.0};
+    std::vector<double> unsorted = {0.0, 2.0, 1.0, 3.0};
+    std::vector<double> single = {0.0};
+    std::vector<double> out_x;
+    std::vector<double> out_y;
+
+    // Act & Assert
+    assert_throws<std::invalid_argument>([&]() { CurveDecimator::min_max(x, single, 10, out_x, out_y); },
+                                         "Разные размеры x и y");
+    assert_throws<std::invalid_argument>([&]() { CurveDecimator::min_max(x, y, 0, out_x, out_y); },
+                                         "Нулевая ширина");
+    assert_throws<std::invalid_argument>([&]() { CurveDecimator::min_max(unsorted, y, 1, out_x, out_y); },
+                                         "Неупорядоченные x");
+    assert_throws<std::invalid_argument>([&]() { CurveDecimator::lttb(x, y, 2, out_x, out_y); },
+                                         "LTTB менее чем в 3 точки");
+}
+
+/**
+ * @brief Запуск всех тестов для CurveDecimator
+ */
+void run_curve_decimator_tests() {
+    std::cout << "\n=== Тесты CurveDecimator ===\n";
+
+    test_min_max_keeps_extremes();
+    test_min_max_thread_independent();
+    test_lttb_threshold();
+    test_short_curve_copied();
+    test_decimator_invalid_input();
+}
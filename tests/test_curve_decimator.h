@@ -0,0 +1,14 @@
+/**
+ * @file test_curve_decimator.h
+ * @brief Объявления тестов для CurveDecimator
+ */
+
+#ifndef TEST_CURVE_DECIMATOR_H
+#define TEST_CURVE_DECIMATOR_H
+
+/**
+ * @brief Запуск всех тестов для CurveDecimator
+ */
+void run_curve_decimator_tests();
+
+#endif // TEST_CURVE_DECIMATOR_H
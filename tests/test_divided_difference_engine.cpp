@@ -0,0 +1,201 @@
+/**
+ * @file test_divided_difference_engine.cpp
+ * @brief Модульные тесты для класса DividedDifferenceEngine
+ */
+
+#include "test_divided_difference_engine.h"
+#include "test_utils.h"
+#include "../src/core/divided_difference_engine.h"
+#include "../src/core/newton_interpolator.h"
+#include <omp.h>
+#include <cmath>
+#include <cstdint>
+#include <stdexcept>
+
+/**
+ * @brief Тест: Коэффициенты квадратичной функции
+ * AAA: Arrange - готовим узлы y = x^2, Act - вычисляем коэффициенты, Assert - сверяем с известными
+ */
+void test_engine_quadratic_coefficients() {
+    test_group("Коэффициенты квадратичной функции");
+    
+    // Arrange - y = x^2: f[x0] = 0, f[x0,x1] = 1, f[x0,x1,x2] = 1, f[x0..x3] = 0
+    std::vector<double> x = {0.0, 1.0, 2.0, 3.0};
+    std::vector<double> y = {0.0, 1.0, 4.0, 9.0};
+    DividedDifferenceEngine engine;
+    
+    // Act
+    engine.compute(x.data(), y.data(), x.size());
+    
+    // Assert
+    const AlignedVector<double>& c = engine.get_coefficients();
+    std::vector<double> actual(c.begin(), c.end());
+    assert_vector_equal(actual, {0.0, 1.0, 1.0, 0.0}, 1e-12,
+                        "Коэффициенты совпадают с f[x0..xj] для y = x^2");
+}
+
+/**
+ * @brief Тест: Буфер коэффициентов выровнен
+ * AAA: Arrange - готовим узлы, Act - вычисляем, Assert - проверяем адрес буфера
+ */
+void test_engine_buffer_alignment() {
+    test_group("Выравнивание буфера коэффициентов");
+    
+    // Arrange
+    std::vector<double> x = {0.0, 1.0, 2.0, 3.0, 4.0};
+    std::vector<double> y = {1.0, 2.0, 0.0, 5.0, 3.0};
+    DividedDifferenceEngine engine;
+    
+    // Act
+    engine.compute(x.data(), y.data(), x.size());
+    
+    // Assert
+    auto address = reinterpret_cast<std::uintptr_t>(engine.get_coefficients().data());
+    assert_true(address % DEFAULT_BUFFER_ALIGNMENT == 0,
+                "Коэффициенты хранятся в выровненном буфере");
+}
+
+/**
+ * @brief Тест: Полная упакованная таблица совпадает с классической таблицей n x n
+ * AAA: Arrange - строим эталонную таблицу, Act - вычисляем с сохранением таблицы, Assert - сравниваем все элементы
+ */
+void test_engine_full_table_matches_reference() {
+    test_group("Упакованная треугольная таблица");
+    
+    // Arrange
+    std::vector<double> x = {-1.0, 0.5, 1.0, 2.5, 4.0, 4.5};
+    std::vector<double> y = {3.0, -1.0, 2.0, 0.5, 7.0, -2.0};
+    size_t n = x.size();
+    std::vector<std::vector<double>> reference(n, std::vector<double>(n, 0.0));
+    for (size_t i = 0; i < n; i++) {
+        reference[i][0] = y[i];
+    }
+    for (size_t j = 1; j < n; j++) {
+        for (size_t i = 0; i < n - j; i++) {
+            reference[i][j] = (reference[i+1][j-1] - reference[i][j-1]) / (x[i+j] - x[i]);
+        }
+    }
+    DividedDifferenceEngine engine(true);
+    
+    // Act
+    engine.compute(x.data(), y.data(), n);
+    
+    // Assert
+    bool all_equal = true;
+    for (size_t j = 0; j < n; j++) {
+        for (size_t i = 0; i < n - j; i++) {
+            if (std::abs(engine.get_divided_difference(i, j) - reference[i][j]) > 1e-12) {
+                all_equal = false;
+            }
+        }
+    }
+    assert_true(all_equal, "Все элементы упакованной таблицы совпадают с эталоном");
+    assert_throws<std::out_of_range>(
+        [&]() { engine.get_divided_difference(n - 1, 1); },
+        "Обращение за пределы треугольника выбрасывает исключение"
+    );
+}
+
+/**
+ * @brief Тест: Без опции полная таблица недоступна
+ * AAA: Arrange - создаем интерполятор по умолчанию, Act - запрашиваем элемент таблицы, Assert - проверяем исключение
+ */
+void test_engine_table_disabled_by_default() {
+    test_group("Полная таблица отключена по умолчанию");
+    
+    // Arrange
+    std::vector<double> x = {0.0, 1.0, 2.0};
+    std::vector<double> y = {1.0, 4.0, 9.0};
+    NewtonInterpolator interpolator(x, y);
+    
+    // Act & Assert
+    assert_throws<std::logic_error>(
+        [&]() { interpolator.get_divided_difference(0, 1); },
+        "Запрос элемента таблицы без сохранения выбрасывает исключение"
+    );
+    
+    interpolator.set_keep_full_table(true);
+    interpolator.set_data(x, y);
+    assert_double_equal(interpolator.get_divided_difference(1, 1), 5.0, 1e-12,
+                        "После включения опции таблица доступна через интерполятор");
+}
+
+/**
+ * @brief Тест: Совпадающие узлы
+ * AAA: Arrange - готовим узлы с дубликатом, Act - вычисляем, Assert - проверяем исключение
+ */
+void test_engine_duplicate_nodes() {
+    test_group("Совпадающие узлы");
+    
+    // Arrange
+    std::vector<double> x = {0.0, 1.0, 1.0, 2.0};
+    std::vector<double> y = {0.0, 1.0, 2.0, 3.0};
+    DividedDifferenceEngine engine;
+    
+    // Act & Assert
+    assert_throws<std::runtime_error>(
+        [&]() { engine.compute(x.data(), y.data(), x.size()); },
+        "Совпадающие узлы приводят к исключению деления на ноль"
+    );
+}
+
+/**
+ * @brief Тест: Параллельное построение совпадает с последовательным
+ * AAA: Arrange - готовим узлы и два движка с разными порогами, Act - вычисляем, Assert - сравниваем коэффициенты, диагональ и таблицу
+ */
+void test_engine_parallel_build_matches_serial() {
+    test_group("Параллельное построение коэффициентов");
+    
+    // Arrange
+    std::vector<double> x;
+    std::vector<double> y;
+    for (int i = 0; i < 41; i++) {
+        x.push_back(0.1 * i);
+        y.push_back(std::sin(0.1 * i) + 0.01 * (i % 7));
+    }
+    DividedDifferenceEngine serial(true);
+    DividedDifferenceEngine parallel(true);
+    parallel.set_parallel_threshold(4);
+    int saved_threads = omp_get_max_threads();
+    omp_set_num_threads(4);
+    
+    // Act
+    serial.compute(x.data(), y.data(), x.size());
+    parallel.compute(x.data(), y.data(), x.size());
+    omp_set_num_threads(saved_threads);
+    
+    // Assert - операции одни и те же, поэтому результаты совпадают точно
+    std::vector<double> expected(serial.get_coefficients().begin(), serial.get_coefficients().end());
+    std::vector<double> actual(parallel.get_coefficients().begin(), parallel.get_coefficients().end());
+    assert_vector_equal(actual, expected, 1e-300, "Коэффициенты совпадают с последовательным построением");
+    
+    bool table_equal = true;
+    for (size_t j = 0; j < x.size(); j++) {
+        for (size_t i = 0; i + j < x.size(); i++) {
+            if (parallel.get_divided_difference(i, j) != serial.get_divided_difference(i, j)) {
+                table_equal = false;
+            }
+        }
+    }
+    assert_true(table_equal, "Упакованная таблица совпадает с последовательным построением");
+    
+    // Последняя диагональ проверяется через добавление узла
+    serial.append(x.data(), 4.15, 0.5);
+    parallel.append(x.data(), 4.15, 0.5);
+    assert_true(parallel.get_coefficients().back() == serial.get_coefficients().back(),
+                "Последняя диагональ после параллельного построения корректна");
+}
+
+/**
+ * @brief Запуск всех тестов для DividedDifferenceEngine
+ */
+void run_divided_difference_engine_tests() {
+    std::cout << "\n=== Тесты DividedDifferenceEngine ===\n";
+    
+    test_engine_quadratic_coefficients();
+    test_engine_buffer_alignment();
+    test_engine_full_table_matches_reference();
+    test_engine_table_disabled_by_default();
+    test_engine_duplicate_nodes();
+    test_engine_parallel_build_matches_serial();
+}
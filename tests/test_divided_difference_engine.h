@@ -0,0 +1,14 @@
+/**
+ * @file test_divided_difference_engine.h
+ * @brief Объявления тестов для класса DividedDifferenceEngine
+ */
+
+#ifndef TEST_DIVIDED_DIFFERENCE_ENGINE_H
+#define TEST_DIVIDED_DIFFERENCE_ENGINE_H
+
+/**
+ * @brief Запуск всех тестов для DividedDifferenceEngine
+ */
+void run_divided_difference_engine_tests();
+
+#endif // TEST_DIVIDED_DIFFERENCE_ENGINE_H
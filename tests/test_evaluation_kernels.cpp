@@ -0,0 +1,96 @@
+/**
+ * @file test_evaluation_kernels.cpp
+ * @brief Модульные тесты для векторных ядер EvaluationKernels
+ */
+
+#include "test_evaluation_kernels.h"
+#include "test_utils.h"
+#include "../src/core/evaluation_kernels.h"
+#include "../src/core/newton_interpolator.h"
+#include <cmath>
+#include <stdexcept>
+
+/**
+ * @brief Тест: Автоматический выбор ядра
+ * AAA: Arrange - нет, Act - определяем лучшее ядро, Assert - проверяем, что оно поддерживается
+ */
+void test_kernels_detect_best() {
+    test_group("Выбор ядра по CPUID");
+    
+    // Act
+    EvaluationKernel best = EvaluationKernels::detect_best();
+    
+    // Assert
+    assert_true(best != EvaluationKernel::Auto, "detect_best возвращает конкретное ядро");
+    assert_true(EvaluationKernels::is_supported(best), "Выбранное ядро поддерживается процессором");
+    assert_true(EvaluationKernels::resolve(EvaluationKernel::Auto) == best, "Auto разрешается в лучшее ядро");
+    std::cout << "  (ядро: " << EvaluationKernels::name(best) << ")\n";
+}
+
+/**
+ * @brief Тест: Все поддерживаемые ядра совпадают со скалярным
+ * AAA: Arrange - готовим узлы и точки (число точек не кратно ширине вектора), Act - вычисляем каждым ядром, Assert - сравниваем
+ */
+void test_kernels_match_scalar() {
+    test_group("Векторные ядра совпадают со скалярным");
+    
+    // Arrange
+    std::vector<double> x;
+    std::vector<double> y;
+    for (int i = 0; i < 12; i++) {
+        x.push_back(0.25 * i);
+        y.push_back(std::cos(0.25 * i));
+    }
+    NewtonInterpolator interpolator(x, y);
+    std::vector<double> points = NewtonInterpolator::generate_points(-0.5, 3.5, 37);
+    std::vector<double> expected(points.size());
+    EvaluationKernels::evaluate(EvaluationKernel::Scalar, x.data(), interpolator.get_coefficients().data(),
+                                x.size(), points.data(), expected.data(), points.size());
+    
+    // Act & Assert
+    const EvaluationKernel kernels[] = {EvaluationKernel::SSE2, EvaluationKernel::AVX2, EvaluationKernel::AVX512};
+    for (EvaluationKernel kernel : kernels) {
+        if (!EvaluationKernels::is_supported(kernel)) {
+            std::cout << "  - ядро " << EvaluationKernels::name(kernel) << " не поддерживается, пропуск\n";
+            continue;
+        }
+        interpolator.set_evaluation_kernel(kernel);
+        assert_vector_equal(interpolator.interpolate_multiple(points), expected, 1e-9,
+                            std::string("Ядро ") + EvaluationKernels::name(kernel) + " совпадает со скалярным");
+    }
+}
+
+/**
+ * @brief Тест: Пакетное вычисление совпадает с interpolate
+ * AAA: Arrange - готовим интерполятор и много точек, Act - вычисляем пакетно, Assert - сравниваем с поточечным
+ */
+void test_kernels_batch_matches_interpolate() {
+    test_group("Пакетное вычисление совпадает с interpolate");
+    
+    // Arrange
+    std::vector<double> x = {0.0, 1.0, 2.0, 3.0, 4.0, 5.0};
+    std::vector<double> y = {2.0, -1.0, 0.0, 4.0, 1.0, 3.0};
+    NewtonInterpolator interpolator(x, y);
+    std::vector<double> points = NewtonInterpolator::generate_points(0.0, 5.0, 1001);
+    
+    // Act
+    std::vector<double> results = interpolator.interpolate_multiple(points);
+    
+    // Assert
+    std::vector<double> expected;
+    for (double p : points) {
+        expected.push_back(interpolator.interpolate(p));
+    }
+    assert_vector_equal(results, expected, 1e-9, "interpolate_multiple совпадает с interpolate во всех точках");
+}
+
+/**
+ * @brief Запуск всех тестов для EvaluationKernels
+ */
+void run_evaluation_kernels_tests() {
+    std::cout << "\n=== Тесты EvaluationKernels ===\n";
+    
+    test_kernels_detect_best();
+    test_kernels_match_scalar();
+    test_kernels_batch_matches_interpolate();
+}
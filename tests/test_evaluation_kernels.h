@@ -0,0 +1,14 @@
+/**
+ * @file test_evaluation_kernels.h
+ * @brief Объявления тестов для EvaluationKernels
+ */
+
+#ifndef TEST_EVALUATION_KERNELS_H
+#define TEST_EVALUATION_KERNELS_H
+
+/**
+ * @brief Запуск всех тестов для EvaluationKernels
+ */
+void run_evaluation_kernels_tests();
+
+#endif // TEST_EVALUATION_KERNELS_H
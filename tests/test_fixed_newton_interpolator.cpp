@@ -0,0 +1,92 @@
+/**
+ * @file test_fixed_newton_interpolator.cpp
+ * @brief Модульные тесты для интерполятора с фиксированным числом узлов
+ */
+
+#include "test_fixed_newton_interpolator.h"
+#include "test_utils.h"
+#include "../src/core/fixed_newton_interpolator.h"
+#include "../src/core/newton_interpolator.h"
+#include <cmath>
+#include <stdexcept>
+
+/**
+ * @brief Таблица y = x^2, превращаемая в коэффициенты при компиляции
+ */
+static constexpr FixedNewtonInterpolator<3> SQUARE_TABLE({2.0, 0.0, 1.0}, {4.0, 0.0, 1.0});
+static_assert(SQUARE_TABLE.interpolate(3.0) == 9.0, "constexpr-таблица воспроизводит x^2");
+static_assert(SQUARE_TABLE.get_coefficients()[2] == 1.0, "Старший коэффициент x^2 равен 1");
+
+/**
+ * @brief Тест: Таблица, вычисленная при компиляции
+ * AAA: Arrange - используем constexpr-таблицу, Act - вычисляем во время выполнения, Assert - проверяем x^2
+ */
+void test_fixed_constexpr_table() {
+    test_group("Таблица, вычисленная при компиляции");
+    
+    // Arrange
+    const FixedNewtonInterpolator<3>& table = SQUARE_TABLE;
+    
+    // Act
+    std::vector<double> results = table.interpolate_multiple({-1.0, 0.5, 2.5});
+    
+    // Assert
+    assert_vector_equal(results, {1.0, 0.25, 6.25}, 1e-12, "Значения x^2 в трех точках");
+    assert_true(FixedNewtonInterpolator<3>::get_node_count() == 3, "Количество узлов равно 3");
+}
+
+/**
+ * @brief Тест: Совпадение с NewtonInterpolator на таблице из 25 узлов
+ * AAA: Arrange - готовим таблицу драйвера, Act - вычисляем обоими классами, Assert - сравниваем
+ */
+void test_fixed_matches_dynamic() {
+    test_group("Совпадение с NewtonInterpolator на 25 узлах");
+    
+    // Arrange - узлы в обратном порядке проверяют сортировку
+    std::array<double, 25> x{};
+    std::array<double, 25> y{};
+    for (size_t i = 0; i < 25; i++) {
+        x[i] = 4.8 - 0.2 * i;
+        y[i] = std::sin(x[i]);
+    }
+    FixedNewtonInterpolator<25> fixed(x, y);
+    NewtonInterpolator dynamic(std::vector<double>(x.begin(), x.end()), std::vector<double>(y.begin(), y.end()));
+    std::vector<double> points = NewtonInterpolator::generate_points(0.0, 4.8, 1001);
+    
+    // Act
+    std::vector<double> results = fixed.interpolate_multiple(points);
+    
+    // Assert
+    assert_vector_equal(results, dynamic.interpolate_multiple(points), 1e-9,
+                        "Значения совпадают с NewtonInterpolator");
+    assert_double_equal(fixed.interpolate(2.3), dynamic.interpolate(2.3), 1e-9,
+                        "Одиночная точка совпадает");
+}
+
+/**
+ * @brief Тест: Обработка совпадающих узлов
+ * AAA: Arrange - готовим таблицу с повтором, Act - устанавливаем данные, Assert - ожидаем исключение
+ */
+void test_fixed_duplicate_nodes() {
+    test_group("Обработка совпадающих узлов");
+    
+    // Arrange
+    FixedNewtonInterpolator<3> interpolator;
+    
+    // Act & Assert
+    assert_throws<std::runtime_error>(
+        [&]() { interpolator.set_data({0.0, 1.0, 1.0}, {0.0, 1.0, 2.0}); },
+        "Повторяющийся узел вызывает исключение"
+    );
+}
+
+/**
+ * @brief Запуск всех тестов для FixedNewtonInterpolator
+ */
+void run_fixed_newton_interpolator_tests() {
+    std::cout << "\n=== Тесты FixedNewtonInterpolator ===\n";
+    
+    test_fixed_constexpr_table();
+    test_fixed_matches_dynamic();
+    test_fixed_duplicate_nodes();
+}
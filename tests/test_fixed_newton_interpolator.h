@@ -0,0 +1,14 @@
+/**
+ * @file test_fixed_newton_interpolator.h
+ * @brief Объявления тестов для FixedNewtonInterpolator
+ */
+
+#ifndef TEST_FIXED_NEWTON_INTERPOLATOR_H
+#define TEST_FIXED_NEWTON_INTERPOLATOR_H
+
+/**
+ * @brief Запуск всех тестов для FixedNewtonInterpolator
+ */
+void run_fixed_newton_interpolator_tests();
+
+#endif // TEST_FIXED_NEWTON_INTERPOLATOR_H
@@ -6,7 +6,9 @@
 #include "test_gnuplot_visualizer.h"
 #include "test_utils.h"
 #include "../src/core/gnuplot_visualizer.h"
+#include <cstdio>
 #include <fstream>
+#include <iterator>
 #include <stdexcept>
 
 /**
@@ -28,12 +30,161 @@ void test_plot_speedup_creates_files() {
         // Игнорируем ошибки gnuplot, если он не установлен
     }
     
-    // Assert - проверяем, что временные файлы были удалены (это часть логики)
-    // Основная проверка - метод не падает при валидных данных
-    assert_true(threads.size() == speedups.size(), 
-                "plot_speedup принимает векторы одинакового размера");
+    // Assert - данные передаются через канал, временных файлов в рабочем каталоге нет
+    assert_true(!std::ifstream("speedup_data.txt").is_open() && !std::ifstream("plot_speedup.gp").is_open(),
+                "plot_speedup не создает временных файлов");
 }
 
+/**
+ * @brief Тест: Скрипт со встроенными данными
+ * AAA: Arrange - готовим данные, Act - формируем скрипт, Assert - проверяем блок данных и имя файла
+ */
+void test_speedup_script_inline_data() {
+    test_group("Скрипт со встроенными данными");
+    
+    // Arrange
+    std::vector<int> threads = {1, 2, 4};
+    std::vector<double> speedups = {1.0, 1.9, 3.5};
+    
+    // Act
+    std::string script = GnuplotVisualizer::speedup_script(threads, speedups, "it's.png");
+    
+    // Assert
+    assert_true(script.find("$speedup << EOD\n1 1\n2 1.9\n4 3.5\nEOD\n") != std::string::npos,
+                "Данные встроены в скрипт блоком $speedup");
+    assert_true(script.find("set output 'it''s.png'") != std::string::npos, "Кавычка в имени файла экранирована");
+    assert_true(script.find("unset output") != std::string::npos, "Файл закрывается в конце скрипта");
+}
+
+/**
+ * @brief Тест: Скрипт графиков масштабируемости
+ * AAA: Arrange - две серии повторных измерений, Act - формируем скрипт, Assert - проверяем блоки и полосы
+ */
+void test_scaling_script_series() {
+    test_group("Скрипт графиков масштабируемости");
+    
+    // Arrange
+    std::vector<int> threads = {1, 2, 4};
+    std::vector<ScalingSeries> series = {
+        ScalingAnalysis::analyze("25 узлов", threads, {{10.0, 12.0}, {6.0, 7.0}, {4.0, 5.0}}),
+        ScalingAnalysis::analyze("100%", threads, {{20.0}, {10.0}, {5.0}})
+    };
+    
+    // Act
+    std::string confidence = GnuplotVisualizer::scaling_script(series, "scaling.png");
+    std::string min_max = GnuplotVisualizer::scaling_script(series, "scaling.png", ScalingBand::MinMax);
+    
+    // Assert
+    assert_true(confidence.find("$scaling0 << EOD\n1 1 ") != std::string::npos &&
+                confidence.find("$scaling1 << EOD\n") != std::string::npos, "Блок данных на каждую серию");
+    assert_true(confidence.find(" NaN\n") != std::string::npos, "Карп-Флэтт для одного потока пропускается");
+    assert_true(confidence.find("'100%%: Амдал, f = %.3f'") != std::string::npos, "Процент в подписи экранирован");
+    assert_true(confidence.find("set multiplot layout 1,3") != std::string::npos, "Три панели");
+    assert_true(confidence.find("доверительный интервал") != std::string::npos &&
+                min_max.find("минимум и максимум") != std::string::npos, "Полоса выбирается параметром");
+    assert_throws<std::invalid_argument>([&]() { GnuplotVisualizer::scaling_script({}, "scaling.png"); },
+                                         "Нет серий");
+}
+
+/**
+ * @brief Тест: Скрипт интерполянта с двоичными данными
+ * AAA: Arrange - кривая из миллиона точек, Act - формируем скрипт, Assert - проверяем прореживание и размер данных
+ */
+void test_interpolation_script_binary_data() {
+    test_group("Скрипт интерполянта с двоичными данными");
+    
+    // Arrange
+    std::vector<double> nodes_x = {0.0, 0.5, 1.0};
+    std::vector<double> nodes_y = {0.0, 0.25, 1.0};
+    std::vector<double> curve_x(1000000);
+    std::vector<double> curve_y(curve_x.size());
+    for (size_t i = 0; i < curve_x.size(); i++) {
+        curve_x[i] = static_cast<double>(i) / static_cast<double>(curve_x.size() - 1);
+        curve_y[i] = curve_x[i] * curve_x[i];
+    }
+    std::vector<double> empty;
+    std::vector<double> single = {0.0};
+    CurvePlotOptions options;
+    options.width = 400;
+    
+    // Act
+    std::string script = GnuplotVisualizer::interpolation_script(nodes_x, nodes_y, curve_x, curve_y,
+                                                                 "curve.png", options);
+    size_t data_begin = script.find("'Узлы'\n") + std::string("'Узлы'\n").size();
+    size_t data_end = script.rfind("unset output\n");
+    size_t curve_records = (data_end - data_begin) / (2 * sizeof(double)) - nodes_x.size();
+    
+    // Assert
+    assert_true(script.find("'-' binary record=(3) format='%float64%float64'") != std::string::npos,
+                "Узлы передаются двоичными записями");
+    assert_true(script.find("binary record=(" + std::to_string(curve_records) + ")") != std::string::npos,
+                "Число записей кривой указано в команде plot");
+    assert_true(curve_records <= 4 * options.width, "Кривая прорежена до ширины изображения");
+    assert_true((data_end - data_begin) % (2 * sizeof(double)) == 0, "Данные - целые записи (x, y)");
+    assert_true(script.find("set terminal pngcairo size 400,800") != std::string::npos, "Размер изображения");
+    assert_throws<std::invalid_argument>([&]() {
+        GnuplotVisualizer::interpolation_script(nodes_x, nodes_y, empty, empty, "curve.png");
+    }, "Пустая кривая");
+    assert_throws<std::invalid_argument>([&]() {
+        GnuplotVisualizer::interpolation_script(nodes_x, single, curve_x, curve_y, "curve.png");
+    }, "Разные размеры векторов узлов");
+}
+
+#ifndef _WIN32
+/**
+ * @brief Тест: Сессия передает скрипты одному процессу по порядку
+ * AAA: Arrange - запускаем вместо gnuplot cat в файл, Act - отправляем графики асинхронно, Assert - проверяем порядок
+ */
+void test_gnuplot_session_single_process() {
+    test_group("Сессия передает скрипты одному процессу по порядку");
+    
+    // Arrange
+    std::vector<int> threads = {1, 2};
+    GnuplotSession session(true, "cat > test_gnuplot_capture.txt");
+    
+    // Act
+    for (int i = 0; i < 3; i++) {
+        GnuplotVisualizer::plot_speedup(session, threads, {1.0, 1.5 + i}, "plot" + std::to_string(i) + ".png");
+    }
+    session.wait();
+    session.close();
+    std::ifstream capture("test_gnuplot_capture.txt");
+    std::string text((std::istreambuf_iterator<char>(capture)), std::istreambuf_iterator<char>());
+    
+    // Assert
+    size_t first = text.find("'plot0.png'");
+    size_t second = text.find("'plot1.png'");
+    size_t third = text.find("'plot2.png'");
+    assert_true(session.is_asynchronous(), "Сессия асинхронная");
+    assert_true(first != std::string::npos && first < second && second < third,
+                "Все скрипты получены одним процессом в порядке отправки");
+    assert_throws<std::logic_error>([&]() { session.submit("reset\n"); }, "Закрытая сессия не принимает скрипты");
+    
+    capture.close();
+    std::remove("test_gnuplot_capture.txt");
+}
+
+/**
+ * @brief Тест: Завершившийся gnuplot сообщает об ошибке
+ * AAA: Arrange - запускаем процесс, который сразу завершается, Act - отправляем скрипт, Assert - проверяем исключение
+ */
+void test_gnuplot_session_failed_process() {
+    test_group("Завершившийся gnuplot сообщает об ошибке");
+    
+    // Arrange
+    std::string script(1 << 20, '#');
+    
+    // Act & Assert
+    assert_throws<std::runtime_error>(
+        [&]() {
+            GnuplotSession session(false, "exit 3");
+            session.submit(script);
+            session.close();
+        },
+        "Ошибка записи или ненулевой код завершения без аварийного SIGPIPE");
+}
+#endif
+
 /**
  * @brief Тест: plot_speedup с пустыми векторами
  * AAA: Arrange - готовим пустые данные, Act - вызываем plot_speedup, Assert - проверяем исключение
@@ -72,6 +223,34 @@ void test_plot_speedup_mismatched_sizes() {
     );
 }
 
+/**
+ * @brief Тест: plot_speedup_with_utilization с невалидными данными
+ * AAA: Arrange - готовим пустую телеметрию и разные размеры, Act - вызываем метод, Assert - проверяем исключения
+ */
+void test_plot_speedup_with_utilization_invalid() {
+    test_group("plot_speedup_with_utilization с невалидными данными");
+    
+    // Arrange
+    std::vector<int> threads = {1, 2, 4};
+    std::vector<double> speedups = {1.0, 1.8, 3.1};
+    std::vector<double> short_speedups = {1.0, 1.8};
+    BatchTelemetry empty;
+    BatchTelemetry telemetry;
+    telemetry.wall_ms = 1.0;
+    telemetry.threads.resize(2);
+    std::string filename = "test_utilization.png";
+    
+    // Act & Assert
+    assert_throws<std::invalid_argument>(
+        [&]() { GnuplotVisualizer::plot_speedup_with_utilization(threads, speedups, empty, filename); },
+        "Исключение для пустой телеметрии"
+    );
+    assert_throws<std::invalid_argument>(
+        [&]() { GnuplotVisualizer::plot_speedup_with_utilization(threads, short_speedups, telemetry, filename); },
+        "Исключение при несовпадающих размерах"
+    );
+}
+
 /**
  * @brief Тест: plot_speedup с одним элементом
  * AAA: Arrange - готовим минимальные данные, Act - вызываем plot_speedup, Assert - проверяем обработку
@@ -146,8 +325,16 @@ void run_gnuplot_visualizer_tests() {
     std::cout << "\n=== Тесты GnuplotVisualizer ===\n";
     
     test_plot_speedup_creates_files();
+    test_speedup_script_inline_data();
+    test_scaling_script_series();
+    test_interpolation_script_binary_data();
+#ifndef _WIN32
+    test_gnuplot_session_single_process();
+    test_gnuplot_session_failed_process();
+#endif
     test_plot_speedup_empty_vectors();
     test_plot_speedup_mismatched_sizes();
+    test_plot_speedup_with_utilization_invalid();
     test_plot_speedup_single_element();
     test_plot_speedup_large_dataset();
     test_plot_speedup_negative_values();
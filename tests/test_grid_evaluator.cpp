@@ -0,0 +1,96 @@
+/**
+ * @file test_grid_evaluator.cpp
+ * @brief Модульные тесты для класса GridEvaluator и interpolate_grid
+ */
+
+#include "test_grid_evaluator.h"
+#include "test_utils.h"
+#include "../src/core/grid_evaluator.h"
+#include "../src/core/newton_interpolator.h"
+#include <cmath>
+#include <stdexcept>
+
+/**
+ * @brief Тест: Выбор между шаганием и прямым вычислением
+ * AAA: Arrange - задаем допуск, Act - проверяем степени, Assert - низкие степени шагают, высокие нет
+ */
+void test_grid_stable_steps() {
+    test_group("Длина участка шагания по разностям");
+    
+    // Act & Assert
+    assert_true(GridEvaluator::uses_forward_differences(3, 1e-9), 
+                "Для степени 3 используется шагание по разностям");
+    assert_true(!GridEvaluator::uses_forward_differences(24, 1e-9), 
+                "Для степени 24 шагание неустойчиво, используется прямое вычисление");
+    assert_true(GridEvaluator::max_stable_steps(3, 1e-6) > GridEvaluator::max_stable_steps(3, 1e-9),
+                "Больший допуск дает более длинные участки");
+}
+
+/**
+ * @brief Тест: Сетка совпадает с вычислением в сгенерированных точках
+ * AAA: Arrange - готовим кубическую таблицу, Act - вычисляем на сетке, Assert - сравниваем с interpolate_multiple
+ */
+void test_grid_matches_points() {
+    test_group("interpolate_grid совпадает с interpolate_multiple");
+    
+    // Arrange
+    std::vector<double> x = {0.0, 1.0, 2.5, 4.0};
+    std::vector<double> y = {1.0, -2.0, 3.0, 0.5};
+    NewtonInterpolator interpolator(x, y);
+    const size_t count = 100001;
+    std::vector<double> points = NewtonInterpolator::generate_points(-1.0, 5.0, count);
+    
+    // Act
+    std::vector<double> grid = interpolator.interpolate_grid(-1.0, 5.0, count);
+    
+    // Assert
+    std::vector<double> expected = interpolator.interpolate_multiple(points);
+    double max_error = 0.0;
+    double max_value = 0.0;
+    for (size_t i = 0; i < count; i++) {
+        max_error = std::max(max_error, std::abs(grid[i] - expected[i]));
+        max_value = std::max(max_value, std::abs(expected[i]));
+    }
+    assert_true(grid.size() == count, "interpolate_grid возвращает count значений");
+    assert_true(max_error <= 1e-8 * max_value, "Шагание по разностям укладывается в допуск");
+}
+
+/**
+ * @brief Тест: Высокая степень и другие режимы
+ * AAA: Arrange - готовим таблицу из 25 узлов, Act - вычисляем на сетке в разных режимах, Assert - сравниваем
+ */
+void test_grid_fallback_modes() {
+    test_group("interpolate_grid при высокой степени и в других режимах");
+    
+    // Arrange
+    std::vector<double> x;
+    std::vector<double> y;
+    for (int i = 0; i < 25; i++) {
+        x.push_back(0.4 * i);
+        y.push_back(std::sin(0.4 * i));
+    }
+    NewtonInterpolator newton(x, y);
+    NewtonInterpolator barycentric(x, y, InterpolationMethod::Barycentric);
+    std::vector<double> points = NewtonInterpolator::generate_points(0.0, 9.6, 1000);
+    
+    // Act & Assert
+    assert_vector_equal(newton.interpolate_grid(0.0, 9.6, 1000), newton.interpolate_multiple(points), 1e-12,
+                        "При высокой степени результат совпадает с прямым вычислением");
+    assert_vector_equal(barycentric.interpolate_grid(0.0, 9.6, 1000), barycentric.interpolate_multiple(points), 1e-12,
+                        "В барицентрическом режиме сетка вычисляется напрямую");
+    assert_throws<std::invalid_argument>(
+        [&]() { newton.interpolate_grid(0.0, 1.0, 1); },
+        "interpolate_grid выбрасывает исключение при менее чем 2 точках"
+    );
+}
+
+/**
+ * @brief Запуск всех тестов для GridEvaluator
+ */
+void run_grid_evaluator_tests() {
+    std::cout << "\n=== Тесты GridEvaluator ===\n";
+    
+    test_grid_stable_steps();
+    test_grid_matches_points();
+    test_grid_fallback_modes();
+}
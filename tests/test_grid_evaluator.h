@@ -0,0 +1,14 @@
+/**
+ * @file test_grid_evaluator.h
+ * @brief Объявления тестов для GridEvaluator
+ */
+
+#ifndef TEST_GRID_EVALUATOR_H
+#define TEST_GRID_EVALUATOR_H
+
+/**
+ * @brief Запуск всех тестов для GridEvaluator
+ */
+void run_grid_evaluator_tests();
+
+#endif // TEST_GRID_EVALUATOR_H
@@ -5,6 +5,27 @@
 
 #include "test_utils.h"
 #include "test_newton_interpolator.h"
+#include "test_divided_difference_engine.h"
+#include "test_evaluation_kernels.h"
+#include "test_batch_evaluator.h"
+#include "test_barycentric_engine.h"
+#include "test_piecewise_engine.h"
+#include "test_grid_evaluator.h"
+#include "test_polynomial_forms.h"
+#include "test_multi_table_interpolator.h"
+#include "test_basic_newton_interpolator.h"
+#include "test_fixed_newton_interpolator.h"
+#include "test_parallel_scheduler.h"
+#include "test_autotuner.h"
+#include "test_benchmark.h"
+#include "test_perf_counters.h"
+#include "test_batch_telemetry.h"
+#include "test_mapped_binary_file.h"
+#include "test_streaming_evaluator.h"
+#include "test_text_table_loader.h"
+#include "test_curve_decimator.h"
+#include "test_scaling_analysis.h"
+#include "test_accuracy_verifier.h"
 #include "test_gnuplot_visualizer.h"
 #include <iostream>
 
@@ -22,6 +43,27 @@ int main() {
     
     // Запускаем все тесты
     run_newton_interpolator_tests();
+    run_divided_difference_engine_tests();
+    run_evaluation_kernels_tests();
+    run_batch_evaluator_tests();
+    run_barycentric_engine_tests();
+    run_piecewise_engine_tests();
+    run_grid_evaluator_tests();
+    run_polynomial_forms_tests();
+    run_multi_table_interpolator_tests();
+    run_basic_newton_interpolator_tests();
+    run_fixed_newton_interpolator_tests();
+    run_parallel_scheduler_tests();
+    run_autotuner_tests();
+    run_benchmark_tests();
+    run_perf_counters_tests();
+    run_batch_telemetry_tests();
+    run_mapped_binary_file_tests();
+    run_streaming_evaluator_tests();
+    run_text_table_loader_tests();
+    run_curve_decimator_tests();
+    run_scaling_analysis_tests();
+    run_accuracy_verifier_tests();
     run_gnuplot_visualizer_tests();
     
     // Выводим итоги
@@ -0,0 +1,144 @@
+/**
+ * @file test_mapped_binary_file.cpp
+ * @brief Модульные тесты для двоичного формата и отображения файлов в память
+ */
+
+#include "test_mapped_binary_file.h"
+#include "test_utils.h"
+#include "../src/core/mapped_binary_file.h"
+#include "../src/core/newton_interpolator.h"
+#include <cmath>
+#include <cstdint>
+#include <cstdio>
+#include <fstream>
+
+/**
+ * @brief Тест: Таблица с коэффициентами
+ * AAA: Arrange - записываем таблицу и коэффициенты, Act - открываем и загружаем в интерполятор, Assert - сверяем
+ */
+void test_mapped_table_round_trip() {
+    test_group("Таблица с коэффициентами");
+    
+    // Arrange
+    std::vector<double> x;
+    std::vector<double> y;
+    for (int i = 0; i < 20; i++) {
+        x.push_back(0.5 * i);
+        y.push_back(std::cos(0.5 * i));
+    }
+    NewtonInterpolator reference(x, y);
+    const AlignedVector<double>& coefficients = reference.get_coefficients();
+    MappedBinaryFile::write_table("test_table.bin", x, y,
+                                  std::span<const double>(coefficients.data(), coefficients.size()));
+    std::vector<double> points = NewtonInterpolator::generate_points(0.0, 9.5, 1000);
+    
+    // Act
+    MappedBinaryFile table = MappedBinaryFile::open("test_table.bin");
+    NewtonInterpolator interpolator;
+    interpolator.set_data(table.get_x(), table.get_y(), table.get_coefficients());
+    
+    // Assert
+    assert_true(table.get_kind() == BinaryArrayKind::Table && table.get_count() == 20,
+                "Заголовок хранит вид и количество узлов");
+    assert_true(table.is_sorted() && table.has_coefficients(), "Флаги отсортированности и коэффициентов");
+    assert_true(reinterpret_cast<uintptr_t>(table.get_y().data()) % BINARY_ARRAY_ALIGNMENT == 0,
+                "Массивы выровнены на 64 байта");
+    assert_vector_equal(interpolator.interpolate_multiple(points), reference.interpolate_multiple(points), 1e-12,
+                        "Готовые коэффициенты дают те же значения");
+    interpolator.add_node(10.0, std::cos(10.0));
+    reference.add_node(10.0, std::cos(10.0));
+    assert_vector_equal(interpolator.interpolate_multiple(points), reference.interpolate_multiple(points), 1e-9,
+                        "add_node после загрузки коэффициентов восстанавливает диагональ");
+    
+    std::remove("test_table.bin");
+}
+
+/**
+ * @brief Тест: Точки и результаты без копирования
+ * AAA: Arrange - записываем точки, Act - вычисляем в созданный файл результатов, Assert - перечитываем
+ */
+void test_mapped_points_and_results() {
+    test_group("Точки и результаты без копирования");
+    
+    // Arrange
+    NewtonInterpolator interpolator({0.0, 1.0, 2.0, 3.0}, {1.0, 2.0, 5.0, 10.0});
+    std::vector<double> points = {3.0, 0.5, 2.5, 1.5, 0.0};
+    MappedBinaryFile::write_array("test_points.bin", BinaryArrayKind::Points, points);
+    
+    // Act
+    {
+        MappedBinaryFile queries = MappedBinaryFile::open("test_points.bin");
+        MappedBinaryFile results = MappedBinaryFile::create("test_results.bin", BinaryArrayKind::Results,
+                                                            queries.get_count());
+        interpolator.interpolate_into(queries.get_values(), results.get_mutable_values());
+        results.flush();
+    }
+    MappedBinaryFile results = MappedBinaryFile::open("test_results.bin");
+    
+    // Assert
+    std::vector<double> values(results.get_values().begin(), results.get_values().end());
+    assert_vector_equal(values, interpolator.interpolate_multiple(points), 1e-12,
+                        "Результаты записаны прямо в файл");
+    assert_true(results.get_kind() == BinaryArrayKind::Results && !results.is_sorted(),
+                "Файл результатов с флагом отсортированности по содержимому");
+    assert_throws<std::logic_error>([&]() { results.get_mutable_values(); },
+                                    "Файл, открытый на чтение, не дает изменяемых значений");
+    assert_throws<std::logic_error>([&]() { results.get_x(); }, "У файла результатов нет таблицы");
+    
+    std::remove("test_points.bin");
+    std::remove("test_results.bin");
+}
+
+/**
+ * @brief Тест: Некорректные файлы и аргументы
+ * AAA: Arrange - готовим поврежденные файлы, Act - открываем, Assert - проверяем исключения
+ */
+void test_mapped_invalid_files() {
+    test_group("Некорректные файлы и аргументы");
+    
+    // Arrange
+    {
+        std::ofstream garbage("test_garbage.bin", std::ios::binary);
+        garbage << std::string(128, 'x');
+    }
+    std::vector<double> values(100, 1.0);
+    MappedBinaryFile::write_array("test_truncated.bin", BinaryArrayKind::Points, values);
+    {
+        std::ifstream source("test_truncated.bin", std::ios::binary);
+        std::string bytes((std::istreambuf_iterator<char>(source)), std::istreambuf_iterator<char>());
+        std::ofstream truncated("test_truncated.bin", std::ios::binary | std::ios::trunc);
+        truncated.write(bytes.data(), 200);
+    }
+    
+    // Act & Assert
+    assert_throws<std::runtime_error>([]() { MappedBinaryFile::open("test_garbage.bin"); },
+                                      "Неверная сигнатура");
+    assert_throws<std::runtime_error>([]() { MappedBinaryFile::open("test_truncated.bin"); },
+                                      "Обрезанный файл");
+    assert_throws<std::runtime_error>([]() { MappedBinaryFile::open("test_missing.bin"); },
+                                      "Отсутствующий файл");
+    std::vector<double> x = {2.0, 1.0};
+    std::vector<double> y = {0.0, 1.0};
+    std::vector<double> c = {0.0, 1.0};
+    assert_throws<std::invalid_argument>([&]() { MappedBinaryFile::write_table("test_bad.bin", x, y, c); },
+                                         "Коэффициенты для неотсортированных узлов");
+    NewtonInterpolator interpolator;
+    assert_throws<std::invalid_argument>(
+        [&]() { interpolator.set_data(std::span<const double>(x), std::span<const double>(y),
+                                      std::span<const double>(c)); },
+        "set_data с коэффициентами требует отсортированных узлов");
+    
+    std::remove("test_garbage.bin");
+    std::remove("test_truncated.bin");
+}
+
+/**
+ * @brief Запуск всех тестов для MappedBinaryFile
+ */
+void run_mapped_binary_file_tests() {
+    std::cout << "\n=== Тесты MappedBinaryFile ===\n";
+    
+    test_mapped_table_round_trip();
+    test_mapped_points_and_results();
+    test_mapped_invalid_files();
+}
@@ -0,0 +1,14 @@
+/**
+ * @file test_mapped_binary_file.h
+ * @brief Объявления тестов для MappedBinaryFile
+ */
+
+#ifndef TEST_MAPPED_BINARY_FILE_H
+#define TEST_MAPPED_BINARY_FILE_H
+
+/**
+ * @brief Запуск всех тестов для MappedBinaryFile
+ */
+void run_mapped_binary_file_tests();
+
+#endif // TEST_MAPPED_BINARY_FILE_H
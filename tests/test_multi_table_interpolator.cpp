@@ -0,0 +1,125 @@
+/**
+ * @file test_multi_table_interpolator.cpp
+ * @brief Модульные тесты для пакетной интерполяции множества таблиц
+ */
+
+#include "test_multi_table_interpolator.h"
+#include "test_utils.h"
+#include "../src/core/multi_table_interpolator.h"
+#include "../src/core/newton_interpolator.h"
+#include <cmath>
+#include <omp.h>
+#include <stdexcept>
+
+/**
+ * @brief Тест: Каждая таблица совпадает с отдельным NewtonInterpolator
+ * AAA: Arrange - готовим 300 таблиц по 25 узлов, Act - вычисляем пакетом, Assert - сравниваем с эталоном
+ */
+void test_multi_table_matches_single() {
+    test_group("Пакет таблиц совпадает с отдельными интерполяторами");
+    
+    // Arrange - 300 таблиц дают неполный последний блок
+    const size_t tables = 300;
+    std::vector<std::vector<double>> x(tables);
+    std::vector<std::vector<double>> y(tables);
+    for (size_t t = 0; t < tables; t++) {
+        for (int i = 24; i >= 0; i--) {
+            double xi = 0.2 * i + 0.001 * t;
+            x[t].push_back(xi);
+            y[t].push_back(std::sin(xi + 0.01 * t));
+        }
+    }
+    std::vector<double> points = NewtonInterpolator::generate_points(0.0, 4.8, 37);
+    int saved_threads = omp_get_max_threads();
+    omp_set_num_threads(4);
+    
+    // Act
+    MultiTableInterpolator batch(x, y);
+    std::vector<double> results = batch.interpolate_multiple(points);
+    omp_set_num_threads(saved_threads);
+    
+    // Assert
+    assert_true(batch.get_table_count() == tables && batch.get_node_count() == 25,
+                "Размеры пакета соответствуют входным данным");
+    bool all_match = results.size() == points.size() * tables;
+    for (size_t t = 0; t < tables && all_match; t += 7) {
+        NewtonInterpolator single(x[t], y[t]);
+        for (size_t p = 0; p < points.size(); p++) {
+            double expected = single.interpolate(points[p]);
+            if (std::abs(results[p * tables + t] - expected) > 1e-9 * (1.0 + std::abs(expected)) ||
+                std::abs(batch.interpolate(t, points[p]) - expected) > 1e-9 * (1.0 + std::abs(expected))) {
+                all_match = false;
+            }
+        }
+        if (std::abs(batch.get_coefficient(t, 24) - single.get_coefficients()[24]) >
+            1e-9 * (1.0 + std::abs(single.get_coefficients()[24]))) {
+            all_match = false;
+        }
+    }
+    assert_true(all_match, "Значения и коэффициенты совпадают с NewtonInterpolator");
+}
+
+/**
+ * @brief Тест: Интерполяция проходит через узлы каждой таблицы
+ * AAA: Arrange - готовим две неотсортированные таблицы, Act - вычисляем в узлах, Assert - проверяем y
+ */
+void test_multi_table_passes_through_nodes() {
+    test_group("Интерполяция проходит через узлы");
+    
+    // Arrange
+    std::vector<std::vector<double>> x = {{2.0, 0.0, 1.0}, {5.0, 3.0, 4.0}};
+    std::vector<std::vector<double>> y = {{4.0, 0.0, 1.0}, {-1.0, 2.0, 7.0}};
+    MultiTableInterpolator batch(x, y);
+    
+    // Act
+    std::vector<double> results = batch.interpolate_multiple({0.0, 4.0});
+    
+    // Assert
+    assert_double_equal(results[0], 0.0, 1e-12, "Первая таблица в x = 0");
+    assert_double_equal(results[3], 7.0, 1e-12, "Вторая таблица в x = 4");
+    assert_double_equal(batch.interpolate(0, 1.5), 2.25, 1e-12, "Первая таблица воспроизводит x^2");
+}
+
+/**
+ * @brief Тест: Обработка некорректных данных
+ * AAA: Arrange - готовим ошибочные наборы, Act - устанавливаем таблицы, Assert - ожидаем исключения
+ */
+void test_multi_table_invalid_input() {
+    test_group("Обработка некорректных данных");
+    
+    // Arrange
+    MultiTableInterpolator batch;
+    std::vector<std::vector<double>> ragged_x = {{0.0, 1.0}, {0.0, 1.0, 2.0}};
+    std::vector<std::vector<double>> ragged_y = {{0.0, 1.0}, {0.0, 1.0, 2.0}};
+    std::vector<std::vector<double>> duplicate_x = {{0.0, 1.0}, {1.0, 1.0}};
+    std::vector<std::vector<double>> duplicate_y = {{0.0, 1.0}, {2.0, 3.0}};
+    
+    // Act & Assert
+    assert_throws<std::invalid_argument>(
+        [&]() { batch.set_tables(ragged_x, ragged_y); },
+        "Таблицы разного размера вызывают исключение"
+    );
+    assert_throws<std::runtime_error>(
+        [&]() { batch.set_tables(duplicate_x, duplicate_y); },
+        "Повторяющийся узел вызывает исключение"
+    );
+    assert_throws<std::runtime_error>(
+        [&]() { batch.interpolate_multiple({0.5}); },
+        "Вычисление без данных вызывает исключение"
+    );
+    assert_throws<std::out_of_range>(
+        [&]() { batch.interpolate(0, 0.5); },
+        "Номер таблицы вне диапазона вызывает исключение"
+    );
+}
+
+/**
+ * @brief Запуск всех тестов для MultiTableInterpolator
+ */
+void run_multi_table_interpolator_tests() {
+    std::cout << "\n=== Тесты MultiTableInterpolator ===\n";
+    
+    test_multi_table_matches_single();
+    test_multi_table_passes_through_nodes();
+    test_multi_table_invalid_input();
+}
@@ -0,0 +1,14 @@
+/**
+ * @file test_multi_table_interpolator.h
+ * @brief Объявления тестов для MultiTableInterpolator
+ */
+
+#ifndef TEST_MULTI_TABLE_INTERPOLATOR_H
+#define TEST_MULTI_TABLE_INTERPOLATOR_H
+
+/**
+ * @brief Запуск всех тестов для MultiTableInterpolator
+ */
+void run_multi_table_interpolator_tests();
+
+#endif // TEST_MULTI_TABLE_INTERPOLATOR_H
@@ -391,6 +391,176 @@ void test_interpolate_extrapolation() {
                 "Экстраполяция вправо возвращает конечное значение");
 }
 
+/**
+ * @brief Тест: add_node дает тот же полином, что и set_data
+ * AAA: Arrange - готовим узлы, Act - добавляем их по одному, Assert - сравниваем с полным пересчетом
+ */
+void test_add_node_matches_set_data() {
+    test_group("Инкрементальное добавление узлов");
+    
+    // Arrange
+    std::vector<double> x = {0.0, 0.7, 1.5, 2.0, 3.1, 4.0};
+    std::vector<double> y = {1.0, -2.0, 0.5, 3.0, 1.0, -1.0};
+    NewtonInterpolator reference(x, y);
+    NewtonInterpolator incremental;
+    
+    // Act
+    for (size_t i = 0; i < x.size(); i++) {
+        incremental.add_node(x[i], y[i]);
+    }
+    
+    // Assert
+    assert_true(incremental.get_node_count() == x.size(), 
+                "add_node увеличивает количество узлов");
+    std::vector<double> points = NewtonInterpolator::generate_points(0.0, 4.0, 17);
+    assert_vector_equal(incremental.interpolate_multiple(points), reference.interpolate_multiple(points), 1e-9,
+                        "Полином после add_node совпадает с полиномом set_data");
+}
+
+/**
+ * @brief Тест: add_node с уже существующим узлом
+ * AAA: Arrange - создаем интерполятор, Act - добавляем дубликат, Assert - проверяем исключение
+ */
+void test_add_node_duplicate() {
+    test_group("add_node с совпадающим узлом");
+    
+    // Arrange
+    NewtonInterpolator interpolator({0.0, 1.0, 2.0}, {1.0, 2.0, 3.0});
+    
+    // Act & Assert
+    assert_throws<std::runtime_error>(
+        [&]() { interpolator.add_node(1.0, 5.0); },
+        "add_node выбрасывает исключение при совпадающем узле"
+    );
+    assert_true(interpolator.get_node_count() == 3, 
+                "Неудачный add_node не меняет количество узлов");
+}
+
+/**
+ * @brief Тест: Скользящее окно хранит только последние k узлов
+ * AAA: Arrange - задаем окно, Act - подаем длинный поток узлов, Assert - сравниваем с интерполятором по последним k узлам
+ */
+void test_sliding_window() {
+    test_group("Скользящее окно");
+    
+    // Arrange
+    const size_t k = 5;
+    NewtonInterpolator streaming;
+    streaming.set_window_size(k);
+    std::vector<double> x;
+    std::vector<double> y;
+    
+    // Act - поток в 4 раза длиннее окна, с полными пересчетами по пути
+    for (int i = 0; i < 23; i++) {
+        double xi = 0.5 * i;
+        x.push_back(xi);
+        y.push_back(std::sin(xi));
+        streaming.add_node(xi, std::sin(xi));
+    }
+    
+    // Assert
+    assert_true(streaming.get_node_count() == k, 
+                "В окне остается ровно k узлов");
+    NewtonInterpolator reference(std::vector<double>(x.end() - k, x.end()),
+                                 std::vector<double>(y.end() - k, y.end()));
+    std::vector<double> points = NewtonInterpolator::generate_points(x[x.size() - k], x.back(), 9);
+    assert_vector_equal(streaming.interpolate_multiple(points), reference.interpolate_multiple(points), 1e-9,
+                        "Полином окна совпадает с полиномом по последним k узлам");
+    
+    streaming.set_window_size(3);
+    assert_true(streaming.get_node_count() == 3, 
+                "Уменьшение окна удаляет самые старые узлы");
+    assert_double_equal(streaming.interpolate(x.back()), y.back(), 1e-9,
+                        "После уменьшения окна последний узел интерполируется точно");
+}
+
+/**
+ * @brief Тест: Учет времени подготовки и вычисления
+ * AAA: Arrange - создаем интерполятор, Act - вычисляем пакет точек, Assert - проверяем счетчики
+ */
+void test_timings() {
+    test_group("Время этапов");
+    
+    // Arrange
+    std::vector<double> x = {0.0, 1.0, 2.0, 3.0};
+    std::vector<double> y = {1.0, 3.0, 2.0, 5.0};
+    NewtonInterpolator interpolator(x, y);
+    std::vector<double> points = NewtonInterpolator::generate_points(0.0, 3.0, 100);
+    
+    // Act
+    interpolator.interpolate_multiple(points);
+    interpolator.interpolate_multiple(points);
+    InterpolationTimings timings = interpolator.get_timings();
+    
+    // Assert
+    assert_true(timings.setup_calls == 1, "Учтен один вызов set_data");
+    assert_true(timings.evaluation_calls == 2 && timings.evaluated_points == 200,
+                "Учтены оба вызова interpolate_multiple и все точки");
+    assert_true(timings.sort_ms >= 0.0 && timings.coefficients_ms >= 0.0 && timings.evaluation_ms > 0.0,
+                "Время этапов неотрицательно");
+    
+    interpolator.reset_timings();
+    assert_true(interpolator.get_timings().evaluation_calls == 0, "reset_timings обнуляет счетчики");
+}
+
+/**
+ * @brief Тест: Вычисление в заранее выделенный буфер
+ * AAA: Arrange - готовим интерполятор и буферы, Act - вычисляем через span, Assert - проверяем статусы
+ */
+void test_interpolate_into() {
+    test_group("Вычисление в заранее выделенный буфер");
+    
+    // Arrange
+    std::vector<double> x = {0.0, 1.0, 2.0, 3.0};
+    std::vector<double> y = {1.0, 3.0, 2.0, 5.0};
+    NewtonInterpolator interpolator(x, y);
+    NewtonInterpolator empty;
+    std::vector<double> points = NewtonInterpolator::generate_points(0.0, 3.0, 50);
+    std::vector<double> results(points.size());
+    std::vector<double> short_results(3, 7.0);
+    
+    // Act
+    InterpolationStatus ok = interpolator.interpolate_into(points, results);
+    InterpolationStatus mismatch = interpolator.interpolate_into(points, short_results);
+    InterpolationStatus not_initialized = empty.interpolate_into(std::span<const double>(points).first(3),
+                                                                 short_results);
+    
+    // Assert
+    assert_true(ok == InterpolationStatus::Ok, "Статус Ok для корректного вызова");
+    assert_vector_equal(results, interpolator.interpolate_multiple(points), 1e-15,
+                        "Результаты совпадают с interpolate_multiple");
+    assert_true(mismatch == InterpolationStatus::SizeMismatch, "Несовпадение размеров сообщается статусом");
+    assert_true(not_initialized == InterpolationStatus::NotInitialized && std::isnan(short_results[0]),
+                "Без данных возвращается статус NotInitialized и NaN");
+}
+
+/**
+ * @brief Тест: Повторная установка данных через span
+ * AAA: Arrange - готовим отсортированную и перемешанную таблицы, Act - устанавливаем их по очереди,
+ * Assert - проверяем полином
+ */
+void test_set_data_span_reuse() {
+    test_group("Повторная установка данных через span");
+    
+    // Arrange
+    double sorted_x[] = {0.0, 1.0, 2.0};
+    double sorted_y[] = {0.0, 1.0, 4.0};
+    double shuffled_x[] = {2.0, 0.0, 1.0};
+    double shuffled_y[] = {5.0, 1.0, 2.0};
+    NewtonInterpolator interpolator;
+    
+    // Act
+    interpolator.set_data(std::span<const double>(sorted_x), std::span<const double>(sorted_y));
+    double square = interpolator.interpolate(3.0);
+    interpolator.set_data(std::span<const double>(shuffled_x), std::span<const double>(shuffled_y));
+    double shifted = interpolator.interpolate(3.0);
+    
+    // Assert
+    assert_double_equal(square, 9.0, 1e-12, "Отсортированная таблица воспроизводит x^2");
+    assert_double_equal(shifted, 10.0, 1e-12, "Перемешанная таблица воспроизводит x^2 + 1");
+    assert_true(interpolator.get_node_count() == 3, "Количество узлов равно 3");
+}
+
 /**
  * @brief Запуск всех тестов для NewtonInterpolator
  */
@@ -415,5 +585,11 @@ void run_newton_interpolator_tests() {
     test_interpolate_sin_function();
     test_get_node_count();
     test_interpolate_extrapolation();
+    test_add_node_matches_set_data();
+    test_add_node_duplicate();
+    test_sliding_window();
+    test_timings();
+    test_interpolate_into();
+    test_set_data_span_reuse();
 }
 
@@ -0,0 +1,174 @@
+/**
+ * @file test_parallel_scheduler.cpp
+ * @brief Модульные тесты для политик распределения и пула с перехватом работы
+ */
+
+#include "test_parallel_scheduler.h"
+#include "test_utils.h"
+#include "../src/core/parallel_scheduler.h"
+#include "../src/core/work_stealing_pool.h"
+#include "../src/core/newton_interpolator.h"
+#include <atomic>
+#include <cmath>
+#include <stdexcept>
+
+/**
+ * @brief Тест: Пул обрабатывает каждый индекс ровно один раз
+ * AAA: Arrange - создаем пул из 4 потоков, Act - выполняем два цикла, Assert - проверяем счетчики
+ */
+void test_pool_covers_each_index_once() {
+    test_group("Пул обрабатывает каждый индекс ровно один раз");
+    
+    // Arrange
+    WorkStealingPool pool(4);
+    const size_t count = 10007;
+    std::vector<std::atomic<int>> visits(count);
+    for (std::atomic<int>& v : visits) {
+        v.store(0);
+    }
+    auto body = [&](size_t begin, size_t end) {
+        for (size_t i = begin; i < end; i++) {
+            visits[i].fetch_add(1);
+        }
+    };
+    
+    // Act - второй цикл переиспользует те же потоки
+    pool.parallel_for(count, 16, body);
+    pool.parallel_for(count, 1, body);
+    
+    // Assert
+    bool all_twice = true;
+    for (const std::atomic<int>& v : visits) {
+        if (v.load() != 2) {
+            all_twice = false;
+        }
+    }
+    assert_true(pool.get_thread_count() == 4, "Пул содержит 4 потока");
+    assert_true(all_twice, "Каждый индекс обработан по разу в каждом цикле");
+}
+
+/**
+ * @brief Тест: Исключение из тела цикла и вложенный вызов
+ * AAA: Arrange - создаем пул, Act - бросаем исключение и вызываем пул изнутри цикла, Assert - проверяем
+ */
+void test_pool_exception_and_nesting() {
+    test_group("Исключение и вложенный вызов пула");
+    
+    // Arrange
+    WorkStealingPool pool(3);
+    std::atomic<size_t> nested_total(0);
+    auto throwing = [](size_t begin, size_t) {
+        if (begin == 0) {
+            throw std::runtime_error("ошибка в теле цикла");
+        }
+    };
+    auto nested = [&](size_t begin, size_t end) {
+        for (size_t i = begin; i < end; i++) {
+            auto inner = [&](size_t b, size_t e) { nested_total.fetch_add(e - b); };
+            pool.parallel_for(10, 1, inner);
+        }
+    };
+    
+    // Act & Assert
+    assert_throws<std::runtime_error>(
+        [&]() { pool.parallel_for(100, 1, throwing); },
+        "Исключение перебрасывается вызывающему"
+    );
+    pool.parallel_for(20, 1, nested);
+    assert_true(nested_total.load() == 200, "Вложенный цикл выполняется последовательно и полностью");
+}
+
+/**
+ * @brief Тест: Все политики дают одинаковый результат
+ * AAA: Arrange - готовим интерполятор и пул, Act - вычисляем с каждой политикой, Assert - сравниваем
+ */
+void test_schedule_policies_match() {
+    test_group("Все политики дают одинаковый результат");
+    
+    // Arrange
+    std::vector<double> x;
+    std::vector<double> y;
+    for (int i = 0; i < 25; i++) {
+        x.push_back(0.4 * i);
+        y.push_back(std::cos(0.4 * i));
+    }
+    NewtonInterpolator interpolator(x, y);
+    interpolator.set_batch_tiling(64, 1024);
+    std::vector<double> points = NewtonInterpolator::generate_points(0.0, 9.6, 5000);
+    std::vector<double> expected = interpolator.interpolate_multiple(points);
+    WorkStealingPool pool(4);
+    const SchedulePolicy policies[] = {SchedulePolicy::Static, SchedulePolicy::Dynamic,
+                                       SchedulePolicy::Guided, SchedulePolicy::WorkStealing};
+    
+    // Act & Assert
+    for (SchedulePolicy policy : policies) {
+        ParallelSchedule schedule;
+        schedule.policy = policy;
+        schedule.chunk_size = 2;
+        schedule.pool = &pool;
+        std::vector<double> results(points.size());
+        InterpolationStatus status = interpolator.interpolate_into(points, results, schedule);
+        assert_true(status == InterpolationStatus::Ok, std::string("Статус Ok: ") + ParallelScheduler::name(policy));
+        assert_vector_equal(results, expected, 1e-12,
+                            std::string("Результат совпадает: ") + ParallelScheduler::name(policy));
+    }
+    
+    ParallelSchedule shared;
+    shared.policy = SchedulePolicy::WorkStealing;
+    interpolator.set_schedule(shared);
+    assert_vector_equal(interpolator.interpolate_multiple(points), expected, 1e-12,
+                        "Общий пул по умолчанию дает тот же результат");
+    assert_true(interpolator.get_schedule().policy == SchedulePolicy::WorkStealing,
+                "Политика по умолчанию сохранена");
+}
+
+/**
+ * @brief Тест: Распределение вызова применяется в барицентрическом и кусочном режимах
+ * AAA: Arrange - интерполяторы и отдельный пул, Act - вычисляем с политикой work-stealing,
+ *      Assert - пул выполнил по одному циклу на вызов, результаты совпадают
+ */
+void test_schedule_used_by_all_methods() {
+    test_group("Распределение вызова во всех режимах");
+    
+    // Arrange
+    std::vector<double> x;
+    std::vector<double> y;
+    for (int i = 0; i < 25; i++) {
+        x.push_back(0.4 * i);
+        y.push_back(std::cos(0.4 * i));
+    }
+    std::vector<double> points = NewtonInterpolator::generate_points(0.0, 9.6, 5000);
+    WorkStealingPool pool(4);
+    ParallelSchedule schedule;
+    schedule.policy = SchedulePolicy::WorkStealing;
+    schedule.chunk_size = 2;
+    schedule.pool = &pool;
+    
+    for (InterpolationMethod method : {InterpolationMethod::Barycentric, InterpolationMethod::Piecewise}) {
+        NewtonInterpolator interpolator(x, y, method);
+        std::vector<double> expected = interpolator.interpolate_multiple(points);
+        std::vector<double> results(points.size());
+        const size_t runs_before = pool.get_run_count();
+        
+        // Act
+        InterpolationStatus status = interpolator.interpolate_into(points, results, schedule);
+        
+        // Assert
+        const std::string name = method == InterpolationMethod::Barycentric ? "барицентрический" : "кусочный";
+        assert_true(status == InterpolationStatus::Ok && pool.get_run_count() == runs_before + 1,
+                    "Пул вызова выполнил цикл: " + name);
+        assert_vector_equal(results, expected, 1e-12, "Результат совпадает: " + name);
+    }
+}
+
+/**
+ * @brief Запуск всех тестов для ParallelScheduler и WorkStealingPool
+ */
+void run_parallel_scheduler_tests() {
+    std::cout << "\n=== Тесты ParallelScheduler и WorkStealingPool ===\n";
+    
+    test_pool_covers_each_index_once();
+    test_pool_exception_and_nesting();
+    test_schedule_policies_match();
+    test_schedule_used_by_all_methods();
+}
@@ -0,0 +1,14 @@
+/**
+ * @file test_parallel_scheduler.h
+ * @brief Объявления тестов для ParallelScheduler и WorkStealingPool
+ */
+
+#ifndef TEST_PARALLEL_SCHEDULER_H
+#define TEST_PARALLEL_SCHEDULER_H
+
+/**
+ * @brief Запуск всех тестов для ParallelScheduler и WorkStealingPool
+ */
+void run_parallel_scheduler_tests();
+
+#endif // TEST_PARALLEL_SCHEDULER_H
@@ -0,0 +1,213 @@
+/**
+ * @file test_perf_counters.cpp
+ * @brief Модульные тесты для аппаратных счетчиков производительности
+ */
+
+#include "test_perf_counters.h"
+#include "test_utils.h"
+#include "../src/core/perf_counters.h"
+#include "../src/core/newton_interpolator.h"
+#include <atomic>
+#include <cmath>
+#include <omp.h>
+
+/**
+ * @brief Тест: IPC и суммирование замеров
+ * AAA: Arrange - готовим замеры вручную, Act - складываем, Assert - проверяем IPC и маску
+ */
+void test_perf_sample_arithmetic() {
+    test_group("IPC и суммирование замеров");
+    
+    // Arrange
+    PerfSample first;
+    first.values[0] = 1000;
+    first.values[1] = 2500;
+    first.available_mask = 0x3;
+    PerfSample second;
+    second.values[0] = 1000;
+    second.values[1] = 1500;
+    second.values[2] = 7;
+    second.available_mask = 0x7;
+    PerfSample empty;
+    
+    // Act
+    first += second;
+    
+    // Assert
+    assert_double_equal(first.ipc(), 2.0, 1e-12, "4000 инструкций за 2000 тактов - IPC 2");
+    assert_true(first.has(PerfCounter::CacheMisses) && !first.has(PerfCounter::BranchMisses),
+                "Маска объединяет доступные счетчики");
+    assert_double_equal(empty.ipc(), 0.0, 1e-12, "Без счетчиков IPC равен 0");
+}
+
+/**
+ * @brief Тест: Группа счетчиков согласована с доступностью
+ * AAA: Arrange - открываем группу потока, Act - читаем дважды, Assert - проверяем маску и рост тактов
+ */
+void test_perf_group_degrades_gracefully() {
+    test_group("Группа счетчиков при наличии и отсутствии perf_event_open");
+    
+    // Arrange
+    PerfCounterGroup& group = PerfCounterGroup::for_current_thread();
+    
+    // Act
+    PerfSample before = group.read();
+    volatile double sink = 0.0;
+    for (int i = 0; i < 100000; i++) {
+        sink = sink + std::sqrt(static_cast<double>(i));
+    }
+    PerfSample after = group.read();
+    
+    // Assert
+    if (group.is_available()) {
+        assert_true(after.available_mask != 0, "Доступная группа возвращает непустую маску");
+        assert_true(!after.has(PerfCounter::Cycles) ||
+                    after.get(PerfCounter::Cycles) >= before.get(PerfCounter::Cycles),
+                    "Такты не убывают");
+    } else {
+        assert_true(after.available_mask == 0 && after.get(PerfCounter::Cycles) == 0,
+                    "Недоступная группа возвращает пустой замер");
+    }
+    assert_true(PerfProfiler::is_available() == group.is_available(),
+                "Доступность профилировщика совпадает с группой потока");
+}
+
+/**
+ * @brief Тест: Интерполятор с профилировщиком
+ * AAA: Arrange - подключаем профилировщик, Act - устанавливаем данные и вычисляем, Assert - проверяем
+ */
+void test_perf_profiler_interpolator() {
+    test_group("Интерполятор с профилировщиком");
+    
+    // Arrange
+    std::vector<double> x;
+    std::vector<double> y;
+    for (int i = 0; i < 25; i++) {
+        x.push_back(0.4 * (24 - i));
+        y.push_back(std::sin(0.4 * (24 - i)));
+    }
+    std::vector<double> points = NewtonInterpolator::generate_points(0.0, 9.6, 4000);
+    std::vector<double> expected = NewtonInterpolator(x, y).interpolate_multiple(points);
+    PerfProfiler profiler;
+    NewtonInterpolator interpolator;
+    interpolator.set_perf_profiler(&profiler);
+    
+    // Act
+    interpolator.set_data(x, y);
+    std::vector<double> results = interpolator.interpolate_multiple(points);
+    
+    // Assert
+    assert_vector_equal(results, expected, 1e-12, "Значения не зависят от профилировщика");
+    PerfThreadSample evaluation = profiler.get_phase_total(InterpolationPhase::Evaluation);
+    if (PerfProfiler::is_available()) {
+        assert_true(evaluation.points == points.size(), "Участки потоков покрывают весь пакет");
+        assert_true(profiler.get_phase_total(InterpolationPhase::Sort).scopes == 1 &&
+                    profiler.get_phase_total(InterpolationPhase::Coefficients).scopes == 1,
+                    "Сортировка и коэффициенты измерены по одному разу");
+    } else {
+        assert_true(evaluation.scopes == 0 && profiler.summary().find("недоступны") != std::string::npos,
+                    "Без счетчиков ничего не накапливается, отчет сообщает о недоступности");
+    }
+    profiler.reset();
+    assert_true(profiler.get_thread_samples(InterpolationPhase::Evaluation).empty(), "reset очищает ячейки");
+}
+
+/**
+ * @brief Тест: Этапы set_data не пересекаются
+ * AAA: Arrange - источник замеров считает обращения, Act - задаем неотсортированные узлы,
+ *      Assert - между началом и концом сортировки других замеров нет
+ */
+void test_perf_profiler_phases_disjoint() {
+    test_group("Этапы set_data не пересекаются");
+    
+    // Arrange
+    std::atomic<uint64_t> reads{0};
+    PerfProfiler profiler;
+    profiler.set_sample_source([&reads]() {
+        PerfSample sample;
+        sample.values[static_cast<size_t>(PerfCounter::Cycles)] = ++reads;
+        sample.available_mask = 1u << static_cast<unsigned>(PerfCounter::Cycles);
+        return sample;
+    });
+    std::vector<double> x = {3.0, 1.0, 4.0, 0.5, 2.0};
+    std::vector<double> y = {9.0, 1.0, 16.0, 0.25, 4.0};
+    NewtonInterpolator interpolator;
+    interpolator.set_perf_profiler(&profiler);
+    int saved_threads = omp_get_max_threads();
+    omp_set_num_threads(1);
+    
+    // Act
+    interpolator.set_data(x, y);
+    omp_set_num_threads(saved_threads);
+    
+    // Assert
+    PerfThreadSample sort = profiler.get_phase_total(InterpolationPhase::Sort);
+    PerfThreadSample coefficients = profiler.get_phase_total(InterpolationPhase::Coefficients);
+    assert_true(sort.scopes == 1 && coefficients.scopes == 1, "Сортировка и коэффициенты измерены по одному разу");
+    assert_true(sort.sample.get(PerfCounter::Cycles) == 1,
+                "Замеры построения коэффициентов не попадают в интервал сортировки");
+    assert_double_equal(interpolator.interpolate(1.5), 2.25, 1e-12, "Интерполятор построен");
+}
+
+/**
+ * @brief Тест: Профилировщик измеряет пакет в заданном распределении
+ * AAA: Arrange - источник замеров и пул work-stealing, Act - вычисляем пакет с профилировщиком,
+ *      Assert - пул выполнил цикл, все точки учтены в ячейках его потоков
+ */
+void test_perf_profiler_keeps_schedule() {
+    test_group("Профилировщик не меняет распределение пакета");
+    
+    // Arrange
+    std::atomic<uint64_t> reads{0};
+    PerfProfiler profiler;
+    profiler.set_sample_source([&reads]() {
+        PerfSample sample;
+        sample.values[static_cast<size_t>(PerfCounter::Cycles)] = ++reads;
+        sample.available_mask = 1u << static_cast<unsigned>(PerfCounter::Cycles);
+        return sample;
+    });
+    std::vector<double> x;
+    std::vector<double> y;
+    for (int i = 0; i < 25; i++) {
+        x.push_back(0.4 * i);
+        y.push_back(std::sin(0.4 * i));
+    }
+    NewtonInterpolator interpolator(x, y);
+    std::vector<double> points = NewtonInterpolator::generate_points(0.0, 9.6, 5000);
+    std::vector<double> expected = interpolator.interpolate_multiple(points);
+    std::vector<double> results(points.size());
+    WorkStealingPool pool(3);
+    ParallelSchedule schedule;
+    schedule.policy = SchedulePolicy::WorkStealing;
+    schedule.chunk_size = 2;
+    schedule.pool = &pool;
+    interpolator.set_schedule(schedule);
+    interpolator.set_perf_profiler(&profiler);
+    
+    // Act
+    InterpolationStatus status = interpolator.interpolate_into(points, results);
+    
+    // Assert
+    PerfThreadSample total = profiler.get_phase_total(InterpolationPhase::Evaluation);
+    bool pool_threads = true;
+    for (const PerfThreadSample& cell : profiler.get_thread_samples(InterpolationPhase::Evaluation)) {
+        pool_threads = pool_threads && cell.thread < pool.get_thread_count();
+    }
+    assert_true(status == InterpolationStatus::Ok && pool.get_run_count() == 1, "Пакет выполнен пулом распределения");
+    assert_true(total.points == points.size() && profiler.get_dropped_scopes() == 0, "Все точки учтены");
+    assert_true(pool_threads, "Ячейки соответствуют потокам пула");
+    assert_vector_equal(results, expected, 1e-12, "Результаты совпадают");
+}
+
+/**
+ * @brief Запуск всех тестов для PerfCounterGroup и PerfProfiler
+ */
+void run_perf_counters_tests() {
+    std::cout << "\n=== Тесты PerfCounterGroup и PerfProfiler ===\n";
+    
+    test_perf_sample_arithmetic();
+    test_perf_group_degrades_gracefully();
+    test_perf_profiler_interpolator();
+    test_perf_profiler_phases_disjoint();
+    test_perf_profiler_keeps_schedule();
+}
@@ -0,0 +1,14 @@
+/**
+ * @file test_perf_counters.h
+ * @brief Объявления тестов для PerfCounterGroup и PerfProfiler
+ */
+
+#ifndef TEST_PERF_COUNTERS_H
+#define TEST_PERF_COUNTERS_H
+
+/**
+ * @brief Запуск всех тестов для PerfCounterGroup и PerfProfiler
+ */
+void run_perf_counters_tests();
+
+#endif // TEST_PERF_COUNTERS_H
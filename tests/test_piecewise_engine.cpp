@@ -0,0 +1,163 @@
+/**
+ * @file test_piecewise_engine.cpp
+ * @brief Модульные тесты для класса PiecewiseEngine и кусочного режима интерполятора
+ */
+
+#include "test_piecewise_engine.h"
+#include "test_utils.h"
+#include "../src/core/piecewise_engine.h"
+#include "../src/core/newton_interpolator.h"
+#include <cmath>
+#include <stdexcept>
+
+/**
+ * @brief Тест: Кубические локальные полиномы точно воспроизводят кубическую функцию
+ * AAA: Arrange - готовим узлы y = x^3 - 2x, Act - интерполируем кусочно, Assert - проверяем точность
+ */
+void test_piecewise_reproduces_cubic() {
+    test_group("Кусочная интерполяция кубической функции");
+    
+    // Arrange
+    std::vector<double> x;
+    std::vector<double> y;
+    for (int i = 0; i < 20; i++) {
+        double xi = 0.5 * i;
+        x.push_back(xi);
+        y.push_back(xi * xi * xi - 2.0 * xi);
+    }
+    NewtonInterpolator interpolator(x, y, InterpolationMethod::Piecewise);
+    std::vector<double> points = NewtonInterpolator::generate_points(-1.0, 10.0, 57);
+    
+    // Act
+    std::vector<double> results = interpolator.interpolate_multiple(points);
+    
+    // Assert
+    std::vector<double> expected;
+    for (double p : points) {
+        expected.push_back(p * p * p - 2.0 * p);
+    }
+    assert_true(interpolator.get_piecewise_degree() == 3, "Степень по умолчанию равна 3");
+    assert_vector_equal(results, expected, 1e-8, "Кубическая функция воспроизводится точно, включая экстраполяцию");
+}
+
+/**
+ * @brief Тест: Поиск отрезка на неравномерной сетке
+ * AAA: Arrange - готовим неравномерные узлы, Act - ищем отрезки, Assert - сравниваем с линейным поиском
+ */
+void test_piecewise_locate_nonuniform() {
+    test_group("Поиск отрезка на неравномерной сетке");
+    
+    // Arrange - узлы сгущаются к левому краю
+    std::vector<double> x;
+    std::vector<double> y;
+    for (int i = 0; i < 50; i++) {
+        double t = i / 49.0;
+        x.push_back(t * t * t * 10.0);
+        y.push_back(std::sin(x.back()));
+    }
+    PiecewiseEngine engine;
+    engine.compute(x.data(), y.data(), x.size());
+    
+    // Act & Assert
+    bool all_correct = true;
+    for (int i = 0; i <= 1000; i++) {
+        double t = 10.0 * i / 1000.0;
+        size_t expected = 0;
+        while (expected + 2 < x.size() && x[expected + 1] <= t) {
+            expected++;
+        }
+        if (engine.locate(t) != expected) {
+            all_correct = false;
+        }
+    }
+    assert_true(all_correct, "locate совпадает с линейным поиском во всех точках");
+    assert_true(engine.locate(-5.0) == 0 && engine.locate(50.0) == x.size() - 2,
+                "Точки вне таблицы относятся к крайним отрезкам");
+}
+
+/**
+ * @brief Тест: Порядок точек не влияет на результат
+ * AAA: Arrange - готовим упорядоченные и перемешанные точки, Act - вычисляем пакетно, Assert - сравниваем
+ */
+void test_piecewise_sorted_and_unsorted_queries() {
+    test_group("Упорядоченные и неупорядоченные точки");
+    
+    // Arrange
+    std::vector<double> x;
+    std::vector<double> y;
+    for (int i = 0; i < 3000; i++) {
+        x.push_back(0.01 * i);
+        y.push_back(std::sin(0.01 * i));
+    }
+    NewtonInterpolator interpolator(x, y, InterpolationMethod::Piecewise);
+    std::vector<double> sorted_points = NewtonInterpolator::generate_points(0.0, 29.99, 5000);
+    std::vector<double> shuffled_points(sorted_points.rbegin(), sorted_points.rend());
+    
+    // Act
+    std::vector<double> sorted_results = interpolator.interpolate_multiple(sorted_points);
+    std::vector<double> shuffled_results = interpolator.interpolate_multiple(shuffled_points);
+    
+    // Assert
+    std::vector<double> reversed(shuffled_results.rbegin(), shuffled_results.rend());
+    assert_vector_equal(reversed, sorted_results, 1e-15, "Результаты не зависят от порядка точек");
+    double max_error = 0.0;
+    for (size_t i = 0; i < sorted_points.size(); i++) {
+        max_error = std::max(max_error, std::abs(sorted_results[i] - std::sin(sorted_points[i])));
+    }
+    assert_true(max_error < 1e-9, "Кубическая кусочная интерполяция sin(x) точна на 3000 узлах");
+}
+
+/**
+ * @brief Тест: Кусочный режим не поддерживает add_node
+ * AAA: Arrange - создаем кусочный интерполятор, Act - добавляем узел, Assert - проверяем исключение
+ */
+void test_piecewise_add_node_rejected() {
+    test_group("add_node в кусочном режиме");
+    
+    // Arrange
+    NewtonInterpolator interpolator({0.0, 1.0, 2.0}, {0.0, 1.0, 4.0}, InterpolationMethod::Piecewise);
+    
+    // Act & Assert
+    assert_throws<std::logic_error>(
+        [&]() { interpolator.add_node(3.0, 9.0); },
+        "add_node выбрасывает исключение в кусочном режиме"
+    );
+    assert_throws<std::invalid_argument>(
+        [&]() { interpolator.set_piecewise_degree(0); },
+        "Нулевая степень выбрасывает исключение"
+    );
+}
+
+/**
+ * @brief Тест: Окно из одного узла отклоняется до изменения таблицы
+ * AAA: Arrange - кусочный интерполятор на 5 узлах, Act - задаем окно 1, Assert - исключение и прежняя таблица
+ */
+void test_piecewise_window_of_one_rejected() {
+    test_group("Окно из одного узла в кусочном режиме");
+    
+    // Arrange
+    NewtonInterpolator interpolator({0.0, 1.0, 2.0, 3.0, 4.0}, {0.0, 1.0, 4.0, 9.0, 16.0},
+                                    InterpolationMethod::Piecewise);
+    
+    // Act & Assert
+    assert_throws<std::invalid_argument>(
+        [&]() { interpolator.set_window_size(1); },
+        "Окно из одного узла выбрасывает исключение"
+    );
+    assert_true(interpolator.get_node_count() == 5 && interpolator.get_window_size() == 0,
+                "Узлы и размер окна не изменились");
+    assert_double_equal(interpolator.interpolate(2.5), 6.25, 1e-12, "Интерполяция по прежней таблице");
+}
+
+/**
+ * @brief Запуск всех тестов для PiecewiseEngine
+ */
+void run_piecewise_engine_tests() {
+    std::cout << "\n=== Тесты PiecewiseEngine ===\n";
+    
+    test_piecewise_reproduces_cubic();
+    test_piecewise_locate_nonuniform();
+    test_piecewise_sorted_and_unsorted_queries();
+    test_piecewise_add_node_rejected();
+    test_piecewise_window_of_one_rejected();
+}
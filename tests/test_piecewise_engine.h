@@ -0,0 +1,14 @@
+/**
+ * @file test_piecewise_engine.h
+ * @brief Объявления тестов для PiecewiseEngine
+ */
+
+#ifndef TEST_PIECEWISE_ENGINE_H
+#define TEST_PIECEWISE_ENGINE_H
+
+/**
+ * @brief Запуск всех тестов для PiecewiseEngine
+ */
+void run_piecewise_engine_tests();
+
+#endif // TEST_PIECEWISE_ENGINE_H
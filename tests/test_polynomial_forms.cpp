@@ -0,0 +1,109 @@
+/**
+ * @file test_polynomial_forms.cpp
+ * @brief Модульные тесты для перевода формы Ньютона в ряд Чебышева и мономиальный базис
+ */
+
+#include "test_polynomial_forms.h"
+#include "test_utils.h"
+#include "../src/core/chebyshev_evaluator.h"
+#include "../src/core/monomial_evaluator.h"
+#include "../src/core/newton_interpolator.h"
+#include <cmath>
+#include <stdexcept>
+
+/**
+ * @brief Тест: Коэффициенты для известного полинома
+ * AAA: Arrange - готовим узлы y = t^2 на [-1, 1], Act - переводим, Assert - сверяем коэффициенты
+ */
+void test_forms_known_coefficients() {
+    test_group("Коэффициенты t^2 в базисах Чебышева и мономов");
+    
+    // Arrange
+    std::vector<double> x = {-1.0, 0.0, 1.0};
+    std::vector<double> y = {1.0, 0.0, 1.0};
+    NewtonInterpolator interpolator(x, y);
+    
+    // Act
+    ChebyshevEvaluator chebyshev = interpolator.to_chebyshev();
+    MonomialEvaluator monomial = interpolator.to_monomial();
+    
+    // Assert - t^2 = (T_0 + T_2) / 2
+    const AlignedVector<double>& a = chebyshev.get_coefficients();
+    assert_vector_equal(std::vector<double>(a.begin(), a.end()), {0.5, 0.0, 0.5}, 1e-12,
+                        "Ряд Чебышева для t^2 равен (T_0 + T_2) / 2");
+    const AlignedVector<double>& m = monomial.get_coefficients();
+    assert_vector_equal(std::vector<double>(m.begin(), m.end()), {0.0, 0.0, 1.0}, 1e-12,
+                        "Мономиальные коэффициенты t^2 равны (0, 0, 1)");
+}
+
+/**
+ * @brief Тест: Вычислители совпадают с формой Ньютона на сдвинутом интервале
+ * AAA: Arrange - готовим таблицу на [2, 7], Act - вычисляем тремя способами, Assert - сравниваем
+ */
+void test_forms_match_newton() {
+    test_group("Вычислители совпадают с формой Ньютона");
+    
+    // Arrange
+    std::vector<double> x = {2.0, 3.0, 3.5, 5.0, 6.2, 7.0};
+    std::vector<double> y = {1.0, -0.5, 2.0, 0.0, 3.0, 1.5};
+    NewtonInterpolator interpolator(x, y);
+    std::vector<double> points = NewtonInterpolator::generate_points(2.0, 7.0, 203);
+    std::vector<double> expected = interpolator.interpolate_multiple(points);
+    
+    // Act
+    ChebyshevEvaluator chebyshev = interpolator.to_chebyshev();
+    MonomialEvaluator monomial = interpolator.to_monomial();
+    std::vector<double> chebyshev_results(points.size());
+    std::vector<double> monomial_results(points.size());
+    chebyshev.evaluate(points.data(), chebyshev_results.data(), points.size());
+    monomial.evaluate(points.data(), monomial_results.data(), points.size());
+    
+    // Assert
+    assert_vector_equal(chebyshev_results, expected, 1e-9, "Ряд Чебышева (Кленшоу) совпадает с формой Ньютона");
+    assert_vector_equal(monomial_results, expected, 1e-9, "Мономиальная форма (Горнер) совпадает с формой Ньютона");
+    assert_double_equal(chebyshev.evaluate(4.2), interpolator.interpolate(4.2), 1e-9,
+                        "Вычисление в одной точке совпадает с пакетным");
+}
+
+/**
+ * @brief Тест: Ряд Чебышева для таблицы из 25 узлов
+ * AAA: Arrange - готовим таблицу как в main.cpp, Act - переводим в ряд Чебышева, Assert - сравниваем с формой Ньютона
+ */
+void test_forms_driver_sized_table() {
+    test_group("Ряд Чебышева для 25 узлов");
+    
+    // Arrange
+    std::vector<double> x;
+    std::vector<double> y;
+    for (int i = 0; i < 25; i++) {
+        x.push_back(0.4 * i);
+        y.push_back(std::sin(0.4 * i));
+    }
+    NewtonInterpolator interpolator(x, y);
+    std::vector<double> points = NewtonInterpolator::generate_points(0.0, 9.6, 500);
+    
+    // Act
+    ChebyshevEvaluator chebyshev = interpolator.to_chebyshev();
+    std::vector<double> results(points.size());
+    chebyshev.evaluate(points.data(), results.data(), points.size());
+    
+    // Assert
+    assert_vector_equal(results, interpolator.interpolate_multiple(points), 1e-8,
+                        "Ряд Чебышева совпадает с формой Ньютона на всем интервале");
+    NewtonInterpolator barycentric(x, y, InterpolationMethod::Barycentric);
+    assert_throws<std::logic_error>(
+        [&]() { barycentric.to_chebyshev(); },
+        "Перевод недоступен вне режима Ньютона"
+    );
+}
+
+/**
+ * @brief Запуск всех тестов для ChebyshevEvaluator и MonomialEvaluator
+ */
+void run_polynomial_forms_tests() {
+    std::cout << "\n=== Тесты ChebyshevEvaluator и MonomialEvaluator ===\n";
+    
+    test_forms_known_coefficients();
+    test_forms_match_newton();
+    test_forms_driver_sized_table();
+}
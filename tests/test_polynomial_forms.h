@@ -0,0 +1,14 @@
+/**
+ * @file test_polynomial_forms.h
+ * @brief Объявления тестов для ChebyshevEvaluator и MonomialEvaluator
+ */
+
+#ifndef TEST_POLYNOMIAL_FORMS_H
+#define TEST_POLYNOMIAL_FORMS_H
+
+/**
+ * @brief Запуск всех тестов для ChebyshevEvaluator и MonomialEvaluator
+ */
+void run_polynomial_forms_tests();
+
+#endif // TEST_POLYNOMIAL_FORMS_H
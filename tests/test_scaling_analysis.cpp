@@ -0,0 +1,137 @@
+/**
+ * @file test_scaling_analysis.cpp
+ * @brief Модульные тесты для анализа масштабируемости
+ */
+
+#include "test_scaling_analysis.h"
+#include "test_utils.h"
+#include "../src/core/scaling_analysis.h"
+#include <cmath>
+#include <stdexcept>
+
+namespace {
+
+/**
+ * @brief Времена прогонов программы, подчиняющейся закону Амдала, с симметричным шумом
+ */
+std::vector<std::vector<double>> amdahl_samples(const std::vector<int>& threads, double serial_fraction) {
+    std::vector<std::vector<double>> samples;
+    for (int p : threads) {
+        const double time = 100.0 * (serial_fraction + (1.0 - serial_fraction) / p);
+        samples.push_back({time * 0.9, time * 0.95, time, time * 1.05, time * 1.2});
+    }
+    return samples;
+}
+
+} // namespace
+
+/**
+ * @brief Тест: Показатели программы, подчиняющейся закону Амдала
+ * AAA: Arrange - времена при f = 0.1, Act - анализируем серию, Assert - проверяем показатели
+ */
+void test_scaling_amdahl_program() {
+    test_group("Показатели программы, подчиняющейся закону Амдала");
+
+    // Arrange
+    std::vector<int> threads = {1, 2, 4, 8};
+
+    // Act
+    ScalingSeries series = ScalingAnalysis::analyze("f = 0.1", threads, amdahl_samples(threads, 0.1));
+
+    // Assert
+    const ScalingPoint& eight = series.points[3];
+    assert_true(series.label == "f = 0.1" && series.points.size() == 4, "Точка на каждое число потоков");
+    assert_double_equal(series.points[0].speedup, 1.0, 1e-12, "Ускорение базы равно 1");
+    assert_double_equal(eight.speedup, 1.0 / (0.1 + 0.9 / 8), 1e-9, "Медианное ускорение");
+    assert_double_equal(eight.efficiency, eight.speedup / 8, 1e-12, "Эффективность");
+    assert_double_equal(eight.karp_flatt, 0.1, 1e-9, "Карп-Флэтт восстанавливает последовательную долю");
+    assert_true(std::isnan(series.points[0].karp_flatt), "Карп-Флэтт не определен для одного потока");
+    assert_double_equal(series.serial_fraction, 0.1, 1e-9, "Подобранная доля Амдала");
+    assert_double_equal(series.amdahl_speedup(8.0), eight.speedup, 1e-9, "Закон Амдала проходит через точки");
+    assert_true(eight.speedup_min <= eight.speedup_low && eight.speedup_low <= eight.speedup &&
+                eight.speedup <= eight.speedup_high && eight.speedup_high <= eight.speedup_max,
+                "Интервал медианы лежит внутри размаха прогонов");
+}
+
+/**
+ * @brief Тест: Подбор доли Амдала
+ * AAA: Arrange - идеальное и сверхлинейное ускорение, Act - подбираем долю, Assert - проверяем ограничения
+ */
+void test_scaling_fit_amdahl_bounds() {
+    test_group("Подбор доли Амдала");
+
+    // Arrange
+    std::vector<int> threads = {1, 2, 4};
+
+    // Act
+    double linear = ScalingAnalysis::fit_amdahl(threads, {1.0, 2.0, 4.0});
+    double superlinear = ScalingAnalysis::fit_amdahl(threads, {1.0, 3.0, 6.0});
+    double single = ScalingAnalysis::fit_amdahl({1}, {1.0});
+
+    // Assert
+    assert_double_equal(linear, 0.0, 1e-12, "Линейное ускорение - нулевая доля");
+    assert_double_equal(superlinear, 0.0, 1e-12, "Сверхлинейное ускорение ограничено нулем");
+    assert_double_equal(single, 0.0, 1e-12, "Без точек с p > 1 доля нулевая");
+    assert_throws<std::invalid_argument>([&]() { ScalingAnalysis::fit_amdahl(threads, {1.0}); },
+                                         "Разные размеры векторов");
+}
+
+/**
+ * @brief Тест: Измерение серии через Benchmark
+ * AAA: Arrange - считаем вызовы, Act - измеряем серию, Assert - проверяем число прогонов
+ */
+void test_scaling_measure() {
+    test_group("Измерение серии через Benchmark");
+
+    // Arrange
+    Benchmark benchmark(1, 3);
+    std::vector<int> seen;
+
+    // Act
+    ScalingSeries series = ScalingAnalysis::measure("busy", {1, 2}, benchmark, [&](int threads) {
+        seen.push_back(threads);
+        volatile double sink = 0.0;
+        for (int i = 0; i < 10000; i++) {
+            sink = sink + std::sqrt(static_cast<double>(i));
+        }
+    });
+
+    // Assert
+    assert_true(seen.size() == 8, "Прогрев и повторы для каждого числа потоков");
+    assert_true(seen.front() == 1 && seen.back() == 2, "Числа потоков передаются функции");
+    assert_true(series.points[1].time.runs == 3, "Статистика по измеряемым прогонам");
+}
+
+/**
+ * @brief Тест: Некорректные измерения
+ * AAA: Arrange - готовим некорректные данные, Act & Assert - проверяем исключения
+ */
+void test_scaling_invalid_input() {
+    test_group("Некорректные измерения масштабируемости");
+
+    // Arrange
+    std::vector<int> threads = {1, 2};
+
+    // Act & Assert
+    assert_throws<std::invalid_argument>([&]() { ScalingAnalysis::analyze("", {}, {}); }, "Пустая серия");
+    assert_throws<std::invalid_argument>([&]() { ScalingAnalysis::analyze("", threads, {{1.0}}); },
+                                         "Разные размеры threads и samples");
+    assert_throws<std::invalid_argument>([&]() { ScalingAnalysis::analyze("", threads, {{1.0}, {}}); },
+                                         "Число потоков без измерений");
+    assert_throws<std::invalid_argument>([&]() { ScalingAnalysis::analyze("", threads, {{1.0}, {0.0}}); },
+                                         "Нулевое время");
+    assert_throws<std::invalid_argument>([&]() { ScalingAnalysis::analyze("", {0, 2}, {{1.0}, {1.0}}); },
+                                         "Нулевое число потоков");
+}
+
+/**
+ * @brief Запуск всех тестов для ScalingAnalysis
+ */
+void run_scaling_analysis_tests() {
+    std::cout << "\n=== Тесты ScalingAnalysis ===\n";
+
+    test_scaling_amdahl_program();
+    test_scaling_fit_amdahl_bounds();
+    test_scaling_measure();
+    test_scaling_invalid_input();
+}
@@ -0,0 +1,14 @@
+/**
+ * @file test_scaling_analysis.h
+ * @brief Объявления тестов для ScalingAnalysis
+ */
+
+#ifndef TEST_SCALING_ANALYSIS_H
+#define TEST_SCALING_ANALYSIS_H
+
+/**
+ * @brief Запуск всех тестов для ScalingAnalysis
+ */
+void run_scaling_analysis_tests();
+
+#endif // TEST_SCALING_ANALYSIS_H
@@ -0,0 +1,162 @@
+/**
+ * @file test_streaming_evaluator.cpp
+ * @brief Модульные тесты для потокового вычисления и источников/приемников
+ */
+
+#include "test_streaming_evaluator.h"
+#include "test_utils.h"
+#include "../src/core/streaming_evaluator.h"
+#include <cmath>
+#include <cstdio>
+#include <sstream>
+
+/**
+ * @brief Приемник, падающий на заданной порции
+ */
+class FailingStreamWriter : public StreamWriter {
+private:
+    size_t remaining;
+
+public:
+    explicit FailingStreamWriter(size_t chunks_before_failure) : remaining(chunks_before_failure) {}
+
+    void write(std::span<const double>) override {
+        if (remaining-- == 0) {
+            throw std::runtime_error("Сбой приемника");
+        }
+    }
+};
+
+/**
+ * @brief Готовит интерполятор y = sin(x) на [0, 9.6]
+ */
+static NewtonInterpolator make_sine_interpolator() {
+    std::vector<double> x;
+    std::vector<double> y;
+    for (int i = 0; i < 25; i++) {
+        x.push_back(0.4 * i);
+        y.push_back(std::sin(0.4 * i));
+    }
+    return NewtonInterpolator(x, y);
+}
+
+/**
+ * @brief Тест: Текстовый поток мелкими порциями
+ * AAA: Arrange - готовим текст точек, Act - вычисляем конвейером, Assert - сверяем с interpolate_multiple
+ */
+void test_streaming_text_round_trip() {
+    test_group("Текстовый поток мелкими порциями");
+    
+    // Arrange
+    NewtonInterpolator interpolator = make_sine_interpolator();
+    std::vector<double> points = NewtonInterpolator::generate_points(0.0, 9.6, 1000);
+    std::stringstream input;
+    input.precision(17);
+    for (double p : points) {
+        input << p << (p < 5.0 ? ' ' : '\n');
+    }
+    std::stringstream output;
+    TextStreamReader reader(input);
+    TextStreamWriter writer(output);
+    StreamingEvaluator evaluator(interpolator, 7, 3);
+    
+    // Act
+    StreamingStats stats = evaluator.run(reader, writer);
+    
+    // Assert
+    std::vector<double> results;
+    double value = 0.0;
+    while (output >> value) {
+        results.push_back(value);
+    }
+    assert_true(stats.points == 1000 && stats.chunks == 143, "Все точки прочитаны порциями по 7");
+    assert_vector_equal(results, interpolator.interpolate_multiple(points), 1e-12,
+                        "Результаты в порядке точек и совпадают с interpolate_multiple");
+    assert_true(stats.points_per_second() > 0.0 && stats.overlap() > 0.0, "Пропускная способность посчитана");
+}
+
+/**
+ * @brief Тест: Двойная буферизация с двоичными файлами
+ * AAA: Arrange - записываем файл точек, Act - вычисляем в файл результатов, Assert - перечитываем
+ */
+void test_streaming_binary_files() {
+    test_group("Двойная буферизация с двоичными файлами");
+    
+    // Arrange
+    NewtonInterpolator interpolator = make_sine_interpolator();
+    std::vector<double> points = NewtonInterpolator::generate_points(0.0, 9.6, 5000);
+    MappedBinaryFile::write_array("test_stream_points.bin", BinaryArrayKind::Points, points);
+    
+    // Act
+    {
+        BinaryFileStreamReader reader("test_stream_points.bin");
+        BinaryFileStreamWriter writer("test_stream_results.bin");
+        StreamingEvaluator(interpolator, 512, 2).run(reader, writer);
+    }
+    MappedBinaryFile results = MappedBinaryFile::open("test_stream_results.bin");
+    
+    // Assert
+    std::vector<double> values(results.get_values().begin(), results.get_values().end());
+    assert_true(results.get_kind() == BinaryArrayKind::Results, "Файл результатов с исправленным заголовком");
+    assert_vector_equal(values, interpolator.interpolate_multiple(points), 1e-12,
+                        "Результаты совпадают с interpolate_multiple");
+    
+    std::remove("test_stream_points.bin");
+    std::remove("test_stream_results.bin");
+}
+
+/**
+ * @brief Тест: Ошибки параметров, источника и приемника
+ * AAA: Arrange - готовим некорректные данные, Act - запускаем конвейер, Assert - проверяем исключения
+ */
+void test_streaming_errors() {
+    test_group("Ошибки параметров, источника и приемника");
+    
+    // Arrange
+    NewtonInterpolator interpolator = make_sine_interpolator();
+    NewtonInterpolator empty;
+    std::vector<double> points(10000, 1.0);
+    std::stringstream bad_input("1.0 2.0 abc 3.0");
+    std::stringstream output;
+    
+    // Act & Assert
+    assert_throws<std::invalid_argument>([&]() { StreamingEvaluator(interpolator, 0, 3); },
+                                         "Нулевой размер порции");
+    assert_throws<std::invalid_argument>([&]() { StreamingEvaluator(interpolator, 16, 4); },
+                                         "Поддерживаются только 2 и 3 буфера");
+    assert_throws<std::runtime_error>(
+        [&]() {
+            TextStreamReader reader(bad_input);
+            TextStreamWriter writer(output);
+            StreamingEvaluator(interpolator, 16, 3).run(reader, writer);
+        },
+        "Ошибка разбора источника передается вызывающему");
+    assert_throws<std::runtime_error>(
+        [&]() {
+            std::stringstream input;
+            input.write(reinterpret_cast<const char*>(points.data()), points.size() * sizeof(double));
+            RawStreamReader reader(input);
+            FailingStreamWriter writer(2);
+            StreamingEvaluator(interpolator, 100, 3).run(reader, writer);
+        },
+        "Сбой приемника останавливает конвейер без зависания");
+    assert_throws<std::logic_error>(
+        [&]() {
+            std::stringstream input("1.0");
+            TextStreamReader reader(input);
+            TextStreamWriter writer(output);
+            StreamingEvaluator(empty).run(reader, writer);
+        },
+        "Интерполятор без данных");
+}
+
+/**
+ * @brief Запуск всех тестов для StreamingEvaluator
+ */
+void run_streaming_evaluator_tests() {
+    std::cout << "\n=== Тесты StreamingEvaluator ===\n";
+    
+    test_streaming_text_round_trip();
+    test_streaming_binary_files();
+    test_streaming_errors();
+}
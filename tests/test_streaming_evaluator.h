@@ -0,0 +1,14 @@
+/**
+ * @file test_streaming_evaluator.h
+ * @brief Объявления тестов для StreamingEvaluator
+ */
+
+#ifndef TEST_STREAMING_EVALUATOR_H
+#define TEST_STREAMING_EVALUATOR_H
+
+/**
+ * @brief Запуск всех тестов для StreamingEvaluator
+ */
+void run_streaming_evaluator_tests();
+
+#endif // TEST_STREAMING_EVALUATOR_H
@@ -0,0 +1,170 @@
+/**
+ * @file test_text_table_loader.cpp
+ * @brief Модульные тесты для параллельного разбора и записи текстовых таблиц
+ */
+
+#include "test_text_table_loader.h"
+#include "test_utils.h"
+#include "../src/core/text_table_loader.h"
+#include "../src/core/text_table_writer.h"
+#include "../src/core/newton_interpolator.h"
+#include <cmath>
+#include <cstdio>
+
+/**
+ * @brief Тест: Разбор CSV с заголовком, комментариями и пустыми строками
+ * AAA: Arrange - готовим текст, Act - разбираем два столбца, Assert - проверяем значения
+ */
+void test_text_loader_formats() {
+    test_group("Разбор CSV с заголовком, комментариями и пустыми строками");
+    
+    // Arrange
+    std::string text = "x,y,weight\r\n"
+                        "# узлы\r\n"
+                        "0.5, 1e-3, 7\r\n"
+                        "\r\n"
+                        "+2;-3.25  # конец строки\n"
+                        "\t4\t5";
+    TextTableLoader loader;
+    
+    // Act
+    std::vector<std::vector<double>> columns = loader.parse_columns(text, 2);
+    
+    // Assert
+    assert_vector_equal(columns[0], {0.5, 2.0, 4.0}, 1e-15, "Столбец x");
+    assert_vector_equal(columns[1], {1e-3, -3.25, 5.0}, 1e-15, "Столбец y, лишние столбцы игнорируются");
+    assert_true(loader.parse_columns("", 2)[0].empty(), "Пустой текст - пустые столбцы");
+}
+
+/**
+ * @brief Тест: Заголовком считается только строка, начинающаяся не с числа
+ * AAA: Arrange - первые строки с мусором и нехваткой чисел, Act - разбираем, Assert - ошибки и заголовок
+ */
+void test_text_loader_header_detection() {
+    test_group("Заголовком считается только строка, начинающаяся не с числа");
+    
+    // Arrange
+    TextTableLoader loader;
+    
+    // Act
+    std::vector<std::vector<double>> columns = loader.parse_columns("\n  time;value\n1 2\n", 2);
+    
+    // Assert
+    assert_vector_equal(columns[1], {2.0}, 1e-15, "Текстовый заголовок после пустой строки пропускается");
+    assert_throws<std::runtime_error>([&]() { loader.parse_columns("1.0 abc\n2 3\n", 2); },
+                                      "Мусор во втором поле первой строки - ошибка");
+    assert_throws<std::runtime_error>([&]() { loader.parse_columns("1.0\n2 3\n", 2); },
+                                      "Короткая первая строка - ошибка");
+    assert_throws<std::runtime_error>([&]() { loader.parse_columns("x y\nx y\n1 2\n", 2); },
+                                      "Второй заголовок - ошибка");
+}
+
+/**
+ * @brief Тест: Параллельный разбор совпадает с последовательным
+ * AAA: Arrange - формируем большой текст, Act - разбираем 1 и 4 потоками, Assert - сравниваем
+ */
+void test_text_loader_parallel_matches_serial() {
+    test_group("Параллельный разбор совпадает с последовательным");
+    
+    // Arrange
+    std::string text = "x y\n";
+    for (int i = 0; i < 20000; i++) {
+        text += std::to_string(i * 0.001) + (i % 3 == 0 ? ",  " : " ") + std::to_string(std::sin(i * 0.001)) + "\n";
+        if (i % 1000 == 0) {
+            text += "# контрольная точка\n\n";
+        }
+    }
+    
+    // Act
+    std::vector<std::vector<double>> serial = TextTableLoader(1).parse_columns(text, 2);
+    std::vector<std::vector<double>> parallel = TextTableLoader(4, 0).parse_columns(text, 2);
+    std::vector<std::vector<double>> many = TextTableLoader(64, 0).parse_columns("1 2\n3 4\n", 2);
+    
+    // Assert
+    assert_true(serial[0].size() == 20000, "Все строки разобраны");
+    assert_vector_equal(parallel[0], serial[0], 1e-15, "Столбец x не зависит от числа потоков");
+    assert_vector_equal(parallel[1], serial[1], 1e-15, "Столбец y не зависит от числа потоков");
+    assert_vector_equal(many[1], {2.0, 4.0}, 1e-15, "Потоков больше, чем строк");
+}
+
+/**
+ * @brief Тест: Ошибки разбора с номером строки
+ * AAA: Arrange - готовим некорректный текст, Act - разбираем, Assert - проверяем сообщение
+ */
+void test_text_loader_errors() {
+    test_group("Ошибки разбора с номером строки");
+    
+    // Arrange
+    std::string text = "1 2\n3 4\n5\n";
+    std::string message;
+    
+    // Act
+    try {
+        TextTableLoader(4, 0).parse_columns(text, 2, "узлы.txt");
+    } catch (const std::runtime_error& e) {
+        message = e.what();
+    }
+    
+    // Assert
+    assert_true(message.find("узлы.txt, строка 3") != std::string::npos, "Сообщение указывает файл и строку");
+    assert_throws<std::runtime_error>([]() { TextTableLoader().parse_columns("1 2\n3 4x\n", 2); },
+                                      "Мусор после числа");
+    assert_throws<std::runtime_error>([]() { TextTableLoader().load_points("test_missing.txt"); },
+                                      "Отсутствующий файл");
+    assert_throws<std::invalid_argument>([]() { TextTableLoader().parse_columns("1", 0); },
+                                         "Нулевое число столбцов");
+}
+
+/**
+ * @brief Тест: Запись и повторная загрузка таблицы
+ * AAA: Arrange - записываем таблицу и точки, Act - загружаем и вычисляем, Assert - значения восстановлены точно
+ */
+void test_text_writer_round_trip() {
+    test_group("Запись и повторная загрузка таблицы");
+    
+    // Arrange
+    std::vector<double> x;
+    std::vector<double> y;
+    for (int i = 0; i < 30; i++) {
+        x.push_back(0.3 * i + 1e-17);
+        y.push_back(std::exp(-0.1 * i) / 3.0);
+    }
+    std::vector<double> points = NewtonInterpolator::generate_points(0.0, 8.7, 1000);
+    TextTableWriter::write_table("test_table.txt", x, y);
+    TextTableWriter::write_points("test_points.txt", points);
+    
+    // Act
+    std::vector<double> loaded_x;
+    std::vector<double> loaded_y;
+    TextTableLoader loader(4, 0);
+    loader.load_table("test_table.txt", loaded_x, loaded_y);
+    std::vector<double> loaded_points = loader.load_points("test_points.txt");
+    NewtonInterpolator interpolator;
+    interpolator.set_data(loaded_x, loaded_y);
+    
+    // Assert
+    assert_true(loaded_x == x && loaded_y == y && loaded_points == points,
+                "to_chars и from_chars восстанавливают double без потерь");
+    assert_vector_equal(interpolator.interpolate_multiple(loaded_points),
+                        NewtonInterpolator(x, y).interpolate_multiple(points), 1e-15,
+                        "Загруженная таблица передается в set_data");
+    assert_throws<std::invalid_argument>(
+        [&]() { TextTableWriter::write_table("test_bad.txt", x, points); },
+        "Столбцы разной длины");
+    
+    std::remove("test_table.txt");
+    std::remove("test_points.txt");
+}
+
+/**
+ * @brief Запуск всех тестов для TextTableLoader и TextTableWriter
+ */
+void run_text_table_loader_tests() {
+    std::cout << "\n=== Тесты TextTableLoader и TextTableWriter ===\n";
+    
+    test_text_loader_formats();
+    test_text_loader_header_detection();
+    test_text_loader_parallel_matches_serial();
+    test_text_loader_errors();
+    test_text_writer_round_trip();
+}
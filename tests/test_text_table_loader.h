@@ -0,0 +1,14 @@
+/**
+ * @file test_text_table_loader.h
+ * @brief Объявления тестов для TextTableLoader и TextTableWriter
+ */
+
+#ifndef TEST_TEXT_TABLE_LOADER_H
+#define TEST_TEXT_TABLE_LOADER_H
+
+/**
+ * @brief Запуск всех тестов для TextTableLoader и TextTableWriter
+ */
+void run_text_table_loader_tests();
+
+#endif // TEST_TEXT_TABLE_LOADER_H
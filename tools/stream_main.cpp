@@ -0,0 +1,262 @@
+/**
+ * @file stream_main.cpp
+ * @brief Потоковое вычисление интерполянта для потоков точек любой длины (make stream)
+ *
+ * Точки читаются порциями из файла или stdin, вычисляются параллельно и
+ * записываются в файл или stdout; чтение, вычисление и запись перекрываются.
+ * Без --input точки генерируются равномерно на [0, 10], а результаты
+ * отбрасываются - это режим измерения пропускной способности.
+ * Итоги выводятся в stderr, чтобы не смешиваться с результатами в stdout.
+ *
+ * Таблица узлов (--table) читается из файла .bin или из текста (CSV, пробелы).
+ *
+ * Параметры: --table PATH, --nodes N, --method newton|barycentric|piecewise,
+ * --input PATH|-, --input-format text|raw|bin, --output PATH|-,
+ * --output-format text|raw|bin, --generate N, --chunk N, --buffers 2|3, --threads N
+ */
+
+#include <iostream>
+#include <fstream>
+#include <algorithm>
+#include <cmath>
+#include <numbers>
+#include <stdexcept>
+#include <cstdlib>
+#include <memory>
+#include <string>
+#include <vector>
+#include <omp.h>
+#include "core/newton_interpolator.h"
+#include "core/mapped_binary_file.h"
+#include "core/stream_io.h"
+#include "core/text_table_loader.h"
+#include "core/streaming_evaluator.h"
+
+/**
+ * @brief Параметры запуска
+ */
+struct StreamOptions {
+    std::string table_path;
+    size_t nodes = 100;
+    std::string method = "newton";
+    std::string input_path;
+    std::string input_format;
+    std::string output_path;
+    std::string output_format;
+    size_t generate = 10000000;
+    size_t chunk = DEFAULT_STREAM_CHUNK;
+    size_t buffers = 3;
+    int threads = 0;
+};
+
+/**
+ * @brief Разбирает аргументы командной строки
+ */
+StreamOptions parse_options(int argc, char** argv) {
+    StreamOptions options;
+    for (int i = 1; i < argc; i++) {
+        std::string arg = argv[i];
+        bool has_value = i + 1 < argc;
+        if (arg == "--table" && has_value) {
+            options.table_path = argv[++i];
+        } else if (arg == "--nodes" && has_value) {
+            options.nodes = std::strtoul(argv[++i], nullptr, 10);
+        } else if (arg == "--method" && has_value) {
+            options.method = argv[++i];
+        } else if (arg == "--input" && has_value) {
+            options.input_path = argv[++i];
+        } else if (arg == "--input-format" && has_value) {
+            options.input_format = argv[++i];
+        } else if (arg == "--output" && has_value) {
+            options.output_path = argv[++i];
+        } else if (arg == "--output-format" && has_value) {
+            options.output_format = argv[++i];
+        } else if (arg == "--generate" && has_value) {
+            options.generate = std::strtoull(argv[++i], nullptr, 10);
+        } else if (arg == "--chunk" && has_value) {
+            options.chunk = std::strtoul(argv[++i], nullptr, 10);
+        } else if (arg == "--buffers" && has_value) {
+            options.buffers = std::strtoul(argv[++i], nullptr, 10);
+        } else if (arg == "--threads" && has_value) {
+            options.threads = std::atoi(argv[++i]);
+        } else {
+            std::cerr << "Неизвестный параметр: " << arg << std::endl;
+            std::exit(1);
+        }
+    }
+    return options;
+}
+
+/**
+ * @brief Формат по умолчанию: bin для файлов .bin, иначе текст
+ */
+std::string default_format(const std::string& path) {
+    const std::string suffix = ".bin";
+    if (path.size() >= suffix.size() && path.compare(path.size() - suffix.size(), suffix.size(), suffix) == 0) {
+        return "bin";
+    }
+    return "text";
+}
+
+/**
+ * @brief Равномерные точки на [start, end] без хранения всего потока
+ */
+class GeneratedStreamReader : public StreamReader {
+private:
+    double start;
+    double step;
+    size_t total;
+    size_t position;
+
+public:
+    GeneratedStreamReader(double start, double end, size_t total)
+        : start(start), step(total > 1 ? (end - start) / (total - 1) : 0.0), total(total), position(0) {}
+
+    size_t read(std::span<double> chunk) override {
+        const size_t count = std::min(chunk.size(), total - position);
+        for (size_t i = 0; i < count; i++) {
+            chunk[i] = start + step * (position + i);
+        }
+        position += count;
+        return count;
+    }
+};
+
+/**
+ * @brief Приемник, отбрасывающий результаты (измерение пропускной способности)
+ */
+class DiscardStreamWriter : public StreamWriter {
+public:
+    void write(std::span<const double>) override {}
+};
+
+/**
+ * @brief Создает источник точек по параметрам
+ */
+std::unique_ptr<StreamReader> make_reader(const StreamOptions& options, std::ifstream& file) {
+    if (options.input_path.empty()) {
+        return std::make_unique<GeneratedStreamReader>(0.0, 10.0, options.generate);
+    }
+    const std::string format = options.input_format.empty() ? default_format(options.input_path)
+                                                            : options.input_format;
+    if (format == "bin") {
+        return std::make_unique<BinaryFileStreamReader>(options.input_path);
+    }
+    std::istream* input = &std::cin;
+    if (options.input_path != "-") {
+        file.open(options.input_path, std::ios::binary);
+        if (!file.is_open()) {
+            throw std::runtime_error("Не удалось открыть файл " + options.input_path);
+        }
+        input = &file;
+    }
+    if (format == "raw") {
+        return std::make_unique<RawStreamReader>(*input);
+    }
+    if (format == "text") {
+        return std::make_unique<TextStreamReader>(*input);
+    }
+    throw std::invalid_argument("Неизвестный формат входа: " + format);
+}
+
+/**
+ * @brief Создает приемник результатов по параметрам
+ */
+std::unique_ptr<StreamWriter> make_writer(const StreamOptions& options, std::ofstream& file) {
+    if (options.output_path.empty()) {
+        return std::make_unique<DiscardStreamWriter>();
+    }
+    const std::string format = options.output_format.empty() ? default_format(options.output_path)
+                                                             : options.output_format;
+    if (format == "bin") {
+        return std::make_unique<BinaryFileStreamWriter>(options.output_path);
+    }
+    std::ostream* output = &std::cout;
+    if (options.output_path != "-") {
+        file.open(options.output_path, std::ios::binary | std::ios::trunc);
+        if (!file.is_open()) {
+            throw std::runtime_error("Не удалось создать файл " + options.output_path);
+        }
+        output = &file;
+    }
+    if (format == "raw") {
+        return std::make_unique<RawStreamWriter>(*output);
+    }
+    if (format == "text") {
+        return std::make_unique<TextStreamWriter>(*output);
+    }
+    throw std::invalid_argument("Неизвестный формат выхода: " + format);
+}
+
+/**
+ * @brief Возвращает способ вычисления по имени
+ */
+InterpolationMethod parse_method(const std::string& name) {
+    if (name == "newton") {
+        return InterpolationMethod::Newton;
+    }
+    if (name == "barycentric") {
+        return InterpolationMethod::Barycentric;
+    }
+    if (name == "piecewise") {
+        return InterpolationMethod::Piecewise;
+    }
+    throw std::invalid_argument("Неизвестный способ вычисления: " + name);
+}
+
+int main(int argc, char** argv) {
+#ifdef _WIN32
+    system("chcp 65001 > nul");
+#endif
+
+    StreamOptions options = parse_options(argc, argv);
+    if (options.threads > 0) {
+        omp_set_num_threads(options.threads);
+    }
+
+    try {
+        NewtonInterpolator interpolator(parse_method(options.method));
+        if (!options.table_path.empty() && default_format(options.table_path) == "bin") {
+            MappedBinaryFile table = MappedBinaryFile::open(options.table_path);
+            if (table.has_coefficients()) {
+                interpolator.set_data(table.get_x(), table.get_y(), table.get_coefficients());
+            } else {
+                interpolator.set_data(table.get_x(), table.get_y());
+            }
+        } else if (!options.table_path.empty()) {
+            std::vector<double> x;
+            std::vector<double> y;
+            TextTableLoader().load_table(options.table_path, x, y);
+            interpolator.set_data(x, y);
+        } else {
+            // Узлы Чебышева на [0, 10]: полином высокой степени остается устойчивым
+            std::vector<double> x(options.nodes);
+            std::vector<double> y(options.nodes);
+            for (size_t i = 0; i < options.nodes; i++) {
+                x[i] = 5.0 - 5.0 * std::cos(std::numbers::pi * (2.0 * i + 1.0) / (2.0 * options.nodes));
+                y[i] = std::sin(x[i]);
+            }
+            interpolator.set_data(x, y);
+        }
+
+        std::ifstream input_file;
+        std::ofstream output_file;
+        std::unique_ptr<StreamReader> reader = make_reader(options, input_file);
+        std::unique_ptr<StreamWriter> writer = make_writer(options, output_file);
+
+        StreamingEvaluator evaluator(interpolator, options.chunk, options.buffers);
+        StreamingStats stats = evaluator.run(*reader, *writer);
+
+        std::cerr << "Узлов: " << interpolator.get_node_count() << ", точек: " << stats.points
+                  << ", порций: " << stats.chunks << " по " << options.chunk
+                  << ", буферов: " << options.buffers << std::endl;
+        std::cerr << "Время: " << stats.wall_ms << " мс (чтение " << stats.read_ms << ", вычисление "
+                  << stats.compute_ms << ", запись " << stats.write_ms << "), перекрытие "
+                  << stats.overlap() << std::endl;
+        std::cerr << "Пропускная способность: " << stats.points_per_second() << " точек/с" << std::endl;
+    } catch (const std::exception& e) {
+        std::cerr << "Ошибка: " << e.what() << std::endl;
+        return 1;
+    }
+    return 0;
+}